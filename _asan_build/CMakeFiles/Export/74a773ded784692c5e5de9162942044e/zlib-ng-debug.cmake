@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "zlib-ng::zlib" for configuration "Debug"
+set_property(TARGET zlib-ng::zlib APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(zlib-ng::zlib PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libz-ng.so.2.2.2"
+  IMPORTED_SONAME_DEBUG "libz-ng.so.2"
+  )
+
+list(APPEND _cmake_import_check_targets zlib-ng::zlib )
+list(APPEND _cmake_import_check_files_for_zlib-ng::zlib "${_IMPORT_PREFIX}/lib/libz-ng.so.2.2.2" )
+
+# Import target "zlib-ng::zlibstatic" for configuration "Debug"
+set_property(TARGET zlib-ng::zlibstatic APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(zlib-ng::zlibstatic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libz-ng.a"
+  )
+
+list(APPEND _cmake_import_check_targets zlib-ng::zlibstatic )
+list(APPEND _cmake_import_check_files_for_zlib-ng::zlibstatic "${_IMPORT_PREFIX}/lib/libz-ng.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
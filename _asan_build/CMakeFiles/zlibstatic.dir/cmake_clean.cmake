@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zlibstatic.dir/adler32.c.o"
+  "CMakeFiles/zlibstatic.dir/adler32.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/adler32_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/adler32_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/adler32_fold_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/adler32_fold_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/chunkset_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/chunkset_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/compare256_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/compare256_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32_braid_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32_braid_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32_fold_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32_fold_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32c_braid_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc32c_braid_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc64_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/crc64_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/generic/slide_hash_c.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/generic/slide_hash_c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx512.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx512.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx512_vnni.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_avx512_vnni.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_sse42.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_sse42.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_ssse3.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/adler32_ssse3.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_sse2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_sse2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_ssse3.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/chunkset_ssse3.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/compare256_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/compare256_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/compare256_sse2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/compare256_sse2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_pclmulqdq.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_pclmulqdq.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_vpclmulqdq.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_vpclmulqdq.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32c_sse42.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc32c_sse42.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc64_pclmulqdq.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc64_pclmulqdq.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc64_vpclmulqdq.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/crc64_vpclmulqdq.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/insert_string_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/insert_string_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/slide_hash_avx2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/slide_hash_avx2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/slide_hash_sse2.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/slide_hash_sse2.c.o.d"
+  "CMakeFiles/zlibstatic.dir/arch/x86/x86_features.c.o"
+  "CMakeFiles/zlibstatic.dir/arch/x86/x86_features.c.o.d"
+  "CMakeFiles/zlibstatic.dir/checksum_parallel.c.o"
+  "CMakeFiles/zlibstatic.dir/checksum_parallel.c.o.d"
+  "CMakeFiles/zlibstatic.dir/compress.c.o"
+  "CMakeFiles/zlibstatic.dir/compress.c.o.d"
+  "CMakeFiles/zlibstatic.dir/cpu_features.c.o"
+  "CMakeFiles/zlibstatic.dir/cpu_features.c.o.d"
+  "CMakeFiles/zlibstatic.dir/crc32.c.o"
+  "CMakeFiles/zlibstatic.dir/crc32.c.o.d"
+  "CMakeFiles/zlibstatic.dir/crc32_braid_comb.c.o"
+  "CMakeFiles/zlibstatic.dir/crc32_braid_comb.c.o.d"
+  "CMakeFiles/zlibstatic.dir/crc32c.c.o"
+  "CMakeFiles/zlibstatic.dir/crc32c.c.o.d"
+  "CMakeFiles/zlibstatic.dir/crc64.c.o"
+  "CMakeFiles/zlibstatic.dir/crc64.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_fast.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_fast.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_huff.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_huff.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_medium.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_medium.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_quick.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_quick.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_rle.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_rle.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_slow.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_slow.c.o.d"
+  "CMakeFiles/zlibstatic.dir/deflate_stored.c.o"
+  "CMakeFiles/zlibstatic.dir/deflate_stored.c.o.d"
+  "CMakeFiles/zlibstatic.dir/functable.c.o"
+  "CMakeFiles/zlibstatic.dir/functable.c.o.d"
+  "CMakeFiles/zlibstatic.dir/gzlib.c.o"
+  "CMakeFiles/zlibstatic.dir/gzlib.c.o.d"
+  "CMakeFiles/zlibstatic.dir/gzread.c.o"
+  "CMakeFiles/zlibstatic.dir/gzread.c.o.d"
+  "CMakeFiles/zlibstatic.dir/gzuring.c.o"
+  "CMakeFiles/zlibstatic.dir/gzuring.c.o.d"
+  "CMakeFiles/zlibstatic.dir/gzwrite.c.o"
+  "CMakeFiles/zlibstatic.dir/gzwrite.c.o.d"
+  "CMakeFiles/zlibstatic.dir/infback.c.o"
+  "CMakeFiles/zlibstatic.dir/infback.c.o.d"
+  "CMakeFiles/zlibstatic.dir/inflate.c.o"
+  "CMakeFiles/zlibstatic.dir/inflate.c.o.d"
+  "CMakeFiles/zlibstatic.dir/inftrees.c.o"
+  "CMakeFiles/zlibstatic.dir/inftrees.c.o.d"
+  "CMakeFiles/zlibstatic.dir/insert_string.c.o"
+  "CMakeFiles/zlibstatic.dir/insert_string.c.o.d"
+  "CMakeFiles/zlibstatic.dir/insert_string_roll.c.o"
+  "CMakeFiles/zlibstatic.dir/insert_string_roll.c.o.d"
+  "CMakeFiles/zlibstatic.dir/trees.c.o"
+  "CMakeFiles/zlibstatic.dir/trees.c.o.d"
+  "CMakeFiles/zlibstatic.dir/uncompr.c.o"
+  "CMakeFiles/zlibstatic.dir/uncompr.c.o.d"
+  "CMakeFiles/zlibstatic.dir/zthread.c.o"
+  "CMakeFiles/zlibstatic.dir/zthread.c.o.d"
+  "CMakeFiles/zlibstatic.dir/zutil.c.o"
+  "CMakeFiles/zlibstatic.dir/zutil.c.o.d"
+  "libz-ng.a"
+  "libz-ng.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zlibstatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
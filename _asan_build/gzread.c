@@ -0,0 +1,1481 @@
+/* gzread.c -- zlib functions for reading gzip files
+ * Copyright (C) 2004-2017 Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zutil_p.h"
+#include "gzguts.h"
+
+/* Local functions */
+static int gz_load(gz_state *, unsigned char *, unsigned, unsigned *);
+static int gz_avail(gz_state *);
+static int gz_look(gz_state *);
+static int gz_bgzf_look(gz_state *);
+static int gz_ahead_look(gz_state *);
+static int gz_decomp(gz_state *);
+static int gz_bgzf_fetch(gz_state *);
+static int gz_ahead_fetch(gz_state *);
+static int gz_fetch(gz_state *);
+static int gz_jump(gz_state *, const gz_bgzf_entry *, size_t, z_off64_t *);
+static int gz_skip(gz_state *, z_off64_t);
+static size_t gz_read(gz_state *, void *, size_t);
+static void gz_bgzf_end(gz_state *);
+static void gz_ahead_end(gz_state *);
+
+/* Use read() to load a buffer -- return -1 on error, otherwise 0.  Read from
+   state->fd, and update state->eof, state->err, and state->msg as appropriate.
+   This function needs to loop on read(), since read() is not guaranteed to
+   read the number of bytes requested, depending on the type of descriptor. */
+static int gz_load(gz_state *state, unsigned char *buf, unsigned len, unsigned *have) {
+    gz_map *map = state->map;
+    ssize_t ret;
+
+    /* copy from the mapped file instead if there is one */
+    if (map != NULL) {
+        *have = map->pos >= map->size ? 0 :
+                map->size - map->pos < (z_off64_t)len ? (unsigned)(map->size - map->pos) : len;
+        if (*have)
+            memcpy(buf, map->data + map->pos, *have);
+        map->pos += *have;
+        if (map->pos >= map->size)
+            state->eof = 1;
+        return 0;
+    }
+#ifdef HAVE_IO_URING
+    /* or from the buffers read ahead with io_uring */
+    if (state->uring != NULL)
+        return gz_uring_read(state, buf, len, have);
+#endif
+
+    *have = 0;
+    do {
+        ret = read(state->fd, buf + *have, len - *have);
+        if (ret <= 0)
+            break;
+        *have += (unsigned)ret;
+    } while (*have < len);
+    if (ret < 0) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    if (ret == 0)
+        state->eof = 1;
+    return 0;
+}
+
+/* Load up input buffer and set eof flag if last data loaded -- return -1 on
+   error, 0 otherwise.  Note that the eof flag is set when the end of the input
+   file is reached, even though there may be unused data in the buffer.  Once
+   that data has been used, no more attempts will be made to read the file.
+   If strm->avail_in != 0, then the current data is moved to the beginning of
+   the input buffer, and then the remainder of the buffer is loaded with the
+   available data from the input file.  If the input file is mapped, then the
+   input is instead taken in place from the mapping, where the unused input is
+   just before the current position. */
+static int gz_avail(gz_state *state) {
+    unsigned got;
+    PREFIX3(stream) *strm = &(state->strm);
+    gz_map *map = state->map;
+
+    if (state->err != Z_OK && state->err != Z_BUF_ERROR)
+        return -1;
+    if (state->eof == 0 && map != NULL) {
+        map->pos -= strm->avail_in;
+        strm->next_in = (z_const unsigned char *)map->data + map->pos;
+        strm->avail_in = map->pos >= map->size ? 0 :
+                         map->size - map->pos < (z_off64_t)state->size ? (unsigned)(map->size - map->pos) : state->size;
+        map->pos += strm->avail_in;
+        if (map->pos >= map->size)
+            state->eof = 1;
+    } else if (state->eof == 0) {
+        if (strm->avail_in) {       /* copy what's there to the start */
+            unsigned char *p = state->in;
+            unsigned const char *q = strm->next_in;
+            unsigned n = strm->avail_in;
+            do {
+                *p++ = *q++;
+            } while (--n);
+        }
+        if (gz_load(state, state->in + strm->avail_in, state->size - strm->avail_in, &got) == -1)
+            return -1;
+        strm->avail_in += got;
+        strm->next_in = state->in;
+    }
+    return 0;
+}
+
+/* Look for gzip header, set up for inflate or copy.  state->x.have must be 0.
+   If this is the first time in, allocate required memory.  state->how will be
+   left unchanged if there is no more input data available, will be set to COPY
+   if there is no gzip header and direct copying will be performed, or it will
+   be set to GZIP for decompression.  If direct copying, then leftover input
+   data from the input buffer will be copied to the output buffer.  In that
+   case, all further file reads will be directly to either the output buffer or
+   a user buffer.  If decompressing, the inflate state will be initialized.
+   gz_look() will return 0 on success or -1 on failure. */
+static int gz_look(gz_state *state) {
+    PREFIX3(stream) *strm = &(state->strm);
+
+    /* with read-ahead, the looking is done by the state of the thread */
+    if (state->ahead != NULL)
+        return gz_ahead_look(state);
+
+    /* allocate read buffers and inflate memory */
+    if (state->size == 0) {
+        /* allocate buffers */
+        state->in = (unsigned char *)zng_alloc(state->want);
+        state->out = (unsigned char *)zng_alloc(state->want << 1);
+        if (state->in == NULL || state->out == NULL) {
+            zng_free(state->out);
+            zng_free(state->in);
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return -1;
+        }
+        state->size = state->want;
+
+        /* allocate inflate memory */
+        state->strm.zalloc = NULL;
+        state->strm.zfree = NULL;
+        state->strm.opaque = NULL;
+        state->strm.avail_in = 0;
+        state->strm.next_in = NULL;
+        if (PREFIX(inflateInit2)(&(state->strm), MAX_WBITS + 16) != Z_OK) {    /* gunzip */
+            zng_free(state->out);
+            zng_free(state->in);
+            state->size = 0;
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return -1;
+        }
+#ifdef HAVE_IO_URING
+        if (state->uring != NULL)
+            gz_uring_start(state);
+#endif
+    }
+
+    /* get at least the magic bytes in the input buffer */
+    if (strm->avail_in < 2) {
+        if (gz_avail(state) == -1)
+            return -1;
+        if (strm->avail_in == 0)
+            return 0;
+    }
+
+    /* look for gzip magic bytes -- if there, do gzip decoding (note: there is
+       a logical dilemma here when considering the case of a partially written
+       gzip file, to wit, if a single 31 byte is written, then we cannot tell
+       whether this is a single-byte file, or just a partially written gzip
+       file -- for here we assume that if a gzip file is being written, then
+       the header will be written in a single operation, so that reading a
+       single byte is sufficient indication that it is not a gzip file) */
+    if (strm->avail_in > 1 &&
+            strm->next_in[0] == 31 && strm->next_in[1] == 139) {
+        PREFIX(inflateReset)(strm);
+        state->how = GZIP;
+        state->direct = 0;
+        if (state->bgzf != NULL)
+            return gz_bgzf_look(state);
+        return 0;
+    }
+
+    /* no gzip header -- if we were decoding gzip before, then this is trailing
+       garbage.  Ignore the trailing garbage and finish. */
+    if (state->direct == 0) {
+        strm->avail_in = 0;
+        state->eof = 1;
+        state->x.have = 0;
+        return 0;
+    }
+
+    /* doing raw i/o, copy any leftover input to output -- this assumes that
+       the output buffer is larger than the input buffer, which also assures
+       space for gzungetc() */
+    state->x.next = state->out;
+    memcpy(state->x.next, strm->next_in, strm->avail_in);
+    state->x.have = strm->avail_in;
+    strm->avail_in = 0;
+    state->how = COPY;
+    state->direct = 1;
+    return 0;
+}
+
+/* Get a little-endian 32-bit integer from buf */
+static unsigned gz_get32(const unsigned char *buf) {
+    return buf[0] | ((unsigned)buf[1] << 8) | ((unsigned)buf[2] << 16) | ((unsigned)buf[3] << 24);
+}
+
+/* Return the size of the BGZF member at buf, 0 if the len bytes there do not
+   start one, or -1 if more bytes are needed to tell. */
+static int gz_bgzf_size(const unsigned char *buf, unsigned len) {
+    unsigned xlen, pos, slen, size;
+
+    if (len < 12)
+        return -1;
+    if (buf[0] != 31 || buf[1] != 139 || buf[2] != 8 || (buf[3] & 4) == 0)
+        return 0;
+    xlen = buf[10] | ((unsigned)buf[11] << 8);
+    if (len < 12 + xlen)
+        return -1;
+
+    /* look for the "BC" subfield in the extra field */
+    for (pos = 12; pos + 4 <= 12 + xlen; pos += 4 + slen) {
+        slen = buf[pos + 2] | ((unsigned)buf[pos + 3] << 8);
+        if (buf[pos] == 'B' && buf[pos + 1] == 'C' && slen == 2 && pos + 6 <= 12 + xlen) {
+            size = (buf[pos + 4] | ((unsigned)buf[pos + 5] << 8)) + 1;
+            return size < 12 + xlen + 2 + BGZF_TRAILER ? 0 : (int)size;
+        }
+    }
+    return 0;
+}
+
+/* Return the offset of the first possible gzip header in buf from pos up to
+   len, or len if there is none. */
+static unsigned gz_next_header(const unsigned char *buf, unsigned pos, unsigned len) {
+    const unsigned char *next;
+
+    while (pos + 4 <= len) {
+        next = (const unsigned char *)memchr(buf + pos, 31, len - 3 - pos);
+        if (next == NULL)
+            break;
+        if (next[1] == 139 && next[2] == 8 && (next[3] & 0xe0) == 0)
+            return (unsigned)(next - buf);
+        pos = (unsigned)(next - buf) + 1;
+    }
+    return len;
+}
+
+/* Decode one member of the batch with strm. Return 0 if the member decoded to
+   exactly its expected size and used all of its input, otherwise -1. */
+static int gz_bgzf_inflate(gz_bgzf *bgzf, PREFIX3(stream) *strm, const gz_bgzf_member *member) {
+    int ret;
+
+    PREFIX(inflateReset)(strm);
+    strm->next_in = (z_const unsigned char *)member->next;
+    strm->avail_in = member->len;
+    strm->next_out = bgzf->dest + member->out;
+    strm->avail_out = member->size;
+    ret = PREFIX(inflate)(strm, Z_FINISH);
+    return ret == Z_STREAM_END && strm->avail_in == 0 && strm->avail_out == 0 ? 0 : -1;
+}
+
+/* Decode members of the batch with worker until there are none left to claim,
+   skipping those after a member that did not decode. Called with bgzf->lock
+   held. */
+static void gz_bgzf_work(gz_bgzf *bgzf, gz_bgzf_worker *worker) {
+    unsigned n;
+    int ret;
+
+    while (bgzf->claim < bgzf->count) {
+        n = bgzf->claim++;
+        ret = 0;
+        if (n < bgzf->fail) {
+            zthread_mutex_unlock(&bgzf->lock);
+            ret = gz_bgzf_inflate(bgzf, &worker->strm, &bgzf->member[n]);
+            zthread_mutex_lock(&bgzf->lock);
+        }
+        if (ret == -1 && n < bgzf->fail)
+            bgzf->fail = n;
+        if (++bgzf->finished == bgzf->count)
+            zthread_cond_signal(&bgzf->done);
+    }
+}
+
+/* Worker thread -- help decode each batch until told to stop */
+static void gz_bgzf_thread(void *arg) {
+    gz_bgzf_worker *worker = (gz_bgzf_worker *)arg;
+    gz_bgzf *bgzf = worker->bgzf;
+
+    zthread_mutex_lock(&bgzf->lock);
+    while (!bgzf->stop) {
+        if (bgzf->claim < bgzf->count)
+            gz_bgzf_work(bgzf, worker);
+        else
+            zthread_cond_wait(&bgzf->work, &bgzf->lock);
+    }
+    zthread_mutex_unlock(&bgzf->lock);
+}
+
+/* Set up an inflate stream for the next worker. Return 0 on success, -1 on
+   failure. */
+static int gz_bgzf_stream(gz_bgzf *bgzf) {
+    gz_bgzf_worker *worker = &bgzf->worker[bgzf->started];
+
+    worker->bgzf = bgzf;
+    worker->strm.zalloc = NULL;
+    worker->strm.zfree = NULL;
+    worker->strm.opaque = NULL;
+    worker->strm.avail_in = 0;
+    worker->strm.next_in = NULL;
+    return PREFIX(inflateInit2)(&(worker->strm), MAX_WBITS + 16) == Z_OK ? 0 : -1;
+}
+
+/* Set up for decoding BGZF members: allocate the batch buffers, enlarge the
+   output buffer to hold a whole batch, and set up the inflate stream of the
+   calling thread. The worker threads are only started once there is more
+   than one member to decode at a time. Return 0 on success, -1 on failure. */
+static int gz_bgzf_init(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+    unsigned threads, size;
+    unsigned char *out;
+
+    /* choose the number of threads */
+#ifdef HAVE_THREADS
+    threads = state->threads ? state->threads : zthread_cpu_count();
+    if (threads > BGZF_MAX_THREADS)
+        threads = BGZF_MAX_THREADS;
+#else
+    threads = 1;
+#endif
+
+    /* allocate the workers, with what they share */
+    bgzf->worker = (gz_bgzf_worker *)zng_alloc(threads * sizeof(gz_bgzf_worker));
+    if (bgzf->worker == NULL)
+        goto mem;
+    if (zthread_mutex_init(&bgzf->lock) != 0) {
+        zng_free(bgzf->worker);
+        bgzf->worker = NULL;
+        goto mem;
+    }
+    if (zthread_cond_init(&bgzf->work) != 0) {
+        zthread_mutex_destroy(&bgzf->lock);
+        zng_free(bgzf->worker);
+        bgzf->worker = NULL;
+        goto mem;
+    }
+    if (zthread_cond_init(&bgzf->done) != 0) {
+        zthread_cond_destroy(&bgzf->work);
+        zthread_mutex_destroy(&bgzf->lock);
+        zng_free(bgzf->worker);
+        bgzf->worker = NULL;
+        goto mem;
+    }
+    bgzf->workers = threads;
+    bgzf->started = 0;
+    bgzf->claim = bgzf->count = 0;
+    bgzf->stop = 0;
+    if (gz_bgzf_stream(bgzf) == -1)
+        goto mem;
+    bgzf->started = 1;
+
+    /* allocate a batch of input and of output -- the input buffer has to take
+       what is left in the input buffer of state as well */
+    if (bgzf->scan) {
+        bgzf->max_count = threads * PGZIP_BATCH;
+        bgzf->in_size = threads * PGZIP_IN;
+        size = threads * PGZIP_OUT;
+    } else {
+        bgzf->max_count = threads * BGZF_BATCH;
+        bgzf->in_size = bgzf->max_count * BGZF_MAX_SIZE;
+        size = bgzf->in_size;
+    }
+    if (bgzf->in_size < state->size)
+        bgzf->in_size = state->size;
+    bgzf->in = (unsigned char *)zng_alloc(bgzf->in_size);
+    bgzf->member = (gz_bgzf_member *)zng_alloc(bgzf->max_count * sizeof(gz_bgzf_member));
+    if (bgzf->in == NULL || bgzf->member == NULL)
+        goto mem;
+    bgzf->out_size = state->size << 1;
+    if (size > bgzf->out_size) {
+        out = (unsigned char *)zng_alloc(size);
+        if (out == NULL)
+            goto mem;
+        zng_free(state->out);
+        state->out = out;
+        bgzf->out_size = size;
+    }
+    return 0;
+
+  mem:
+    gz_error(state, Z_MEM_ERROR, "out of memory");
+    return -1;
+}
+
+/* Start the worker threads, stopping at the first one that cannot be started */
+static void gz_bgzf_start(gz_bgzf *bgzf) {
+    gz_bgzf_worker *worker;
+
+    while (bgzf->started < bgzf->workers) {
+        worker = &bgzf->worker[bgzf->started];
+        if (gz_bgzf_stream(bgzf) == -1) {
+            bgzf->workers = bgzf->started;
+            break;
+        }
+        if (zthread_create(&worker->thread, gz_bgzf_thread, worker) != 0) {
+            PREFIX(inflateEnd)(&(worker->strm));
+            bgzf->workers = bgzf->started;
+            break;
+        }
+        bgzf->started++;
+    }
+}
+
+/* Decode the count members found for the batch to state->out, with the
+   calling thread decoding alongside the worker threads. The batch is cut
+   short before the first member that did not decode, if any. Return the
+   number of members decoded. */
+static unsigned gz_bgzf_decode(gz_state *state, unsigned count) {
+    gz_bgzf *bgzf = state->bgzf;
+    unsigned fail;
+
+    if (count > 1)
+        gz_bgzf_start(bgzf);
+
+    zthread_mutex_lock(&bgzf->lock);
+    bgzf->dest = state->out;
+    bgzf->count = count;
+    bgzf->claim = 0;
+    bgzf->finished = 0;
+    bgzf->fail = count;
+    if (bgzf->started > 1)
+        zthread_cond_broadcast(&bgzf->work);
+    gz_bgzf_work(bgzf, &bgzf->worker[0]);
+    while (bgzf->finished < count)
+        zthread_cond_wait(&bgzf->done, &bgzf->lock);
+    fail = bgzf->fail;
+    bgzf->count = fail;
+    zthread_mutex_unlock(&bgzf->lock);
+    return fail;
+}
+
+/* Called by gz_look() on a gzip header when opened with "B" or "P". If the
+   gzip member is a BGZF member, or with "P" for any member, set up for
+   decoding members in parallel and set state->how to BGZF, otherwise leave
+   state->how as GZIP. Return 0 on success, -1 on failure. */
+static int gz_bgzf_look(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+    PREFIX3(stream) *strm = &(state->strm);
+
+    /* get enough of the header to tell */
+    if (strm->avail_in < BGZF_HEADER && gz_avail(state) == -1)
+        return -1;
+    if (!bgzf->scan && gz_bgzf_size(strm->next_in, strm->avail_in) <= 0)
+        return 0;
+
+    /* move the input to the batch buffer */
+    if (bgzf->worker == NULL && gz_bgzf_init(state) == -1)
+        return -1;
+    memmove(bgzf->in, strm->next_in, strm->avail_in);
+    strm->next_in = bgzf->in;
+    state->how = BGZF;
+    return 0;
+}
+
+/* Decompress from input to the provided next_out and avail_out in the state.
+   On return, state->x.have and state->x.next point to the just decompressed
+   data.  If the gzip stream completes, state->how is reset to LOOK to look for
+   the next gzip stream or raw data, once state->x.have is depleted.  Returns 0
+   on success, -1 on failure. */
+static int gz_decomp(gz_state *state) {
+    int ret = Z_OK;
+    unsigned had;
+    PREFIX3(stream) *strm = &(state->strm);
+
+    /* fill output buffer up to end of deflate stream */
+    had = strm->avail_out;
+    do {
+        /* get more input for inflate() */
+        if (strm->avail_in == 0 && gz_avail(state) == -1)
+            return -1;
+        if (strm->avail_in == 0) {
+            gz_error(state, Z_BUF_ERROR, "unexpected end of file");
+            break;
+        }
+
+        /* decompress and handle errors */
+        ret = PREFIX(inflate)(strm, Z_NO_FLUSH);
+        if (ret == Z_STREAM_ERROR || ret == Z_NEED_DICT) {
+            gz_error(state, Z_STREAM_ERROR, "internal error: inflate stream corrupt");
+            return -1;
+        }
+        if (ret == Z_MEM_ERROR) {
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return -1;
+        }
+        if (ret == Z_DATA_ERROR) {              /* deflate stream invalid */
+            gz_error(state, Z_DATA_ERROR, strm->msg == NULL ? "compressed data error" : strm->msg);
+            return -1;
+        }
+    } while (strm->avail_out && ret != Z_STREAM_END);
+
+    /* update available output */
+    state->x.have = had - strm->avail_out;
+    state->x.next = strm->next_out - state->x.have;
+
+    /* if the gzip stream completed successfully, look for another */
+    if (ret == Z_STREAM_END)
+        state->how = LOOK;
+
+    /* good decompression */
+    return 0;
+}
+
+/* Decode the next batch of BGZF members, or with "P" of any gzip members, to
+   the output buffer. The input left over is kept at strm->next_in and
+   strm->avail_in, so that the end of file checks and gzoffset() work as usual.
+   If the input does not continue with a member that can be decoded this way,
+   or if a member does not decode, then state->how is set to GZIP to decode the
+   next member as usual, which also reports any error in it. If there is no
+   gzip member, the rest of the input is ignored as trailing garbage. Returns 0
+   on success, -1 on failure. */
+static int gz_bgzf_fetch(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+    PREFIX3(stream) *strm = &(state->strm);
+    gz_bgzf_member *member;
+    unsigned have, got, pos, next, count, total, size, fail;
+    z_off64_t end;
+    int len;
+
+    /* move the input left over to the start of the buffer, and fill the rest */
+    have = strm->avail_in;
+    if (have && strm->next_in != bgzf->in)
+        memmove(bgzf->in, strm->next_in, have);
+    if (!state->eof && have < bgzf->in_size) {
+        if (gz_load(state, bgzf->in + have, bgzf->in_size - have, &got) == -1)
+            return -1;
+        have += got;
+    }
+    strm->next_in = bgzf->in;
+    strm->avail_in = have;
+
+    /* find the complete members, where their data goes in the output buffer,
+       and where they are in the file if it can be told */
+    end = gz_lseek(state, 0, SEEK_CUR);
+    pos = 0;
+    count = 0;
+    total = 0;
+    while (count < bgzf->max_count) {
+        len = gz_bgzf_size(bgzf->in + pos, have - pos);
+        if (len > 0) {
+            if ((unsigned)len > have - pos)
+                break;
+            next = pos + (unsigned)len;
+            size = gz_get32(bgzf->in + next - 4);
+            if (size > BGZF_MAX_SIZE)
+                break;
+        } else {
+            /* with "P", a gzip member ends where the next one starts, or at
+               the end of the file -- if it turns out not to, it is decoded as
+               usual */
+            if (len == -1 || !bgzf->scan || gz_next_header(bgzf->in, pos, pos + 4) != pos)
+                break;
+            next = gz_next_header(bgzf->in, pos + BGZF_HEADER, have);
+            if (next == have && !state->eof)
+                break;
+            size = gz_get32(bgzf->in + next - 4);
+        }
+        if (size > bgzf->out_size - total)
+            break;
+        member = &bgzf->member[count];
+        member->next = bgzf->in + pos;
+        member->len = next - pos;
+        member->size = size;
+        member->out = total;
+        member->coff = end == -1 ? -1 : end - have + pos;
+        total += size;
+        pos = next;
+        count++;
+    }
+
+    /* no more BGZF members -- decode a gzip member as usual if there is one,
+       otherwise this is the end, or trailing garbage which is ignored */
+    if (count == 0) {
+        if (have > 1 && bgzf->in[0] == 31 && bgzf->in[1] == 139) {
+            PREFIX(inflateReset)(strm);
+            state->how = GZIP;
+        } else {
+            strm->avail_in = 0;
+            state->eof = 1;
+        }
+        state->x.have = 0;
+        return 0;
+    }
+
+    /* decode the batch, and keep the members before any that did not decode */
+    fail = gz_bgzf_decode(state, count);
+    if (fail < count) {
+        pos = (unsigned)(bgzf->member[fail].next - bgzf->in);
+        total = bgzf->member[fail].out;
+        PREFIX(inflateReset)(strm);
+        state->how = GZIP;
+    }
+    strm->next_in = bgzf->in + pos;
+    strm->avail_in = have - pos;
+    bgzf->total = total;
+    state->x.next = state->out;
+    state->x.have = total;
+    return 0;
+}
+
+/* Take the error of the read-ahead state, if any, as the error of state.
+   Return -1 if it is a serious error, otherwise 0. */
+static int gz_ahead_error(gz_state *state, gz_state *inner) {
+    if (inner->err == Z_OK)
+        return 0;
+    gz_error(state, Z_OK, NULL);
+    state->err = inner->err;
+    state->msg = inner->msg;
+    inner->msg = NULL;
+    if (state->err != Z_BUF_ERROR) {
+        state->x.have = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/* Called by gz_look() when opened with "A". The first time, allocate the
+   buffers and set up the state that the read-ahead thread reads the file with.
+   Then look for a gzip header with that state, here and now so that gzdirect()
+   can tell, and set state->how to AHEAD. The thread is only started by the
+   first fetch. Return 0 on success, -1 on failure. */
+static int gz_ahead_look(gz_state *state) {
+    gz_ahead *ahead = state->ahead;
+    gz_state *inner;
+    unsigned n;
+    int ok, ret;
+
+    if (ahead->inner == NULL) {
+        /* the output buffer of state is only used by gzungetc() */
+        ahead->size = state->want << 1;
+        state->in = NULL;
+        state->out = (unsigned char *)zng_alloc(ahead->size);
+        inner = (gz_state *)zng_alloc(sizeof(gz_state));
+        ok = state->out != NULL && inner != NULL;
+        for (n = 0; n < GZ_AHEAD_SLOTS; n++) {
+            ahead->buf[n] = (unsigned char *)zng_alloc(ahead->size);
+            ok = ok && ahead->buf[n] != NULL;
+        }
+        if (ok && zthread_mutex_init(&ahead->lock) == 0) {
+            if (zthread_cond_init(&ahead->ready) == 0) {
+                if (zthread_cond_init(&ahead->room) == 0)
+                    ok = 2;
+                else
+                    zthread_cond_destroy(&ahead->ready);
+            }
+            if (ok != 2)
+                zthread_mutex_destroy(&ahead->lock);
+        }
+        if (ok != 2) {
+            for (n = 0; n < GZ_AHEAD_SLOTS; n++) {
+                zng_free(ahead->buf[n]);
+                ahead->buf[n] = NULL;
+            }
+            zng_free(inner);
+            zng_free(state->out);
+            state->out = NULL;
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return -1;
+        }
+        state->size = state->want;
+
+        /* the thread reads with a copy of state, which takes over any BGZF
+           state */
+        memcpy(inner, state, sizeof(gz_state));
+        inner->ahead = NULL;
+        inner->size = 0;
+        inner->in = NULL;
+        inner->out = NULL;
+        inner->msg = NULL;
+        inner->err = Z_OK;
+        inner->seek = 0;
+        state->bgzf = NULL;
+        ahead->inner = inner;
+    }
+
+    /* look for a gzip header with the read-ahead state */
+    inner = ahead->inner;
+    ret = gz_look(inner);
+    state->uring = inner->uring;    /* in case io_uring was given up */
+    if (ret == -1) {
+        gz_ahead_error(state, inner);
+        return -1;
+    }
+    state->direct = inner->direct;
+    state->how = AHEAD;
+    return 0;
+}
+
+/* Fill the next free buffer by reading with the read-ahead state. Called with
+   ahead->lock held. */
+static void gz_ahead_fill(gz_ahead *ahead) {
+    gz_state *inner = ahead->inner;
+    unsigned slot;
+    size_t got;
+    int end;
+
+    slot = (ahead->next + ahead->count) % GZ_AHEAD_SLOTS;
+    zthread_mutex_unlock(&ahead->lock);
+    got = gz_read(inner, ahead->buf[slot], ahead->size);
+    end = got == 0 || (inner->err != Z_OK && inner->err != Z_BUF_ERROR);
+    zthread_mutex_lock(&ahead->lock);
+    ahead->have[slot] = (unsigned)got;
+    if (got)
+        ahead->count++;
+    ahead->end = end;
+}
+
+/* Read-ahead thread -- fill the free buffers until the end of the data or an
+   error, then wait to go on or to stop */
+static void gz_ahead_thread(void *arg) {
+    gz_ahead *ahead = (gz_ahead *)arg;
+
+    zthread_mutex_lock(&ahead->lock);
+    while (!ahead->stop) {
+        if (ahead->count < GZ_AHEAD_SLOTS && !ahead->end) {
+            gz_ahead_fill(ahead);
+            zthread_cond_signal(&ahead->ready);
+        } else
+            zthread_cond_wait(&ahead->room, &ahead->lock);
+    }
+    zthread_mutex_unlock(&ahead->lock);
+}
+
+/* Give back the buffer that was read and make the next filled buffer the
+   output data of state, waiting for the thread to fill it if needed. The
+   first fetch starts the thread, and if it cannot be started, the buffers
+   are filled here instead. After the end of the data was returned, set
+   state->eof, and only try to get more data again after gzclearerr().
+   Returns -1 on error, otherwise 0. */
+static int gz_ahead_fetch(gz_state *state) {
+    gz_ahead *ahead = state->ahead;
+
+    if (!ahead->started && !ahead->alone) {
+        if (zthread_create(&ahead->thread, gz_ahead_thread, ahead) == 0)
+            ahead->started = 1;
+        else
+            ahead->alone = 1;
+    }
+
+    zthread_mutex_lock(&ahead->lock);
+    if (ahead->held) {
+        ahead->held = 0;
+        ahead->next = (ahead->next + 1) % GZ_AHEAD_SLOTS;
+        ahead->count--;
+        zthread_cond_signal(&ahead->room);
+    }
+    if (ahead->seen) {
+        if (state->eof) {
+            zthread_mutex_unlock(&ahead->lock);
+            state->x.have = 0;
+            return 0;
+        }
+
+        /* gzclearerr() was called -- see if there is more now */
+        ahead->seen = 0;
+        ahead->end = 0;
+        ahead->inner->eof = 0;
+        ahead->inner->past = 0;
+        if (ahead->inner->err == Z_BUF_ERROR)
+            gz_error(ahead->inner, Z_OK, NULL);
+        zthread_cond_signal(&ahead->room);
+    }
+    while (ahead->count == 0 && !ahead->end) {
+        if (ahead->alone)
+            gz_ahead_fill(ahead);
+        else
+            zthread_cond_wait(&ahead->ready, &ahead->lock);
+    }
+
+    /* hand out the next buffer */
+    if (ahead->count) {
+        ahead->held = 1;
+        state->x.next = ahead->buf[ahead->next];
+        state->x.have = ahead->have[ahead->next];
+        zthread_mutex_unlock(&ahead->lock);
+        return 0;
+    }
+
+    /* end of the data, or an error */
+    ahead->seen = 1;
+    state->eof = 1;
+    state->x.have = 0;
+    if (gz_ahead_error(state, ahead->inner) == -1) {
+        zthread_mutex_unlock(&ahead->lock);
+        return -1;
+    }
+    zthread_mutex_unlock(&ahead->lock);
+    return 0;
+}
+
+/* Stop the read-ahead thread, and drop the data it read ahead. */
+void Z_INTERNAL gz_ahead_stop(gz_state *state) {
+    gz_ahead *ahead = state->ahead;
+
+    if (ahead->started) {
+        zthread_mutex_lock(&ahead->lock);
+        ahead->stop = 1;
+        zthread_cond_signal(&ahead->room);
+        zthread_mutex_unlock(&ahead->lock);
+        zthread_join(&ahead->thread);
+        ahead->started = 0;
+    }
+    ahead->stop = 0;
+    ahead->held = 0;
+    ahead->seen = 0;
+    ahead->next = 0;
+    ahead->count = 0;
+    ahead->end = 0;
+}
+
+/* Fetch data and put it in the output buffer.  Assumes state->x.have is 0.
+   Data is either copied from the input file or decompressed from the input
+   file depending on state->how.  If state->how is LOOK, then a gzip header is
+   looked for to determine whether to copy or decompress.  Returns -1 on error,
+   otherwise 0.  gz_fetch() will leave state->how as COPY or GZIP unless the
+   end of the input file has been reached and all data has been processed.  */
+static int gz_fetch(gz_state *state) {
+    PREFIX3(stream) *strm = &(state->strm);
+
+    do {
+        switch (state->how) {
+        case LOOK:      /* -> LOOK, COPY (only if never GZIP), or GZIP */
+            if (gz_look(state) == -1)
+                return -1;
+            if (state->how == LOOK)
+                return 0;
+            break;
+        case COPY:      /* -> COPY */
+            if (gz_load(state, state->out, state->size << 1, &(state->x.have))
+                    == -1)
+                return -1;
+            state->x.next = state->out;
+            return 0;
+        case GZIP:      /* -> GZIP or LOOK (if end of gzip stream) */
+            strm->avail_out = state->size << 1;
+            strm->next_out = state->out;
+            if (gz_decomp(state) == -1)
+                return -1;
+            break;
+        case BGZF:      /* -> BGZF, or GZIP (if not a BGZF member) */
+            if (gz_bgzf_fetch(state) == -1)
+                return -1;
+            break;
+        case AHEAD:     /* -> AHEAD */
+            if (gz_ahead_fetch(state) == -1)
+                return -1;
+        }
+    } while (state->x.have == 0 && (!state->eof || strm->avail_in));
+    return 0;
+}
+
+/* With an index of have entries, from a .gzi file for BGZF or at the end of a
+   seekable file, go straight to the last member that starts at or before the
+   position len bytes ahead, if that is past the data in the output buffer,
+   and update len to what is left to skip from there. Return -1 on error, 0 on
+   success. */
+static int gz_jump(gz_state *state, const gz_bgzf_entry *index, size_t have, z_off64_t *len) {
+    const gz_bgzf_entry *entry;
+    z_off64_t target;
+    size_t lo, hi, mid;
+
+    /* find the last member that starts at or before the target */
+    target = state->x.pos + *len;
+    lo = 0;
+    hi = have;
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        if (index[mid].uoff <= (uint64_t)target)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return 0;
+    entry = &index[lo - 1];
+    if (entry->uoff <= (uint64_t)(state->x.pos + state->x.have))
+        return 0;
+
+    /* go there and look for the member */
+    if (gz_lseek(state, (z_off64_t)entry->coff, SEEK_SET) == -1) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    state->x.have = 0;
+    state->eof = 0;
+    state->past = 0;
+    state->how = LOOK;
+    state->strm.avail_in = 0;
+    state->x.pos = (z_off64_t)entry->uoff;
+    *len = target - state->x.pos;
+    return 0;
+}
+
+/* Skip len uncompressed bytes of output.  Return -1 on error, 0 on success. */
+static int gz_skip(gz_state *state, z_off64_t len) {
+    unsigned n;
+
+    /* with an index, skip whole members without decoding them */
+    if (state->index_look && gz_index_find(state) == -1)
+        return -1;
+    if (state->bgzf != NULL && state->bgzf->index_have) {
+        if (gz_jump(state, state->bgzf->index, state->bgzf->index_have, &len) == -1)
+            return -1;
+    } else if (state->index_have && gz_jump(state, state->index, state->index_have, &len) == -1)
+        return -1;
+
+    /* skip over len bytes or reach end-of-file, whichever comes first */
+    while (len)
+        /* skip over whatever is in output buffer */
+        if (state->x.have) {
+            n = GT_OFF(state->x.have) || (z_off64_t)state->x.have > len ?
+                (unsigned)len : state->x.have;
+            state->x.have -= n;
+            state->x.next += n;
+            state->x.pos += n;
+            len -= n;
+        } else if (state->eof && state->strm.avail_in == 0) {
+            /* output buffer empty -- return if we're at the end of the input */
+            break;
+        } else {
+            /* need more data to skip -- load up output buffer */
+            /* get more output, looking for header if required */
+            if (gz_fetch(state) == -1)
+                return -1;
+        }
+    return 0;
+}
+
+/* Read len bytes into buf from file, or less than len up to the end of the
+   input.  Return the number of bytes read.  If zero is returned, either the
+   end of file was reached, or there was an error.  state->err must be
+   consulted in that case to determine which. */
+static size_t gz_read(gz_state *state, void *buf, size_t len) {
+    size_t got;
+    unsigned n;
+
+    /* if len is zero, avoid unnecessary operations */
+    if (len == 0)
+        return 0;
+
+    /* process a skip request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_skip(state, state->skip) == -1)
+            return 0;
+    }
+
+    /* get len bytes to buf, or less than len if at the end */
+    got = 0;
+    do {
+        /* set n to the maximum amount of len that fits in an unsigned int */
+        n = (unsigned)-1;
+        if (n > len)
+            n = (unsigned)len;
+
+        /* first just try copying data from the output buffer */
+        if (state->x.have) {
+            if (state->x.have < n)
+                n = state->x.have;
+            memcpy(buf, state->x.next, n);
+            state->x.next += n;
+            state->x.have -= n;
+        }
+
+        /* output buffer empty -- return if we're at the end of the input */
+        else if (state->eof && state->strm.avail_in == 0) {
+            state->past = 1;        /* tried to read past end */
+            break;
+        }
+
+        /* need output data -- for small len or new stream load up our output
+           buffer */
+        else if (state->how == LOOK || state->how >= BGZF || n < (state->size << 1)) {
+            /* get more output, looking for header if required */
+            if (gz_fetch(state) == -1)
+                return 0;
+            continue;       /* no progress yet -- go back to copy above */
+            /* the copy above assures that we will leave with space in the
+               output buffer, allowing at least one gzungetc() to succeed */
+        }
+
+        /* large len -- read directly into user buffer */
+        else if (state->how == COPY) {      /* read directly */
+            if (gz_load(state, (unsigned char *)buf, n, &n) == -1)
+                return 0;
+        }
+
+        /* large len -- decompress directly into user buffer */
+        else {  /* state->how == GZIP */
+            state->strm.avail_out = n;
+            state->strm.next_out = (unsigned char *)buf;
+            if (gz_decomp(state) == -1)
+                return 0;
+            n = state->x.have;
+            state->x.have = 0;
+        }
+
+        /* update progress */
+        len -= n;
+        buf = (char *)buf + n;
+        got += n;
+        state->x.pos += n;
+    } while (len);
+
+    /* return number of bytes read into user buffer */
+    return got;
+}
+
+/* -- see zlib.h -- */
+int Z_EXPORT PREFIX(gzread)(gzFile file, void *buf, unsigned len) {
+    gz_state *state;
+
+    /* get internal structure */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ ||
+            (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return -1;
+
+    /* since an int is returned, make sure len fits in one, otherwise return
+       with an error (this avoids a flaw in the interface) */
+    if ((int)len < 0) {
+        gz_error(state, Z_STREAM_ERROR, "request does not fit in an int");
+        return -1;
+    }
+
+    /* read len or fewer bytes to buf */
+    len = (unsigned)gz_read(state, buf, len);
+
+    /* check for an error */
+    if (len == 0 && state->err != Z_OK && state->err != Z_BUF_ERROR)
+        return -1;
+
+    /* return the number of bytes read (this is assured to fit in an int) */
+    return (int)len;
+}
+
+/* -- see zlib.h -- */
+size_t Z_EXPORT PREFIX(gzfread)(void *buf, size_t size, size_t nitems, gzFile file) {
+    size_t len;
+    gz_state *state;
+
+    /* Exit early if size is zero, also prevents potential division by zero */
+    if (size == 0)
+        return 0;
+
+    /* get internal structure */
+    if (file == NULL)
+        return 0;
+    state = (gz_state *)file;
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ ||
+            (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return 0;
+
+    /* compute bytes to read -- error on overflow */
+    if (size && SIZE_MAX / size < nitems) {
+        gz_error(state, Z_STREAM_ERROR, "request does not fit in a size_t");
+        return 0;
+    }
+    len = nitems * size;
+
+    /* read len or fewer bytes to buf, return the number of full items read */
+    return len ? gz_read(state, buf, len) / size : 0;
+}
+
+/* -- see zlib.h -- */
+#undef gzgetc
+#undef zng_gzgetc
+int Z_EXPORT PREFIX(gzgetc)(gzFile file) {
+    unsigned char buf[1];
+    gz_state *state;
+
+    /* get internal structure */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ || (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return -1;
+
+    /* try output buffer (no need to check for skip request) */
+    if (state->x.have) {
+        state->x.have--;
+        state->x.pos++;
+        return *(state->x.next)++;
+    }
+
+    /* nothing there -- try gz_read() */
+    return gz_read(state, buf, 1) < 1 ? -1 : buf[0];
+}
+
+#ifdef ZLIB_COMPAT
+int Z_EXPORT PREFIX(gzgetc_)(gzFile file) {
+    return PREFIX(gzgetc)(file);
+}
+#endif
+
+/* Return the size of the output buffer, which holds a whole batch when reading
+   BGZF members or with "P" */
+static unsigned gz_out_size(gz_state *state) {
+    if (state->bgzf != NULL && state->bgzf->out_size > (state->size << 1))
+        return state->bgzf->out_size;
+    return state->size << 1;
+}
+
+/* -- see zlib.h -- */
+int Z_EXPORT PREFIX(gzungetc)(int c, gzFile file) {
+    gz_state *state;
+    unsigned size;
+
+    /* get internal structure */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+
+    /* in case this was just opened, set up the input buffer */
+    if (state->mode == GZ_READ && state->how == LOOK && state->x.have == 0)
+        (void)gz_look(state);
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ || (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return -1;
+
+    /* process a skip request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_skip(state, state->skip) == -1)
+            return -1;
+    }
+
+    /* can't push EOF */
+    if (c < 0)
+        return -1;
+
+    /* if output buffer empty, put byte at end (allows more pushing) */
+    size = gz_out_size(state);
+    if (state->x.have == 0) {
+        state->x.have = 1;
+        state->x.next = state->out + size - 1;
+        state->x.next[0] = (unsigned char)c;
+        state->x.pos--;
+        state->past = 0;
+        return c;
+    }
+
+    /* if no room, give up (must have already done a gzungetc()) */
+    if (state->x.have >= size) {
+        gz_error(state, Z_DATA_ERROR, "out of room to push characters");
+        return -1;
+    }
+
+    /* move read-ahead data to the end of the output buffer to make room */
+    if (state->x.next < state->out || state->x.next >= state->out + size) {
+        memcpy(state->out + size - state->x.have, state->x.next, state->x.have);
+        state->x.next = state->out + size - state->x.have;
+    }
+
+    /* slide output data if needed and insert byte before existing data */
+    if (state->x.next == state->out) {
+        unsigned char *src = state->out + state->x.have;
+        unsigned char *dest = state->out + size;
+        while (src > state->out)
+            *--dest = *--src;
+        state->x.next = dest;
+    }
+    state->x.have++;
+    state->x.next--;
+    state->x.next[0] = (unsigned char)c;
+    state->x.pos--;
+    state->past = 0;
+    return c;
+}
+
+/* -- see zlib.h -- */
+char * Z_EXPORT PREFIX(gzgets)(gzFile file, char *buf, int len) {
+    unsigned left, n;
+    char *str;
+    unsigned char *eol;
+    gz_state *state;
+
+    /* check parameters and get internal structure */
+    if (file == NULL || buf == NULL || len < 1)
+        return NULL;
+    state = (gz_state *)file;
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ || (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return NULL;
+
+    /* process a skip request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_skip(state, state->skip) == -1)
+            return NULL;
+    }
+
+    /* copy output bytes up to new line or len - 1, whichever comes first --
+       append a terminating zero to the string (we don't check for a zero in
+       the contents, let the user worry about that) */
+    str = buf;
+    left = (unsigned)len - 1;
+    if (left) {
+        do {
+            /* assure that something is in the output buffer */
+            if (state->x.have == 0 && gz_fetch(state) == -1)
+                return NULL;                /* error */
+            if (state->x.have == 0) {       /* end of file */
+                state->past = 1;            /* read past end */
+                break;                      /* return what we have */
+            }
+
+            /* look for end-of-line in current output buffer */
+            n = state->x.have > left ? left : state->x.have;
+            eol = (unsigned char *)memchr(state->x.next, '\n', n);
+            if (eol != NULL)
+                n = (unsigned)(eol - state->x.next) + 1;
+
+            /* copy through end-of-line, or remainder if not found */
+            memcpy(buf, state->x.next, n);
+            state->x.have -= n;
+            state->x.next += n;
+            state->x.pos += n;
+            left -= n;
+            buf += n;
+        } while (left && eol == NULL);
+    }
+
+    /* return terminated string, or if nothing, end of file */
+    if (buf == str)
+        return NULL;
+    buf[0] = 0;
+    return str;
+}
+
+#ifndef ZLIB_COMPAT
+/* -- see zlib-ng.h -- */
+const char * Z_EXPORT PREFIX(gzgetline_view)(gzFile file, size_t *len) {
+    unsigned char *eol, *line, *grown;
+    size_t have, want;
+    gz_state *state;
+    unsigned n;
+
+    /* check parameters and get internal structure */
+    if (file == NULL || len == NULL)
+        return NULL;
+    *len = 0;
+    state = (gz_state *)file;
+
+    /* check that we're reading and that there's no (serious) error */
+    if (state->mode != GZ_READ || (state->err != Z_OK && state->err != Z_BUF_ERROR))
+        return NULL;
+
+    /* process a skip request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_skip(state, state->skip) == -1)
+            return NULL;
+    }
+
+    /* return a line that is all in the output buffer in place, otherwise
+       gather the pieces of it in state->line */
+    have = 0;
+    do {
+        /* assure that something is in the output buffer */
+        if (state->x.have == 0 && gz_fetch(state) == -1)
+            return NULL;                /* error */
+        if (state->x.have == 0) {       /* end of file */
+            state->past = 1;            /* read past end */
+            break;                      /* return what we have */
+        }
+
+        /* look for end-of-line in current output buffer */
+        eol = (unsigned char *)memchr(state->x.next, '\n', state->x.have);
+        n = eol == NULL ? state->x.have : (unsigned)(eol - state->x.next) + 1;
+        line = state->x.next;
+        state->x.have -= n;
+        state->x.next += n;
+        state->x.pos += n;
+        if (have == 0 && eol != NULL) {
+            *len = n;
+            return (const char *)line;
+        }
+
+        /* append the piece to what was gathered so far */
+        if (have + n > state->line_size) {
+            want = state->line_size < 4096 ? 4096 : state->line_size;
+            while (want < have + n)
+                want <<= 1;
+            grown = (unsigned char *)zng_alloc(want);
+            if (grown == NULL) {
+                gz_error(state, Z_MEM_ERROR, "out of memory");
+                return NULL;
+            }
+            if (have)
+                memcpy(grown, state->line, have);
+            zng_free(state->line);
+            state->line = grown;
+            state->line_size = want;
+        }
+        memcpy(state->line + have, line, n);
+        have += n;
+    } while (eol == NULL);
+
+    /* return the gathered line, or if nothing, end of file */
+    if (have == 0)
+        return NULL;
+    *len = have;
+    return (const char *)state->line;
+}
+#endif
+
+/* -- see zlib.h -- */
+int Z_EXPORT PREFIX(gzdirect)(gzFile file) {
+    gz_state *state;
+
+    /* get internal structure */
+    if (file == NULL)
+        return 0;
+
+    state = (gz_state *)file;
+
+    /* if the state is not known, but we can find out, then do so (this is
+       mainly for right after a gzopen() or gzdopen()) */
+    if (state->mode == GZ_READ && state->how == LOOK && state->x.have == 0)
+        (void)gz_look(state);
+
+    /* return 1 if transparent, 0 if processing a gzip stream */
+    return state->direct;
+}
+
+/* -- see zlib.h -- */
+int Z_EXPORT PREFIX(gzclose_r)(gzFile file) {
+    int ret, err;
+    gz_state *state;
+
+    /* get internal structure */
+    if (file == NULL)
+        return Z_STREAM_ERROR;
+
+    state = (gz_state *)file;
+
+    /* check that we're reading */
+    if (state->mode != GZ_READ)
+        return Z_STREAM_ERROR;
+
+    /* free memory and close file */
+    if (state->ahead != NULL)
+        gz_ahead_end(state);
+    if (state->bgzf != NULL)
+        gz_bgzf_end(state);
+    gz_map_free(state);
+#ifdef HAVE_IO_URING
+    gz_uring_free(state);
+#endif
+    zng_free(state->line);
+    zng_free(state->index);
+    if (state->size) {
+        PREFIX(inflateEnd)(&(state->strm));
+        zng_free(state->out);
+        zng_free(state->in);
+    }
+    err = state->err == Z_BUF_ERROR ? Z_BUF_ERROR : Z_OK;
+    gz_error(state, Z_OK, NULL);
+    free(state->path);
+    ret = state->fd == -1 ? 0 : close(state->fd);
+    zng_free(state);
+    return ret ? Z_ERRNO : err;
+}
+
+/* Return the BGZF virtual offset of the next byte to read: the offset of its
+   member in the file shifted up 16 bits, plus its offset in the member's data,
+   or -1 if it is not known. */
+z_off64_t Z_INTERNAL gz_bgzf_tell_r(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+    gz_bgzf_member *member;
+    unsigned used, lo, hi, mid;
+    z_off64_t offset;
+
+    /* check that there's no (serious) error */
+    if (state->err != Z_OK && state->err != Z_BUF_ERROR)
+        return -1;
+
+    /* process a skip request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_skip(state, state->skip) == -1)
+            return -1;
+    }
+
+    /* between members, this is the offset of the next member */
+    if (state->x.have == 0 && (state->how == LOOK || state->how == BGZF)) {
+        offset = gz_lseek(state, 0, SEEK_CUR);
+        return offset == -1 ? -1 : (offset - (z_off64_t)state->strm.avail_in) << 16;
+    }
+
+    /* otherwise find the member in the batch that the next byte is from */
+    if (state->how != BGZF || state->x.next < state->out || state->x.next >= state->out + bgzf->total)
+        return -1;
+    used = (unsigned)(state->x.next - state->out);
+    lo = 0;
+    hi = bgzf->count;
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        if (bgzf->member[mid].out + bgzf->member[mid].size <= used)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    member = &bgzf->member[lo];
+    if (member->coff == -1 || used - member->out > 0xffff)
+        return -1;
+    return (member->coff << 16) | (used - member->out);
+}
+
+/* Stop the worker threads and free the BGZF state */
+static void gz_bgzf_end(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+    unsigned n;
+
+    if (bgzf->worker != NULL) {
+        zthread_mutex_lock(&bgzf->lock);
+        bgzf->stop = 1;
+        zthread_cond_broadcast(&bgzf->work);
+        zthread_mutex_unlock(&bgzf->lock);
+        for (n = 1; n < bgzf->started; n++)
+            zthread_join(&(bgzf->worker[n].thread));
+        for (n = 0; n < bgzf->started; n++)
+            PREFIX(inflateEnd)(&(bgzf->worker[n].strm));
+        zthread_cond_destroy(&bgzf->done);
+        zthread_cond_destroy(&bgzf->work);
+        zthread_mutex_destroy(&bgzf->lock);
+        zng_free(bgzf->worker);
+    }
+    zng_free(bgzf->member);
+    zng_free(bgzf->in);
+    gz_bgzf_free(state);
+}
+
+/* Stop the read-ahead thread and free the read-ahead state, with the state it
+   read with */
+static void gz_ahead_end(gz_state *state) {
+    gz_ahead *ahead = state->ahead;
+    gz_state *inner = ahead->inner;
+    unsigned n;
+
+    if (inner != NULL) {
+        gz_ahead_stop(state);
+        zthread_cond_destroy(&ahead->room);
+        zthread_cond_destroy(&ahead->ready);
+        zthread_mutex_destroy(&ahead->lock);
+        for (n = 0; n < GZ_AHEAD_SLOTS; n++)
+            zng_free(ahead->buf[n]);
+        if (inner->bgzf != NULL)
+            gz_bgzf_end(inner);
+        if (inner->size) {
+            PREFIX(inflateEnd)(&(inner->strm));
+            zng_free(inner->out);
+            zng_free(inner->in);
+        }
+        gz_error(inner, Z_OK, NULL);
+        zng_free(inner);
+        zng_free(state->out);
+        state->size = 0;
+    }
+    zng_free(ahead);
+    state->ahead = NULL;
+}
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../example"
+  "../example.pdb"
+  "CMakeFiles/example.dir/example.c.o"
+  "CMakeFiles/example.dir/example.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
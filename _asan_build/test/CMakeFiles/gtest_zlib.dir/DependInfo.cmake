@@ -0,0 +1,70 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/test_adler32.cc" "test/CMakeFiles/gtest_zlib.dir/test_adler32.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_adler32.cc.o.d"
+  "/root/repo/test/test_allocator.cc" "test/CMakeFiles/gtest_zlib.dir/test_allocator.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_allocator.cc.o.d"
+  "/root/repo/test/test_checksum_multi.cc" "test/CMakeFiles/gtest_zlib.dir/test_checksum_multi.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_checksum_multi.cc.o.d"
+  "/root/repo/test/test_checksum_parallel.cc" "test/CMakeFiles/gtest_zlib.dir/test_checksum_parallel.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_checksum_parallel.cc.o.d"
+  "/root/repo/test/test_compare256.cc" "test/CMakeFiles/gtest_zlib.dir/test_compare256.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_compare256.cc.o.d"
+  "/root/repo/test/test_compare256_rle.cc" "test/CMakeFiles/gtest_zlib.dir/test_compare256_rle.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_compare256_rle.cc.o.d"
+  "/root/repo/test/test_compress.cc" "test/CMakeFiles/gtest_zlib.dir/test_compress.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_compress.cc.o.d"
+  "/root/repo/test/test_compress_bound.cc" "test/CMakeFiles/gtest_zlib.dir/test_compress_bound.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_compress_bound.cc.o.d"
+  "/root/repo/test/test_crc32.cc" "test/CMakeFiles/gtest_zlib.dir/test_crc32.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_crc32.cc.o.d"
+  "/root/repo/test/test_crc32c.cc" "test/CMakeFiles/gtest_zlib.dir/test_crc32c.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_crc32c.cc.o.d"
+  "/root/repo/test/test_crc64.cc" "test/CMakeFiles/gtest_zlib.dir/test_crc64.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_crc64.cc.o.d"
+  "/root/repo/test/test_cve-2003-0107.cc" "test/CMakeFiles/gtest_zlib.dir/test_cve-2003-0107.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_cve-2003-0107.cc.o.d"
+  "/root/repo/test/test_deflate_alloc.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_alloc.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_alloc.cc.o.d"
+  "/root/repo/test/test_deflate_bound.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_bound.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_bound.cc.o.d"
+  "/root/repo/test/test_deflate_concurrency.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_concurrency.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_concurrency.cc.o.d"
+  "/root/repo/test/test_deflate_copy.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_copy.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_copy.cc.o.d"
+  "/root/repo/test/test_deflate_dict.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_dict.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_dict.cc.o.d"
+  "/root/repo/test/test_deflate_direct_output.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_direct_output.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_direct_output.cc.o.d"
+  "/root/repo/test/test_deflate_hash_head_0.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_hash_head_0.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_hash_head_0.cc.o.d"
+  "/root/repo/test/test_deflate_header.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_header.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_header.cc.o.d"
+  "/root/repo/test/test_deflate_lit_mem.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_lit_mem.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_lit_mem.cc.o.d"
+  "/root/repo/test/test_deflate_params.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_params.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_params.cc.o.d"
+  "/root/repo/test/test_deflate_pending.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_pending.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_pending.cc.o.d"
+  "/root/repo/test/test_deflate_prime.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_prime.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_prime.cc.o.d"
+  "/root/repo/test/test_deflate_quick_bi_valid.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_quick_bi_valid.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_quick_bi_valid.cc.o.d"
+  "/root/repo/test/test_deflate_quick_block_open.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_quick_block_open.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_quick_block_open.cc.o.d"
+  "/root/repo/test/test_deflate_rsyncable.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_rsyncable.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_rsyncable.cc.o.d"
+  "/root/repo/test/test_deflate_tune.cc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_tune.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_deflate_tune.cc.o.d"
+  "/root/repo/test/test_dict.cc" "test/CMakeFiles/gtest_zlib.dir/test_dict.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_dict.cc.o.d"
+  "/root/repo/test/test_gzio.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio.cc.o.d"
+  "/root/repo/test/test_gzio_ahead.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_ahead.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_ahead.cc.o.d"
+  "/root/repo/test/test_gzio_append.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_append.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_append.cc.o.d"
+  "/root/repo/test/test_gzio_bgzf.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_bgzf.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_bgzf.cc.o.d"
+  "/root/repo/test/test_gzio_getline.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_getline.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_getline.cc.o.d"
+  "/root/repo/test/test_gzio_mem.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_mem.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_mem.cc.o.d"
+  "/root/repo/test/test_gzio_mmap.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_mmap.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_mmap.cc.o.d"
+  "/root/repo/test/test_gzio_parallel.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_parallel.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_parallel.cc.o.d"
+  "/root/repo/test/test_gzio_seekable.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_seekable.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_seekable.cc.o.d"
+  "/root/repo/test/test_gzio_uring.cc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_uring.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_gzio_uring.cc.o.d"
+  "/root/repo/test/test_hibernate.cc" "test/CMakeFiles/gtest_zlib.dir/test_hibernate.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_hibernate.cc.o.d"
+  "/root/repo/test/test_inflate_adler32.cc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_adler32.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_adler32.cc.o.d"
+  "/root/repo/test/test_inflate_copy.cc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_copy.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_copy.cc.o.d"
+  "/root/repo/test/test_inflate_sync.cc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_sync.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_inflate_sync.cc.o.d"
+  "/root/repo/test/test_insert_string.cc" "test/CMakeFiles/gtest_zlib.dir/test_insert_string.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_insert_string.cc.o.d"
+  "/root/repo/test/test_large_buffers.cc" "test/CMakeFiles/gtest_zlib.dir/test_large_buffers.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_large_buffers.cc.o.d"
+  "/root/repo/test/test_main.cc" "test/CMakeFiles/gtest_zlib.dir/test_main.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_main.cc.o.d"
+  "/root/repo/test/test_raw.cc" "test/CMakeFiles/gtest_zlib.dir/test_raw.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_raw.cc.o.d"
+  "/root/repo/test/test_small_buffers.cc" "test/CMakeFiles/gtest_zlib.dir/test_small_buffers.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_small_buffers.cc.o.d"
+  "/root/repo/test/test_small_window.cc" "test/CMakeFiles/gtest_zlib.dir/test_small_window.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_small_window.cc.o.d"
+  "/root/repo/test/test_source_size.cc" "test/CMakeFiles/gtest_zlib.dir/test_source_size.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_source_size.cc.o.d"
+  "/root/repo/test/test_version.cc" "test/CMakeFiles/gtest_zlib.dir/test_version.cc.o" "gcc" "test/CMakeFiles/gtest_zlib.dir/test_version.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,111 @@
+file(REMOVE_RECURSE
+  "../gtest_zlib"
+  "../gtest_zlib.pdb"
+  "CMakeFiles/gtest_zlib.dir/test_adler32.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_adler32.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_allocator.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_allocator.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_checksum_multi.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_checksum_multi.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_checksum_parallel.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_checksum_parallel.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_compare256.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_compare256.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_compare256_rle.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_compare256_rle.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_compress.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_compress.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_compress_bound.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_compress_bound.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_crc32.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_crc32.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_crc32c.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_crc32c.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_crc64.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_crc64.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_cve-2003-0107.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_cve-2003-0107.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_alloc.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_alloc.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_bound.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_bound.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_concurrency.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_concurrency.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_copy.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_copy.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_dict.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_dict.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_direct_output.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_direct_output.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_hash_head_0.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_hash_head_0.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_header.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_header.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_lit_mem.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_lit_mem.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_params.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_params.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_pending.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_pending.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_prime.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_prime.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_quick_bi_valid.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_quick_bi_valid.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_quick_block_open.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_quick_block_open.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_rsyncable.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_rsyncable.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_tune.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_deflate_tune.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_dict.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_dict.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_ahead.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_ahead.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_append.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_append.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_bgzf.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_bgzf.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_getline.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_getline.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_mem.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_mem.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_mmap.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_mmap.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_parallel.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_parallel.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_seekable.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_seekable.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_uring.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_gzio_uring.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_hibernate.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_hibernate.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_adler32.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_adler32.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_copy.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_copy.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_sync.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_inflate_sync.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_insert_string.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_insert_string.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_large_buffers.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_large_buffers.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_main.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_main.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_raw.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_raw.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_small_buffers.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_small_buffers.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_small_window.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_small_window.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_source_size.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_source_size.cc.o.d"
+  "CMakeFiles/gtest_zlib.dir/test_version.cc.o"
+  "CMakeFiles/gtest_zlib.dir/test_version.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_zlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../makecrct"
+  "../makecrct.pdb"
+  "CMakeFiles/makecrct.dir/__/tools/makecrct.c.o"
+  "CMakeFiles/makecrct.dir/__/tools/makecrct.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/makecrct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
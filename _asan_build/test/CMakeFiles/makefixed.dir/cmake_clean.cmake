@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../makefixed"
+  "../makefixed.pdb"
+  "CMakeFiles/makefixed.dir/__/inftrees.c.o"
+  "CMakeFiles/makefixed.dir/__/inftrees.c.o.d"
+  "CMakeFiles/makefixed.dir/__/tools/makefixed.c.o"
+  "CMakeFiles/makefixed.dir/__/tools/makefixed.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/makefixed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
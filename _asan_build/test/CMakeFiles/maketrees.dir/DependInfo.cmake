@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/maketrees.c" "test/CMakeFiles/maketrees.dir/__/tools/maketrees.c.o" "gcc" "test/CMakeFiles/maketrees.dir/__/tools/maketrees.c.o.d"
+  "/root/repo/trees.c" "test/CMakeFiles/maketrees.dir/__/trees.c.o" "gcc" "test/CMakeFiles/maketrees.dir/__/trees.c.o.d"
+  "/root/repo/zutil.c" "test/CMakeFiles/maketrees.dir/__/zutil.c.o" "gcc" "test/CMakeFiles/maketrees.dir/__/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../minigzip"
+  "../minigzip.pdb"
+  "CMakeFiles/minigzip.dir/minigzip.c.o"
+  "CMakeFiles/minigzip.dir/minigzip.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/minigzip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
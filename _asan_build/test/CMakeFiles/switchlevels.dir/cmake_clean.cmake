@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../switchlevels"
+  "../switchlevels.pdb"
+  "CMakeFiles/switchlevels.dir/switchlevels.c.o"
+  "CMakeFiles/switchlevels.dir/switchlevels.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/switchlevels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,150 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_asan_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[example]=] "/root/repo/_asan_build/example")
+set_tests_properties([=[example]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;17;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[infcover]=] "/root/repo/_asan_build/infcover")
+set_tests_properties([=[infcover]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;58;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2002-0059]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;-d" "-DINPUT=/root/repo/test/CVE-2002-0059/test.gz" "-DSUCCESS_EXIT=0;1" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[CVE-2002-0059]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;6;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2004-0797]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;-d" "-DINPUT=/root/repo/test/CVE-2004-0797/test.gz" "-DSUCCESS_EXIT=0;1" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[CVE-2004-0797]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;6;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2005-1849]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;-d" "-DINPUT=/root/repo/test/CVE-2005-1849/test.gz" "-DSUCCESS_EXIT=0;1" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[CVE-2005-1849]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;6;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2005-2096]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;-d" "-DINPUT=/root/repo/test/CVE-2005-2096/test.gz" "-DSUCCESS_EXIT=0;1" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[CVE-2005-2096]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;6;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-fixed-level-6]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-F;-6" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-6" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/fixed.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-fixed-level-6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;16;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-default-level-6]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-6" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-6" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/default.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-default-level-6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;25;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-fixed-level-1]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-F;-1" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-1" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/fixed.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-fixed-level-1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;16;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-default-level-1]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-1" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-1" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/default.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-default-level-1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;25;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-fixed-level-2]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-F;-2" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-2" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/fixed.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-fixed-level-2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;16;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[CVE-2018-25032-default-level-2]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-k;-m;1;-w;-15;-s;4;-2" "-DDECOMPRESS_ARGS=-c;-k;-d;-m;1;-w;-15;-2" "-DGZIP_VERIFY=OFF" "-DINPUT=/root/repo/test/CVE-2018-25032/default.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[CVE-2018-25032-default-level-2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-cves.cmake;25;add_test;/root/repo/test/cmake/test-cves.cmake;0;;/root/repo/test/CMakeLists.txt;81;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-R]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-R" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-R" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-R]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-h]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-h" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-h" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-h]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-T]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-T" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-T" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-T]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-0]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-0" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-0" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-1]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-1" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-1" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-2]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-2" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-2" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-4]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-4" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-4" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-5]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-5" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-5" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-F]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-F" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-F" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-F]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-6]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-6" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-6" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-9]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-9" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-9" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-9]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-fireworks.jpg-f]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-f" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/fireworks.jpg" "-DTEST_NAME=minigzip-fireworks.jpg-f" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-fireworks.jpg-f]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-R]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-R" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-R" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-R]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-h]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-h" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-h" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-h]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-T]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-T" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-T" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-T]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-0]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-0" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-0" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-1]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-1" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-1" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-2]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-2" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-2" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-4]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-4" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-4" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-5]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-5" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-5" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-F]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-F" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-F" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-F]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-6]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-6" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-6" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-9]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-9" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-9" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-9]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-lcet10.txt-f]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-f" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-lcet10.txt-f" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-lcet10.txt-f]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-R]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-R" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-R" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-R]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-h]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-h" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-h" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-h]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-T]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-T" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-T" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-T]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-0]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-0" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-0" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-1]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-1" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-1" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-2]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-2" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-2" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-4]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-4" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-4" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-5]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-5" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-5" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-F]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-F" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-F" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-F]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-6]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-6" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-6" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-9]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-9" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-9" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-9]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-paper-100k.pdf-f]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-f" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-paper-100k.pdf-f" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-paper-100k.pdf-f]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;62;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-detect-text-A]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-A" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/lcet10.txt" "-DTEST_NAME=minigzip-detect-text-A" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-detect-text-A]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;67;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-detect-binary-A]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-k;-c;-A" "-DDECOMPRESS_ARGS=-d;-c" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-DTEST_NAME=minigzip-detect-binary-A" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-detect-binary-A]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-data.cmake;19;add_test;/root/repo/test/cmake/test-data.cmake;68;test_minigzip;/root/repo/test/cmake/test-data.cmake;0;;/root/repo/test/CMakeLists.txt;84;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-361]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DCOMPRESS_ARGS=-c;-k;-4" "-DTEST_NAME=GH-361-test-txt" "-DINPUT=/root/repo/test/GH-361/test.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-361]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;3;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-364]=] "/usr/bin/cmake" "-DCOMPRESS_TARGET=/root/repo/_asan_build/switchlevels" "-DCOMPRESS_ARGS=1;5;9;3" "-DDECOMPRESS_TARGET=/root/repo/_asan_build/minigzip" "-DTEST_NAME=GH-364-test-bin" "-DINPUT=/root/repo/test/GH-364/test.bin" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-364]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;11;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-382]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DCOMPRESS_ARGS=-c;-m;1;-w;-15;-1;-s;4" "-DDECOMPRESS_ARGS=-c;-d;-m;1;-w;-15" "-DGZIP_VERIFY=OFF" "-DTEST_NAME=GH-382-defneg3-dat" "-DINPUT=/root/repo/test/GH-382/defneg3.dat" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-382]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;20;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-536-segfault]=] "/usr/bin/cmake" "-DCOMPRESS_TARGET=/root/repo/_asan_build/switchlevels" "-DCOMPRESS_ARGS=6;9744;1;91207" "-DDECOMPRESS_TARGET=/root/repo/_asan_build/minigzip" "-DCOMPARE=OFF" "-DGZIP_VERIFY=OFF" "-DTEST_NAME=GH-536-segfault-lcet10-txt" "-DINPUT=/root/repo/test/data/lcet10.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-536-segfault]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;30;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-536-incomplete-read]=] "/usr/bin/cmake" "-DCOMPRESS_TARGET=/root/repo/_asan_build/switchlevels" "-DCOMPRESS_ARGS=6;88933;1;195840;2;45761" "-DDECOMPRESS_TARGET=/root/repo/_asan_build/minigzip" "-DCOMPARE=OFF" "-DGZIP_VERIFY=OFF" "-DTEST_NAME=GH-536-incomplete-read-lcet10-txt" "-DINPUT=/root/repo/test/data/lcet10.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-536-incomplete-read]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;41;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-536-zero-stored-block]=] "/usr/bin/cmake" "-DCOMPRESS_TARGET=/root/repo/_asan_build/switchlevels" "-DCOMPRESS_ARGS=6;15248;1;1050;2;25217" "-DDECOMPRESS_TARGET=/root/repo/_asan_build/minigzip" "-DCOMPARE=OFF" "-DGZIP_VERIFY=OFF" "-DTEST_NAME=GH-536-zero-stored-block-lcet10-txt" "-DINPUT=/root/repo/test/data/lcet10.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-536-zero-stored-block]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;52;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-751]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DTEST_NAME=GH-751-test-txt" "-DINPUT=/root/repo/test/GH-751/test.txt" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[GH-751]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;63;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-1600-no-window-check]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minideflate;-c;-d;-k;-s;4" "-DINPUT=/root/repo/test/GH-1600/packobj.gz" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[GH-1600-no-window-check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;71;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[GH-1600-no-window-no-check]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minideflate;-c;-d;-k;-s;4;-r;25" "-DINPUT=/root/repo/test/GH-1600/packobj.gz" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[GH-1600-no-window-no-check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-issues.cmake;79;add_test;/root/repo/test/cmake/test-issues.cmake;0;;/root/repo/test/CMakeLists.txt;87;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-file_compress]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minigzip" "-DFILEMODE=ON" "-DGZIP_VERIFY=ON" "-DTEST_NAME=minigzip-file_compress" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minigzip-file_compress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;4;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minideflate-file_compress]=] "/usr/bin/cmake" "-DTARGET=/root/repo/_asan_build/minideflate" "-DFILEMODE=ON" "-DGZIP_VERIFY=OFF" "-DTEST_NAME=minideflate-file_compress" "-DINPUT=/root/repo/test/data/paper-100k.pdf" "-P" "/root/repo/test/cmake/compress-and-verify.cmake")
+set_tests_properties([=[minideflate-file_compress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;13;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-help]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;--help" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[minigzip-help]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;24;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minigzip-invalid]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minigzip;--invalid" "-DSUCCESS_EXIT=64" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[minigzip-invalid]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;30;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minideflate-help]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minideflate;--help" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[minideflate-help]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;37;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minideflate-invalid]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/minideflate;--invalid" "-DSUCCESS_EXIT=64" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[minideflate-invalid]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;43;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[switchlevels-help]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/switchlevels;--help" "-P" "/root/repo/test/cmake/run-and-redirect.cmake")
+set_tests_properties([=[switchlevels-help]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;50;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[makecrct]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/makecrct" "-DOUTPUT=/root/repo/_asan_build/Testing/Temporary/crc32_braid_tbl._h" "-DCOMPARE=/root/repo/crc32_braid_tbl.h" "-DIGNORE_LINE_ENDINGS=ON" "-P" "/root/repo/test/cmake/run-and-compare.cmake")
+set_tests_properties([=[makecrct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;56;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[makecrct-crc32c]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/makecrct;-c" "-DOUTPUT=/root/repo/_asan_build/Testing/Temporary/crc32c_braid_tbl._h" "-DCOMPARE=/root/repo/crc32c_braid_tbl.h" "-DIGNORE_LINE_ENDINGS=ON" "-P" "/root/repo/test/cmake/run-and-compare.cmake")
+set_tests_properties([=[makecrct-crc32c]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;66;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[makecrc64t]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/makecrc64t" "-DOUTPUT=/root/repo/_asan_build/Testing/Temporary/crc64_tbl._h" "-DCOMPARE=/root/repo/crc64_tbl.h" "-DIGNORE_LINE_ENDINGS=ON" "-P" "/root/repo/test/cmake/run-and-compare.cmake")
+set_tests_properties([=[makecrc64t]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;75;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[makefixed]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/makefixed" "-DOUTPUT=/root/repo/_asan_build/Testing/Temporary/inffixed_tbl._h" "-DCOMPARE=/root/repo/inffixed_tbl.h" "-DIGNORE_LINE_ENDINGS=ON" "-P" "/root/repo/test/cmake/run-and-compare.cmake")
+set_tests_properties([=[makefixed]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;84;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[maketrees]=] "/usr/bin/cmake" "-DCOMMAND=/root/repo/_asan_build/maketrees" "-DOUTPUT=/root/repo/_asan_build/Testing/Temporary/trees_tbl._h" "-DCOMPARE=/root/repo/trees_tbl.h" "-DIGNORE_LINE_ENDINGS=ON" "-P" "/root/repo/test/cmake/run-and-compare.cmake")
+set_tests_properties([=[maketrees]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/cmake/test-tools.cmake;93;add_test;/root/repo/test/cmake/test-tools.cmake;0;;/root/repo/test/CMakeLists.txt;90;include;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[gtest_zlib]=] "/root/repo/_asan_build/gtest_zlib")
+set_tests_properties([=[gtest_zlib]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;288;add_test;/root/repo/test/CMakeLists.txt;0;")
@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ZLIB::ZLIB" for configuration "Release"
+set_property(TARGET ZLIB::ZLIB APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(ZLIB::ZLIB PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libz.so.1.3.1.zlib-ng"
+  IMPORTED_SONAME_RELEASE "libz.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets ZLIB::ZLIB )
+list(APPEND _cmake_import_check_files_for_ZLIB::ZLIB "${_IMPORT_PREFIX}/lib/libz.so.1.3.1.zlib-ng" )
+
+# Import target "ZLIB::zlibstatic" for configuration "Release"
+set_property(TARGET ZLIB::zlibstatic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(ZLIB::zlibstatic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "C"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libz.a"
+  )
+
+list(APPEND _cmake_import_check_targets ZLIB::zlibstatic )
+list(APPEND _cmake_import_check_files_for_ZLIB::zlibstatic "${_IMPORT_PREFIX}/lib/libz.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,84 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/adler32.c" "CMakeFiles/zlib.dir/adler32.c.o" "gcc" "CMakeFiles/zlib.dir/adler32.c.o.d"
+  "/root/repo/arch/generic/adler32_c.c" "CMakeFiles/zlib.dir/arch/generic/adler32_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/adler32_c.c.o.d"
+  "/root/repo/arch/generic/adler32_fold_c.c" "CMakeFiles/zlib.dir/arch/generic/adler32_fold_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/adler32_fold_c.c.o.d"
+  "/root/repo/arch/generic/chunkset_c.c" "CMakeFiles/zlib.dir/arch/generic/chunkset_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/chunkset_c.c.o.d"
+  "/root/repo/arch/generic/compare256_c.c" "CMakeFiles/zlib.dir/arch/generic/compare256_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/compare256_c.c.o.d"
+  "/root/repo/arch/generic/crc32_braid_c.c" "CMakeFiles/zlib.dir/arch/generic/crc32_braid_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/crc32_braid_c.c.o.d"
+  "/root/repo/arch/generic/crc32_fold_c.c" "CMakeFiles/zlib.dir/arch/generic/crc32_fold_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/crc32_fold_c.c.o.d"
+  "/root/repo/arch/generic/crc32c_braid_c.c" "CMakeFiles/zlib.dir/arch/generic/crc32c_braid_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/crc32c_braid_c.c.o.d"
+  "/root/repo/arch/generic/crc64_c.c" "CMakeFiles/zlib.dir/arch/generic/crc64_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/crc64_c.c.o.d"
+  "/root/repo/arch/generic/slide_hash_c.c" "CMakeFiles/zlib.dir/arch/generic/slide_hash_c.c.o" "gcc" "CMakeFiles/zlib.dir/arch/generic/slide_hash_c.c.o.d"
+  "/root/repo/arch/x86/adler32_avx2.c" "CMakeFiles/zlib.dir/arch/x86/adler32_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/adler32_avx2.c.o.d"
+  "/root/repo/arch/x86/adler32_avx512.c" "CMakeFiles/zlib.dir/arch/x86/adler32_avx512.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/adler32_avx512.c.o.d"
+  "/root/repo/arch/x86/adler32_avx512_vnni.c" "CMakeFiles/zlib.dir/arch/x86/adler32_avx512_vnni.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/adler32_avx512_vnni.c.o.d"
+  "/root/repo/arch/x86/adler32_sse42.c" "CMakeFiles/zlib.dir/arch/x86/adler32_sse42.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/adler32_sse42.c.o.d"
+  "/root/repo/arch/x86/adler32_ssse3.c" "CMakeFiles/zlib.dir/arch/x86/adler32_ssse3.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/adler32_ssse3.c.o.d"
+  "/root/repo/arch/x86/chunkset_avx2.c" "CMakeFiles/zlib.dir/arch/x86/chunkset_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/chunkset_avx2.c.o.d"
+  "/root/repo/arch/x86/chunkset_sse2.c" "CMakeFiles/zlib.dir/arch/x86/chunkset_sse2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/chunkset_sse2.c.o.d"
+  "/root/repo/arch/x86/chunkset_ssse3.c" "CMakeFiles/zlib.dir/arch/x86/chunkset_ssse3.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/chunkset_ssse3.c.o.d"
+  "/root/repo/arch/x86/compare256_avx2.c" "CMakeFiles/zlib.dir/arch/x86/compare256_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/compare256_avx2.c.o.d"
+  "/root/repo/arch/x86/compare256_sse2.c" "CMakeFiles/zlib.dir/arch/x86/compare256_sse2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/compare256_sse2.c.o.d"
+  "/root/repo/arch/x86/crc32_pclmulqdq.c" "CMakeFiles/zlib.dir/arch/x86/crc32_pclmulqdq.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc32_pclmulqdq.c.o.d"
+  "/root/repo/arch/x86/crc32_vpclmulqdq.c" "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq.c.o.d"
+  "/root/repo/arch/x86/crc32_vpclmulqdq_avx2.c" "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o.d"
+  "/root/repo/arch/x86/crc32c_sse42.c" "CMakeFiles/zlib.dir/arch/x86/crc32c_sse42.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc32c_sse42.c.o.d"
+  "/root/repo/arch/x86/crc64_pclmulqdq.c" "CMakeFiles/zlib.dir/arch/x86/crc64_pclmulqdq.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc64_pclmulqdq.c.o.d"
+  "/root/repo/arch/x86/crc64_vpclmulqdq.c" "CMakeFiles/zlib.dir/arch/x86/crc64_vpclmulqdq.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/crc64_vpclmulqdq.c.o.d"
+  "/root/repo/arch/x86/insert_string_avx2.c" "CMakeFiles/zlib.dir/arch/x86/insert_string_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/insert_string_avx2.c.o.d"
+  "/root/repo/arch/x86/slide_hash_avx2.c" "CMakeFiles/zlib.dir/arch/x86/slide_hash_avx2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/slide_hash_avx2.c.o.d"
+  "/root/repo/arch/x86/slide_hash_sse2.c" "CMakeFiles/zlib.dir/arch/x86/slide_hash_sse2.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/slide_hash_sse2.c.o.d"
+  "/root/repo/arch/x86/x86_features.c" "CMakeFiles/zlib.dir/arch/x86/x86_features.c.o" "gcc" "CMakeFiles/zlib.dir/arch/x86/x86_features.c.o.d"
+  "/root/repo/checksum_parallel.c" "CMakeFiles/zlib.dir/checksum_parallel.c.o" "gcc" "CMakeFiles/zlib.dir/checksum_parallel.c.o.d"
+  "/root/repo/compress.c" "CMakeFiles/zlib.dir/compress.c.o" "gcc" "CMakeFiles/zlib.dir/compress.c.o.d"
+  "/root/repo/cpu_features.c" "CMakeFiles/zlib.dir/cpu_features.c.o" "gcc" "CMakeFiles/zlib.dir/cpu_features.c.o.d"
+  "/root/repo/crc32.c" "CMakeFiles/zlib.dir/crc32.c.o" "gcc" "CMakeFiles/zlib.dir/crc32.c.o.d"
+  "/root/repo/crc32_braid_comb.c" "CMakeFiles/zlib.dir/crc32_braid_comb.c.o" "gcc" "CMakeFiles/zlib.dir/crc32_braid_comb.c.o.d"
+  "/root/repo/crc32c.c" "CMakeFiles/zlib.dir/crc32c.c.o" "gcc" "CMakeFiles/zlib.dir/crc32c.c.o.d"
+  "/root/repo/crc64.c" "CMakeFiles/zlib.dir/crc64.c.o" "gcc" "CMakeFiles/zlib.dir/crc64.c.o.d"
+  "/root/repo/deflate.c" "CMakeFiles/zlib.dir/deflate.c.o" "gcc" "CMakeFiles/zlib.dir/deflate.c.o.d"
+  "/root/repo/deflate_fast.c" "CMakeFiles/zlib.dir/deflate_fast.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_fast.c.o.d"
+  "/root/repo/deflate_huff.c" "CMakeFiles/zlib.dir/deflate_huff.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_huff.c.o.d"
+  "/root/repo/deflate_medium.c" "CMakeFiles/zlib.dir/deflate_medium.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_medium.c.o.d"
+  "/root/repo/deflate_quick.c" "CMakeFiles/zlib.dir/deflate_quick.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_quick.c.o.d"
+  "/root/repo/deflate_rle.c" "CMakeFiles/zlib.dir/deflate_rle.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_rle.c.o.d"
+  "/root/repo/deflate_slow.c" "CMakeFiles/zlib.dir/deflate_slow.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_slow.c.o.d"
+  "/root/repo/deflate_stored.c" "CMakeFiles/zlib.dir/deflate_stored.c.o" "gcc" "CMakeFiles/zlib.dir/deflate_stored.c.o.d"
+  "/root/repo/functable.c" "CMakeFiles/zlib.dir/functable.c.o" "gcc" "CMakeFiles/zlib.dir/functable.c.o.d"
+  "/root/repo/gzlib.c" "CMakeFiles/zlib.dir/gzlib.c.o" "gcc" "CMakeFiles/zlib.dir/gzlib.c.o.d"
+  "/root/repo/_compat_build/gzread.c" "CMakeFiles/zlib.dir/gzread.c.o" "gcc" "CMakeFiles/zlib.dir/gzread.c.o.d"
+  "/root/repo/gzuring.c" "CMakeFiles/zlib.dir/gzuring.c.o" "gcc" "CMakeFiles/zlib.dir/gzuring.c.o.d"
+  "/root/repo/gzwrite.c" "CMakeFiles/zlib.dir/gzwrite.c.o" "gcc" "CMakeFiles/zlib.dir/gzwrite.c.o.d"
+  "/root/repo/infback.c" "CMakeFiles/zlib.dir/infback.c.o" "gcc" "CMakeFiles/zlib.dir/infback.c.o.d"
+  "/root/repo/inflate.c" "CMakeFiles/zlib.dir/inflate.c.o" "gcc" "CMakeFiles/zlib.dir/inflate.c.o.d"
+  "/root/repo/inftrees.c" "CMakeFiles/zlib.dir/inftrees.c.o" "gcc" "CMakeFiles/zlib.dir/inftrees.c.o.d"
+  "/root/repo/insert_string.c" "CMakeFiles/zlib.dir/insert_string.c.o" "gcc" "CMakeFiles/zlib.dir/insert_string.c.o.d"
+  "/root/repo/insert_string_roll.c" "CMakeFiles/zlib.dir/insert_string_roll.c.o" "gcc" "CMakeFiles/zlib.dir/insert_string_roll.c.o.d"
+  "/root/repo/trees.c" "CMakeFiles/zlib.dir/trees.c.o" "gcc" "CMakeFiles/zlib.dir/trees.c.o.d"
+  "/root/repo/uncompr.c" "CMakeFiles/zlib.dir/uncompr.c.o" "gcc" "CMakeFiles/zlib.dir/uncompr.c.o.d"
+  "/root/repo/zthread.c" "CMakeFiles/zlib.dir/zthread.c.o" "gcc" "CMakeFiles/zlib.dir/zthread.c.o.d"
+  "/root/repo/zutil.c" "CMakeFiles/zlib.dir/zutil.c.o" "gcc" "CMakeFiles/zlib.dir/zutil.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_compat_build/libz.so" "/root/repo/_compat_build/libz.so.1.3.1.zlib-ng"
+  "/root/repo/_compat_build/libz.so.1" "/root/repo/_compat_build/libz.so.1.3.1.zlib-ng"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,129 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zlib.dir/adler32.c.o"
+  "CMakeFiles/zlib.dir/adler32.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/adler32_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/adler32_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/adler32_fold_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/adler32_fold_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/chunkset_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/chunkset_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/compare256_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/compare256_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/crc32_braid_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/crc32_braid_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/crc32_fold_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/crc32_fold_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/crc32c_braid_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/crc32c_braid_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/crc64_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/crc64_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/generic/slide_hash_c.c.o"
+  "CMakeFiles/zlib.dir/arch/generic/slide_hash_c.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx512.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx512.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx512_vnni.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_avx512_vnni.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_sse42.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_sse42.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_ssse3.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/adler32_ssse3.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_sse2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_sse2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_ssse3.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/chunkset_ssse3.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/compare256_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/compare256_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/compare256_sse2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/compare256_sse2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_pclmulqdq.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_pclmulqdq.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc32_vpclmulqdq_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc32c_sse42.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc32c_sse42.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc64_pclmulqdq.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc64_pclmulqdq.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/crc64_vpclmulqdq.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/crc64_vpclmulqdq.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/insert_string_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/insert_string_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/slide_hash_avx2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/slide_hash_avx2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/slide_hash_sse2.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/slide_hash_sse2.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/x86_features.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/x86_features.c.o.d"
+  "CMakeFiles/zlib.dir/checksum_parallel.c.o"
+  "CMakeFiles/zlib.dir/checksum_parallel.c.o.d"
+  "CMakeFiles/zlib.dir/compress.c.o"
+  "CMakeFiles/zlib.dir/compress.c.o.d"
+  "CMakeFiles/zlib.dir/cpu_features.c.o"
+  "CMakeFiles/zlib.dir/cpu_features.c.o.d"
+  "CMakeFiles/zlib.dir/crc32.c.o"
+  "CMakeFiles/zlib.dir/crc32.c.o.d"
+  "CMakeFiles/zlib.dir/crc32_braid_comb.c.o"
+  "CMakeFiles/zlib.dir/crc32_braid_comb.c.o.d"
+  "CMakeFiles/zlib.dir/crc32c.c.o"
+  "CMakeFiles/zlib.dir/crc32c.c.o.d"
+  "CMakeFiles/zlib.dir/crc64.c.o"
+  "CMakeFiles/zlib.dir/crc64.c.o.d"
+  "CMakeFiles/zlib.dir/deflate.c.o"
+  "CMakeFiles/zlib.dir/deflate.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_fast.c.o"
+  "CMakeFiles/zlib.dir/deflate_fast.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_huff.c.o"
+  "CMakeFiles/zlib.dir/deflate_huff.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_medium.c.o"
+  "CMakeFiles/zlib.dir/deflate_medium.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_quick.c.o"
+  "CMakeFiles/zlib.dir/deflate_quick.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_rle.c.o"
+  "CMakeFiles/zlib.dir/deflate_rle.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_slow.c.o"
+  "CMakeFiles/zlib.dir/deflate_slow.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_stored.c.o"
+  "CMakeFiles/zlib.dir/deflate_stored.c.o.d"
+  "CMakeFiles/zlib.dir/functable.c.o"
+  "CMakeFiles/zlib.dir/functable.c.o.d"
+  "CMakeFiles/zlib.dir/gzlib.c.o"
+  "CMakeFiles/zlib.dir/gzlib.c.o.d"
+  "CMakeFiles/zlib.dir/gzread.c.o"
+  "CMakeFiles/zlib.dir/gzread.c.o.d"
+  "CMakeFiles/zlib.dir/gzuring.c.o"
+  "CMakeFiles/zlib.dir/gzuring.c.o.d"
+  "CMakeFiles/zlib.dir/gzwrite.c.o"
+  "CMakeFiles/zlib.dir/gzwrite.c.o.d"
+  "CMakeFiles/zlib.dir/infback.c.o"
+  "CMakeFiles/zlib.dir/infback.c.o.d"
+  "CMakeFiles/zlib.dir/inflate.c.o"
+  "CMakeFiles/zlib.dir/inflate.c.o.d"
+  "CMakeFiles/zlib.dir/inftrees.c.o"
+  "CMakeFiles/zlib.dir/inftrees.c.o.d"
+  "CMakeFiles/zlib.dir/insert_string.c.o"
+  "CMakeFiles/zlib.dir/insert_string.c.o.d"
+  "CMakeFiles/zlib.dir/insert_string_roll.c.o"
+  "CMakeFiles/zlib.dir/insert_string_roll.c.o.d"
+  "CMakeFiles/zlib.dir/trees.c.o"
+  "CMakeFiles/zlib.dir/trees.c.o.d"
+  "CMakeFiles/zlib.dir/uncompr.c.o"
+  "CMakeFiles/zlib.dir/uncompr.c.o.d"
+  "CMakeFiles/zlib.dir/zthread.c.o"
+  "CMakeFiles/zlib.dir/zthread.c.o.d"
+  "CMakeFiles/zlib.dir/zutil.c.o"
+  "CMakeFiles/zlib.dir/zutil.c.o.d"
+  "libz.pdb"
+  "libz.so"
+  "libz.so.1"
+  "libz.so.1.3.1.zlib-ng"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
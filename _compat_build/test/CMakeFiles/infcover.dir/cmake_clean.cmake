@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../infcover"
+  "../infcover.pdb"
+  "CMakeFiles/infcover.dir/__/inftrees.c.o"
+  "CMakeFiles/infcover.dir/__/inftrees.c.o.d"
+  "CMakeFiles/infcover.dir/infcover.c.o"
+  "CMakeFiles/infcover.dir/infcover.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/infcover.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../makecrc64t"
+  "../makecrc64t.pdb"
+  "CMakeFiles/makecrc64t.dir/__/tools/makecrc64t.c.o"
+  "CMakeFiles/makecrc64t.dir/__/tools/makecrc64t.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/makecrc64t.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
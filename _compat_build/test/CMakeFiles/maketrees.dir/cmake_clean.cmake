@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../maketrees"
+  "../maketrees.pdb"
+  "CMakeFiles/maketrees.dir/__/tools/maketrees.c.o"
+  "CMakeFiles/maketrees.dir/__/tools/maketrees.c.o.d"
+  "CMakeFiles/maketrees.dir/__/trees.c.o"
+  "CMakeFiles/maketrees.dir/__/trees.c.o.d"
+  "CMakeFiles/maketrees.dir/__/zutil.c.o"
+  "CMakeFiles/maketrees.dir/__/zutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/maketrees.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
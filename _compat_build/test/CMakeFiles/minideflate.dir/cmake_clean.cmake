@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../minideflate"
+  "../minideflate.pdb"
+  "CMakeFiles/minideflate.dir/minideflate.c.o"
+  "CMakeFiles/minideflate.dir/minideflate.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/minideflate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -28,6 +28,15 @@ uint32_t Z_EXPORT PREFIX(adler32)(uint32_t adler, const unsigned char *buf, uint
 }
 #endif
 
+#ifndef ZLIB_COMPAT
+/* Unlike crc32, the SIMD adler32 functions are limited by throughput and not by the latency of a
+   dependency chain, so interleaving several buffers gains nothing over one call per buffer. */
+void Z_EXPORT PREFIX(adler32_multi)(uint32_t *adler, const zng_iovec *buf, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        adler[i] = PREFIX(adler32_z)(adler[i], (const uint8_t *)buf[i].iov_base, buf[i].iov_len);
+}
+#endif
+
 /* ========================================================================= */
 static uint32_t adler32_combine_(uint32_t adler1, uint32_t adler2, z_off64_t len2) {
     uint32_t sum1;
@@ -9,6 +9,7 @@
 uint32_t adler32_neon(uint32_t adler, const uint8_t *buf, size_t len);
 uint32_t chunksize_neon(void);
 uint8_t* chunkmemset_safe_neon(uint8_t *out, uint8_t *from, unsigned len, unsigned left);
+void insert_string_neon(deflate_state *const s, uint32_t str, uint32_t count);
 
 #  ifdef HAVE_BUILTIN_CTZLL
 uint32_t compare256_neon(const uint8_t *src0, const uint8_t *src1);
@@ -21,6 +22,7 @@ void inflate_fast_neon(PREFIX3(stream) *strm, uint32_t start);
 
 #ifdef ARM_ACLE
 uint32_t crc32_acle(uint32_t crc, const uint8_t *buf, size_t len);
+uint32_t crc32c_acle(uint32_t crc, const uint8_t *buf, size_t len);
 #endif
 
 #ifdef ARM_SIMD
@@ -44,6 +46,8 @@ void slide_hash_armv6(deflate_state *s);
 #    define native_chunksize chunksize_neon
 #    undef native_inflate_fast
 #    define native_inflate_fast inflate_fast_neon
+#    undef native_insert_string
+#    define native_insert_string insert_string_neon
 #    undef native_slide_hash
 #    define native_slide_hash slide_hash_neon
 #    ifdef HAVE_BUILTIN_CTZLL
@@ -59,6 +63,8 @@ void slide_hash_armv6(deflate_state *s);
 #  if defined(ARM_ACLE) && defined(__ARM_ACLE) && defined(__ARM_FEATURE_CRC32)
 #    undef native_crc32
 #    define native_crc32 crc32_acle
+#    undef native_crc32c
+#    define native_crc32c crc32c_acle
 #  endif
 #endif
 
@@ -75,4 +75,29 @@ Z_INTERNAL Z_TARGET_CRC uint32_t crc32_acle(uint32_t crc, const uint8_t *buf, si
     c = ~c;
     return c;
 }
+
+/* The ARMv8 CRC32 extension also has instructions for the Castagnoli polynomial */
+Z_INTERNAL Z_TARGET_CRC uint32_t crc32c_acle(uint32_t crc, const uint8_t *buf, size_t len) {
+    uint32_t c = ~crc;
+    uint64_t word;
+
+    while (len && ((uintptr_t)buf & (sizeof(uint64_t) - 1)) != 0) {
+        c = __crc32cb(c, *buf++);
+        len--;
+    }
+
+    while (len >= sizeof(uint64_t)) {
+        memcpy(&word, buf, sizeof(word));
+        c = __crc32cd(c, word);
+        buf += sizeof(word);
+        len -= sizeof(word);
+    }
+
+    while (len) {
+        c = __crc32cb(c, *buf++);
+        len--;
+    }
+
+    return ~c;
+}
 #endif
@@ -0,0 +1,66 @@
+/* insert_string_neon.c -- NEON batched hash insertion
+ *
+ * Computes the integer hash for 16 consecutive positions at a time and then
+ * links them into the hash chains in order, prefetching the head[] buckets
+ * of the next batch while the current one is being linked.
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef ARM_NEON
+#include "neon_intrins.h"
+#include "zbuild.h"
+#include "deflate.h"
+#include "insert_string_p.h"
+
+/* Minimum number of remaining positions for which the four 16-byte loads at
+ * p[0..3] stay within the bytes that insert_string() itself reads. */
+#define BATCH_MIN_LEN 16
+
+/* Hash the 16 positions starting at p. Loading at p+k yields the 32-bit words
+ * for positions k, k+4, k+8 and k+12, which vst4q_u32 stores back in order. */
+static inline void hash16(uint32_t *out, const uint8_t *p) {
+    const uint32x4_t mask = vdupq_n_u32(HASH_MASK);
+    uint32x4x4_t h;
+
+    h.val[0] = vreinterpretq_u32_u8(vld1q_u8(p));
+    h.val[1] = vreinterpretq_u32_u8(vld1q_u8(p + 1));
+    h.val[2] = vreinterpretq_u32_u8(vld1q_u8(p + 2));
+    h.val[3] = vreinterpretq_u32_u8(vld1q_u8(p + 3));
+    for (int k = 0; k < 4; k++)
+        h.val[k] = vandq_u32(vshrq_n_u32(vmulq_n_u32(h.val[k], HASH_MULTIPLIER), HASH_SLIDE), mask);
+    vst4q_u32(out, h);
+}
+
+Z_INTERNAL void insert_string_neon(deflate_state *const s, uint32_t str, uint32_t count) {
+    uint32_t done = 0;
+#if BYTE_ORDER == LITTLE_ENDIAN
+    ALIGNED_(16) uint32_t hashes[2][16];
+    const uint8_t *strstart = s->window + str;
+    int cur = 0;
+
+    if (count >= BATCH_MIN_LEN) {
+        int more;
+
+        hash16(hashes[cur], strstart);
+        do {
+            more = count - done >= 16 + BATCH_MIN_LEN;
+            if (more) {
+                /* Start on the next batch so its head[] buckets are in cache by the time they are linked */
+                uint32_t *next = hashes[cur ^ 1];
+                hash16(next, strstart + done + 16);
+                for (int i = 0; i < 16; i++)
+                    PREFETCH_RW(&s->head[next[i]]);
+            }
+            for (int i = 0; i < 16; i++)
+                insert_string_link(s, hashes[cur][i], (Pos)(str + done + i));
+            done += 16;
+            cur ^= 1;
+        } while (more);
+    }
+#endif
+
+    if (done < count)
+        insert_string(s, str + done, count - done);
+}
+#endif
@@ -5,6 +5,7 @@
 #include "zbuild.h"
 #include "zutil.h"
 #include "functable.h"
+#include "arch_functions.h"
 #include "crc32.h"
 
 Z_INTERNAL uint32_t crc32_fold_reset_c(crc32_fold *crc) {
@@ -29,3 +30,14 @@ Z_INTERNAL void crc32_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, ui
 Z_INTERNAL uint32_t crc32_fold_final_c(crc32_fold *crc) {
     return crc->value;
 }
+
+Z_INTERNAL void crc32_multi_c(uint32_t *crc, const uint8_t *const *buf, const size_t *len) {
+    for (int i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        crc[i] = FUNCTABLE_CALL(crc32)(crc[i], buf[i], len[i]);
+}
+
+Z_INTERNAL uint32_t crc32c_fold_copy_c(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    crc = FUNCTABLE_CALL(crc32c)(crc, src, len);
+    memcpy(dst, src, len);
+    return crc;
+}
@@ -0,0 +1,18 @@
+/* crc32c_braid_c.c -- compute the CRC-32C (Castagnoli) of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Uses the same braided calculation as crc32_braid_c.c, with the tables
+ * for the Castagnoli polynomial generated by makecrct -c.
+ */
+
+#include "zbuild.h"
+#include "crc32_braid_p.h"
+#include "crc32c_braid_tbl.h"
+
+#define CRC32_BRAID         crc32c_braid
+#define CRC_TABLE           crc32c_table
+#define CRC_BIG_TABLE       crc32c_big_table
+#define CRC_BRAID_TABLE     crc32c_braid_table
+#define CRC_BRAID_BIG_TABLE crc32c_braid_big_table
+
+#include "crc32_braid_tpl.h"
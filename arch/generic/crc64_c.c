@@ -0,0 +1,59 @@
+/* crc64_c.c -- compute the CRC-64 of a data stream using slice-by-8 tables
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "functable.h"
+#include "crc64_tbl.h"
+
+static inline uint64_t crc64_slice8(uint64_t crc, const uint8_t *buf, size_t len, const uint64_t table[][256]) {
+    uint64_t c = ~crc;
+    uint64_t word;
+
+    /* Process bytes until the buffer is aligned for the 8-byte loop */
+    while (len && ((uintptr_t)buf & 7) != 0) {
+        c = table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+        len--;
+    }
+
+    while (len >= 8) {
+        memcpy(&word, buf, sizeof(word));
+#if BYTE_ORDER == BIG_ENDIAN
+        word = ZSWAP64(word);
+#endif
+        c ^= word;
+        c = table[7][c & 0xff] ^ table[6][(c >> 8) & 0xff] ^
+            table[5][(c >> 16) & 0xff] ^ table[4][(c >> 24) & 0xff] ^
+            table[3][(c >> 32) & 0xff] ^ table[2][(c >> 40) & 0xff] ^
+            table[1][(c >> 48) & 0xff] ^ table[0][c >> 56];
+        buf += 8;
+        len -= 8;
+    }
+
+    while (len) {
+        c = table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+        len--;
+    }
+
+    return ~c;
+}
+
+Z_INTERNAL uint64_t crc64_c(uint64_t crc, const uint8_t *buf, size_t len) {
+    return crc64_slice8(crc, buf, len, crc64_table);
+}
+
+Z_INTERNAL uint64_t crc64_nvme_c(uint64_t crc, const uint8_t *buf, size_t len) {
+    return crc64_slice8(crc, buf, len, crc64_nvme_table);
+}
+
+Z_INTERNAL uint64_t crc64_fold_copy_c(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    crc = FUNCTABLE_CALL(crc64)(crc, src, len);
+    memcpy(dst, src, len);
+    return crc;
+}
+
+Z_INTERNAL uint64_t crc64_nvme_fold_copy_c(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    crc = FUNCTABLE_CALL(crc64_nvme)(crc, src, len);
+    memcpy(dst, src, len);
+    return crc;
+}
@@ -12,12 +12,26 @@ Z_INTERNAL void     crc32_fold_copy_c(crc32_fold *crc, uint8_t *dst, const uint8
 Z_INTERNAL void     crc32_fold_c(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 Z_INTERNAL uint32_t crc32_fold_final_c(crc32_fold *crc);
 
+Z_INTERNAL uint32_t crc32c_fold_copy_c(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+
+Z_INTERNAL uint64_t crc64_c(uint64_t crc, const uint8_t *buf, size_t len);
+Z_INTERNAL uint64_t crc64_nvme_c(uint64_t crc, const uint8_t *buf, size_t len);
+Z_INTERNAL uint64_t crc64_fold_copy_c(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+Z_INTERNAL uint64_t crc64_nvme_fold_copy_c(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+
 Z_INTERNAL uint32_t adler32_fold_copy_c(uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
 
+/* Number of buffers that the multi-buffer crc32 functions process at once, each at least 16 bytes */
+#define CHECKSUM_MULTI_LANES 4
+
+Z_INTERNAL void     crc32_multi_c(uint32_t *crc, const uint8_t *const *buf, const size_t *len);
+
 
 typedef uint32_t (*adler32_func)(uint32_t adler, const uint8_t *buf, size_t len);
 typedef uint32_t (*compare256_func)(const uint8_t *src0, const uint8_t *src1);
 typedef uint32_t (*crc32_func)(uint32_t crc32, const uint8_t *buf, size_t len);
+typedef uint64_t (*crc64_func)(uint64_t crc, const uint8_t *buf, size_t len);
+typedef void     (*checksum_multi_func)(uint32_t *check, const uint8_t *const *buf, const size_t *len);
 
 uint32_t adler32_c(uint32_t adler, const uint8_t *buf, size_t len);
 
@@ -26,6 +40,7 @@ uint8_t* chunkmemset_safe_c(uint8_t *out, uint8_t *from, unsigned len, unsigned
 void     inflate_fast_c(PREFIX3(stream) *strm, uint32_t start);
 
 uint32_t PREFIX(crc32_braid)(uint32_t crc, const uint8_t *buf, size_t len);
+uint32_t crc32c_braid(uint32_t crc, const uint8_t *buf, size_t len);
 
 uint32_t compare256_c(const uint8_t *src0, const uint8_t *src1);
 #if defined(UNALIGNED_OK) && BYTE_ORDER == LITTLE_ENDIAN
@@ -96,7 +111,15 @@ uint32_t longest_match_slow_c(deflate_state *const s, Pos cur_match);
 #  define native_crc32_fold_copy crc32_fold_copy_c
 #  define native_crc32_fold_final crc32_fold_final_c
 #  define native_crc32_fold_reset crc32_fold_reset_c
+#  define native_crc32_multi crc32_multi_c
+#  define native_crc32c crc32c_braid
+#  define native_crc32c_fold_copy crc32c_fold_copy_c
+#  define native_crc64 crc64_c
+#  define native_crc64_fold_copy crc64_fold_copy_c
+#  define native_crc64_nvme crc64_nvme_c
+#  define native_crc64_nvme_fold_copy crc64_nvme_fold_copy_c
 #  define native_inflate_fast inflate_fast_c
+#  define native_insert_string insert_string
 #  define native_slide_hash slide_hash_c
 #  define native_longest_match longest_match_generic
 #  define native_longest_match_slow longest_match_slow_generic
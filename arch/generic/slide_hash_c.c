@@ -12,7 +12,7 @@
  * bit values at the expense of memory usage). We slide even when level == 0 to
  * keep the hash table consistent if we switch back to level > 0 later.
  */
-static inline void slide_hash_c_chain(Pos *table, uint32_t entries, uint16_t wsize) {
+static inline void slide_hash_c_chain(Pos *table, uint32_t entries, Pos wsize) {
 #ifdef NOT_TWEAK_COMPILER
     table += entries;
     do {
@@ -45,8 +45,10 @@ static inline void slide_hash_c_chain(Pos *table, uint32_t entries, uint16_t wsi
 }
 
 Z_INTERNAL void slide_hash_c(deflate_state *s) {
-    uint16_t wsize = (uint16_t)s->w_size;
+    Pos slide = (Pos)WINDOW_SLIDE(s);
 
-    slide_hash_c_chain(s->head, HASH_SIZE, wsize);
-    slide_hash_c_chain(s->prev, wsize, wsize);
+    slide_hash_c_chain(s->head, HASH_SIZE, slide);
+    /* Streams that only use head[] are allocated without prev[] */
+    if (s->prev != NULL)
+        slide_hash_c_chain(s->prev, s->w_size, slide);
 }
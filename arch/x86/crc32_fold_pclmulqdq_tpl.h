@@ -103,6 +103,19 @@ Z_INTERNAL void CRC32_FOLD(crc32_fold *crc, const uint8_t *src, size_t len, uint
         len -= n;
         src += n;
     }
+#elif defined(X86_VPCLMULQDQ_AVX2)
+    if (len >= 128) {
+#ifdef COPY
+        size_t n = fold_8_vpclmulqdq_avx2_copy(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3, dst, src, len);
+        dst += n;
+#else
+        size_t n = fold_8_vpclmulqdq_avx2(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3, src, len,
+            xmm_initial, first);
+        first = 0;
+#endif
+        len -= n;
+        src += n;
+    }
 #endif
 
     while (len >= 64) {
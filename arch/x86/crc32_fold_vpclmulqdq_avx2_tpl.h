@@ -0,0 +1,106 @@
+/* crc32_fold_vpclmulqdq_avx2_tpl.h -- 256-bit VPCMULQDQ-based CRC32 folding template.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* Same algorithm as crc32_fold_vpclmulqdq_tpl.h, but with four YMM registers folding 128 bytes per
+ * iteration, so that CPUs with VPCLMULQDQ and AVX2 but without AVX-512 can use it. */
+
+#ifdef COPY
+static size_t fold_8_vpclmulqdq_avx2_copy(__m128i *xmm_crc0, __m128i *xmm_crc1,
+    __m128i *xmm_crc2, __m128i *xmm_crc3, uint8_t *dst, const uint8_t *src, size_t len) {
+#else
+static size_t fold_8_vpclmulqdq_avx2(__m128i *xmm_crc0, __m128i *xmm_crc1,
+    __m128i *xmm_crc2, __m128i *xmm_crc3, const uint8_t *src, size_t len,
+    __m128i init_crc, int32_t first) {
+    __m256i ymm_initial = _mm256_inserti128_si256(_mm256_setzero_si256(), init_crc, 0);
+#endif
+    __m256i ymm_t0, ymm_t1, ymm_t2, ymm_t3;
+    __m256i ymm_crc0, ymm_crc1, ymm_crc2, ymm_crc3;
+    __m256i y0, y1, y2, y3;
+    size_t len_tmp = len;
+    const __m256i ymm_fold4 = _mm256_set_epi32(
+        0x00000001, 0x54442bd4, 0x00000001, 0xc6e41596,
+        0x00000001, 0x54442bd4, 0x00000001, 0xc6e41596);
+    const __m256i ymm_fold8 = _mm256_set_epi32(
+        0x00000001, 0xe88ef372, 0x00000001, 0x4a7fe880,
+        0x00000001, 0xe88ef372, 0x00000001, 0x4a7fe880);
+
+    // ymm register init
+    ymm_t0 = _mm256_loadu_si256((__m256i *)src);
+#ifndef COPY
+    XOR_INITIAL256(ymm_t0);
+#endif
+    ymm_t1 = _mm256_loadu_si256((__m256i *)src + 1);
+    ymm_crc2 = _mm256_loadu_si256((__m256i *)src + 2);
+    ymm_crc3 = _mm256_loadu_si256((__m256i *)src + 3);
+
+    /* already have intermediate CRC in xmm registers
+     * fold4 with 4 xmm_crc into the first two ymm of data
+     */
+    ymm_crc0 = _mm256_inserti128_si256(_mm256_castsi128_si256(*xmm_crc0), *xmm_crc1, 1);
+    ymm_crc1 = _mm256_inserti128_si256(_mm256_castsi128_si256(*xmm_crc2), *xmm_crc3, 1);
+    y0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold4, 0x01);
+    y1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold4, 0x01);
+    ymm_crc0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold4, 0x10);
+    ymm_crc1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold4, 0x10);
+    ymm_crc0 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc0, y0), ymm_t0);
+    ymm_crc1 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc1, y1), ymm_t1);
+
+#ifdef COPY
+    _mm256_storeu_si256((__m256i *)dst, ymm_t0);
+    _mm256_storeu_si256((__m256i *)dst + 1, ymm_t1);
+    _mm256_storeu_si256((__m256i *)dst + 2, ymm_crc2);
+    _mm256_storeu_si256((__m256i *)dst + 3, ymm_crc3);
+    dst += 128;
+#endif
+    len -= 128;
+    src += 128;
+
+    // fold-8 loops
+    while (len >= 128) {
+        ymm_t0 = _mm256_loadu_si256((__m256i *)src);
+        ymm_t1 = _mm256_loadu_si256((__m256i *)src + 1);
+        ymm_t2 = _mm256_loadu_si256((__m256i *)src + 2);
+        ymm_t3 = _mm256_loadu_si256((__m256i *)src + 3);
+
+        y0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold8, 0x01);
+        y1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold8, 0x01);
+        y2 = _mm256_clmulepi64_epi128(ymm_crc2, ymm_fold8, 0x01);
+        y3 = _mm256_clmulepi64_epi128(ymm_crc3, ymm_fold8, 0x01);
+
+        ymm_crc0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold8, 0x10);
+        ymm_crc1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold8, 0x10);
+        ymm_crc2 = _mm256_clmulepi64_epi128(ymm_crc2, ymm_fold8, 0x10);
+        ymm_crc3 = _mm256_clmulepi64_epi128(ymm_crc3, ymm_fold8, 0x10);
+
+        ymm_crc0 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc0, y0), ymm_t0);
+        ymm_crc1 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc1, y1), ymm_t1);
+        ymm_crc2 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc2, y2), ymm_t2);
+        ymm_crc3 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc3, y3), ymm_t3);
+
+#ifdef COPY
+        _mm256_storeu_si256((__m256i *)dst, ymm_t0);
+        _mm256_storeu_si256((__m256i *)dst + 1, ymm_t1);
+        _mm256_storeu_si256((__m256i *)dst + 2, ymm_t2);
+        _mm256_storeu_si256((__m256i *)dst + 3, ymm_t3);
+        dst += 128;
+#endif
+        len -= 128;
+        src += 128;
+    }
+    // ymm_crc[0,1,2,3] -> ymm_crc[0,1]
+    y0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold4, 0x01);
+    y1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold4, 0x01);
+    ymm_crc0 = _mm256_clmulepi64_epi128(ymm_crc0, ymm_fold4, 0x10);
+    ymm_crc1 = _mm256_clmulepi64_epi128(ymm_crc1, ymm_fold4, 0x10);
+    ymm_crc0 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc0, y0), ymm_crc2);
+    ymm_crc1 = _mm256_xor_si256(_mm256_xor_si256(ymm_crc1, y1), ymm_crc3);
+
+    // ymm_crc[0,1] -> xmm_crc[0, 1, 2, 3]
+    *xmm_crc0 = _mm256_castsi256_si128(ymm_crc0);
+    *xmm_crc1 = _mm256_extracti128_si256(ymm_crc0, 1);
+    *xmm_crc2 = _mm256_castsi256_si128(ymm_crc1);
+    *xmm_crc3 = _mm256_extracti128_si256(ymm_crc1, 1);
+
+    return (len_tmp - len);  // return n bytes processed
+}
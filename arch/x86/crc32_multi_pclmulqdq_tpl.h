@@ -0,0 +1,253 @@
+/* crc32_multi_pclmulqdq_tpl.h -- compute the CRC32 of several buffers at once
+ * with carry-less multiplication
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Four buffers, one per lane, are folded side by side in a register each, so
+ * that the multiplications of the different buffers are independent and overlap
+ * in the pipeline. Buffers that are done before the longest one drop out and
+ * keep their register until the end. Tails shorter than 16 bytes are added with
+ * a byte shuffle instead of the per-length branches of CRC32_FOLD(), which is
+ * what makes short buffers of mixed lengths slow one at a time.
+ */
+
+#include "arch_functions.h"
+
+/* Shuffle controls for moving a register by 0 to 16 bytes, 0x80 selects a zero byte */
+static const uint8_t ALIGNED_(16) crc32_multi_shift[48] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
+/* Move a register 16 bytes further into the message and add the next 16 bytes */
+static inline __m128i crc32_multi_fold(__m128i x, __m128i k, __m128i next) {
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x10);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x01);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+/* Barrett reduction of a single folded register, the same as at the end of CRC32_FOLD_FINAL() */
+static inline uint32_t crc32_multi_reduce(__m128i xmm_crc3) {
+    const __m128i xmm_mask  = _mm_load_si128((__m128i *)crc_mask);
+    const __m128i xmm_mask2 = _mm_load_si128((__m128i *)crc_mask2);
+    __m128i xmm_crc0, xmm_crc1, xmm_crc2, crc_fold;
+
+    crc_fold = _mm_load_si128((__m128i *)(crc_k + 4));
+
+    xmm_crc0 = xmm_crc3;
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0);
+    xmm_crc0 = _mm_srli_si128(xmm_crc0, 8);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc0);
+
+    xmm_crc0 = xmm_crc3;
+    xmm_crc3 = _mm_slli_si128(xmm_crc3, 4);
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0x10);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc0);
+    xmm_crc3 = _mm_and_si128(xmm_crc3, xmm_mask2);
+
+    xmm_crc1 = xmm_crc3;
+    xmm_crc2 = xmm_crc3;
+    crc_fold = _mm_load_si128((__m128i *)(crc_k + 8));
+
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc2);
+    xmm_crc3 = _mm_and_si128(xmm_crc3, xmm_mask);
+
+    xmm_crc2 = xmm_crc3;
+    xmm_crc3 = _mm_clmulepi64_si128(xmm_crc3, crc_fold, 0x10);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc2);
+    xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_crc1);
+
+    return ~((uint32_t)_mm_extract_epi32(xmm_crc3, 2));
+}
+
+/* Add the tail by splitting register and tail into the first tail bytes, padded with leading zeros which
+   do not change the crc, and the next 16 bytes, which end with the last 16 bytes of the buffer, then
+   folding the first onto the second. A lane without a tail folds zero onto itself. */
+static inline uint32_t crc32_multi_finish(__m128i xmm_crc, __m128i fold1, const uint8_t *buf, size_t len) {
+    size_t tail = len % 16;
+    __m128i xmm_ctrl = _mm_loadu_si128((const __m128i *)(crc32_multi_shift + 16 + tail));
+    __m128i xmm_last = _mm_loadu_si128((const __m128i *)(buf + len - 16));
+    __m128i xmm_head = _mm_shuffle_epi8(xmm_crc, _mm_loadu_si128((const __m128i *)(crc32_multi_shift + tail)));
+
+    xmm_last = _mm_blendv_epi8(_mm_shuffle_epi8(xmm_crc, xmm_ctrl), xmm_last, xmm_ctrl);
+    return crc32_multi_reduce(crc32_multi_fold(xmm_head, fold1, xmm_last));
+}
+
+static inline void crc32_multi_128(uint32_t *crc, const uint8_t *const *buf, const size_t *len) {
+    const __m128i fold1 = _mm_load_si128((__m128i *)crc_k);
+    __m128i xmm_crc0, xmm_crc1, xmm_crc2, xmm_crc3;
+    size_t pos, steps;
+
+    /* The inverted initial crc is added to the first bytes, so that folding starts from zero */
+    xmm_crc0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)buf[0]), _mm_cvtsi32_si128((int32_t)~crc[0]));
+    xmm_crc1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)buf[1]), _mm_cvtsi32_si128((int32_t)~crc[1]));
+    xmm_crc2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)buf[2]), _mm_cvtsi32_si128((int32_t)~crc[2]));
+    xmm_crc3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)buf[3]), _mm_cvtsi32_si128((int32_t)~crc[3]));
+    steps = MAX(MAX(len[0], len[1]), MAX(len[2], len[3])) / 16 - 1;
+
+    /* Fold 16 bytes at a time in a register per lane, lanes drop out once they are out of full blocks */
+    for (pos = 16; steps > 0; steps--, pos += 16) {
+        if (pos + 16 <= len[0])
+            xmm_crc0 = crc32_multi_fold(xmm_crc0, fold1, _mm_loadu_si128((const __m128i *)(buf[0] + pos)));
+        if (pos + 16 <= len[1])
+            xmm_crc1 = crc32_multi_fold(xmm_crc1, fold1, _mm_loadu_si128((const __m128i *)(buf[1] + pos)));
+        if (pos + 16 <= len[2])
+            xmm_crc2 = crc32_multi_fold(xmm_crc2, fold1, _mm_loadu_si128((const __m128i *)(buf[2] + pos)));
+        if (pos + 16 <= len[3])
+            xmm_crc3 = crc32_multi_fold(xmm_crc3, fold1, _mm_loadu_si128((const __m128i *)(buf[3] + pos)));
+    }
+
+    crc[0] = crc32_multi_finish(xmm_crc0, fold1, buf[0], len[0]);
+    crc[1] = crc32_multi_finish(xmm_crc1, fold1, buf[1], len[1]);
+    crc[2] = crc32_multi_finish(xmm_crc2, fold1, buf[2], len[2]);
+    crc[3] = crc32_multi_finish(xmm_crc3, fold1, buf[3], len[3]);
+}
+
+#ifdef X86_VPCLMULQDQ
+/* Lanes that have no more full blocks load from here when folding all lanes in one register */
+static const uint8_t ALIGNED_(16) crc32_multi_zero[16] = { 0 };
+
+static inline __m512i crc32_multi_fold_512(__m512i z, __m512i k, __m512i next) {
+    __m512i lo = _mm512_clmulepi64_epi128(z, k, 0x10);
+    __m512i hi = _mm512_clmulepi64_epi128(z, k, 0x01);
+    return _mm512_ternarylogic_epi32(lo, hi, next, 0x96);
+}
+
+/* Gather 16 bytes of each lane into one register, lane i in 128-bit lane i */
+static inline __m512i crc32_multi_load4(const uint8_t *const *src) {
+    __m512i z = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *)src[0]));
+    z = _mm512_inserti32x4(z, _mm_loadu_si128((const __m128i *)src[1]), 1);
+    z = _mm512_inserti32x4(z, _mm_loadu_si128((const __m128i *)src[2]), 2);
+    return _mm512_inserti32x4(z, _mm_loadu_si128((const __m128i *)src[3]), 3);
+}
+
+/* Start a lane with the inverted initial crc added to the first bytes. Lanes shorter than 64 bytes
+   start with a single block in the last 128-bit lane, which the folds into one register pass through
+   unchanged. */
+static inline __m512i crc32_multi_start_512(uint32_t crc, const uint8_t *buf, size_t len, size_t *pos) {
+    __m128i xmm_init = _mm_cvtsi32_si128((int32_t)~crc);
+
+    if (len >= 64) {
+        *pos = 64;
+        return _mm512_xor_si512(_mm512_loadu_si512((const void *)buf), _mm512_zextsi128_si512(xmm_init));
+    }
+    *pos = 16;
+    xmm_init = _mm_xor_si128(xmm_init, _mm_loadu_si128((const __m128i *)buf));
+    return _mm512_inserti32x4(_mm512_setzero_si512(), xmm_init, 3);
+}
+
+/* Each lane folds 64 bytes at a time in a 512-bit register. At the end the registers are transposed
+   so that the remaining blocks, the tails and the Barrett reduction of all lanes share registers. Up
+   to 512 bytes this costs more than it saves, and the 128-bit lanes are used instead. */
+Z_INTERNAL void CRC32_MULTI(uint32_t *crc, const uint8_t *const *buf, const size_t *len) {
+    const __m512i zmm_fold4 = _mm512_set4_epi32(0x00000001, 0x54442bd4, 0x00000001, 0xc6e41596);
+    const __m512i zmm_fold1 = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)crc_k));
+    __m512i zmm_crc0, zmm_crc1, zmm_crc2, zmm_crc3, zmm_t0, zmm_t1, zmm_t2, zmm_t3, zmm_ctrl;
+    const uint8_t *src[CHECKSUM_MULTI_LANES];
+    size_t pos[CHECKSUM_MULTI_LANES], steps = 0;
+    uint32_t ALIGNED_(64) res[16];
+    int i;
+
+    if (MAX(MAX(len[0], len[1]), MAX(len[2], len[3])) < 512) {
+        crc32_multi_128(crc, buf, len);
+        return;
+    }
+
+    zmm_crc0 = crc32_multi_start_512(crc[0], buf[0], len[0], &pos[0]);
+    zmm_crc1 = crc32_multi_start_512(crc[1], buf[1], len[1], &pos[1]);
+    zmm_crc2 = crc32_multi_start_512(crc[2], buf[2], len[2], &pos[2]);
+    zmm_crc3 = crc32_multi_start_512(crc[3], buf[3], len[3], &pos[3]);
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        steps = MAX(steps, (len[i] - pos[i]) / 64);
+
+    /* Lanes drop out once they are out of full 64 byte blocks */
+    while (steps--) {
+        if (pos[0] + 64 <= len[0]) {
+            zmm_crc0 = crc32_multi_fold_512(zmm_crc0, zmm_fold4, _mm512_loadu_si512((const void *)(buf[0] + pos[0])));
+            pos[0] += 64;
+        }
+        if (pos[1] + 64 <= len[1]) {
+            zmm_crc1 = crc32_multi_fold_512(zmm_crc1, zmm_fold4, _mm512_loadu_si512((const void *)(buf[1] + pos[1])));
+            pos[1] += 64;
+        }
+        if (pos[2] + 64 <= len[2]) {
+            zmm_crc2 = crc32_multi_fold_512(zmm_crc2, zmm_fold4, _mm512_loadu_si512((const void *)(buf[2] + pos[2])));
+            pos[2] += 64;
+        }
+        if (pos[3] + 64 <= len[3]) {
+            zmm_crc3 = crc32_multi_fold_512(zmm_crc3, zmm_fold4, _mm512_loadu_si512((const void *)(buf[3] + pos[3])));
+            pos[3] += 64;
+        }
+    }
+
+    /* Transpose so that register k holds the k-th 128-bit lane of every buffer, then fold them into one
+       register with the state of buffer i in 128-bit lane i */
+    zmm_t0 = _mm512_shuffle_i64x2(zmm_crc0, zmm_crc1, 0x44);
+    zmm_t1 = _mm512_shuffle_i64x2(zmm_crc0, zmm_crc1, 0xee);
+    zmm_t2 = _mm512_shuffle_i64x2(zmm_crc2, zmm_crc3, 0x44);
+    zmm_t3 = _mm512_shuffle_i64x2(zmm_crc2, zmm_crc3, 0xee);
+    zmm_crc0 = _mm512_shuffle_i64x2(zmm_t0, zmm_t2, 0x88);
+    zmm_crc1 = _mm512_shuffle_i64x2(zmm_t0, zmm_t2, 0xdd);
+    zmm_crc2 = _mm512_shuffle_i64x2(zmm_t1, zmm_t3, 0x88);
+    zmm_crc3 = _mm512_shuffle_i64x2(zmm_t1, zmm_t3, 0xdd);
+    zmm_crc0 = crc32_multi_fold_512(zmm_crc0, zmm_fold1, zmm_crc1);
+    zmm_crc0 = crc32_multi_fold_512(zmm_crc0, zmm_fold1, zmm_crc2);
+    zmm_crc0 = crc32_multi_fold_512(zmm_crc0, zmm_fold1, zmm_crc3);
+
+    /* Fold the remaining full blocks, at most three per lane, lanes without one keep their state */
+    steps = 0;
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        steps = MAX(steps, (len[i] - pos[i]) / 16);
+    while (steps--) {
+        __mmask8 active = 0;
+        for (i = 0; i < CHECKSUM_MULTI_LANES; i++) {
+            int lane_active = pos[i] + 16 <= len[i];
+            src[i] = lane_active ? buf[i] + pos[i] : crc32_multi_zero;
+            active |= (__mmask8)(lane_active ? 3 << (2 * i) : 0);
+            pos[i] += lane_active ? 16 : 0;
+        }
+        zmm_t0 = crc32_multi_fold_512(zmm_crc0, zmm_fold1, crc32_multi_load4(src));
+        zmm_crc0 = _mm512_mask_mov_epi64(zmm_crc0, active, zmm_t0);
+    }
+
+    /* Add the tails the same way as crc32_multi_finish() does */
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        src[i] = crc32_multi_shift + (len[i] - pos[i]);
+    zmm_t0 = _mm512_shuffle_epi8(zmm_crc0, crc32_multi_load4(src));
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        src[i] = crc32_multi_shift + 16 + (len[i] - pos[i]);
+    zmm_ctrl = crc32_multi_load4(src);
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        src[i] = buf[i] + len[i] - 16;
+    zmm_t1 = _mm512_mask_blend_epi8(_mm512_movepi8_mask(zmm_ctrl), _mm512_shuffle_epi8(zmm_crc0, zmm_ctrl),
+                                    crc32_multi_load4(src));
+    zmm_t0 = crc32_multi_fold_512(zmm_t0, zmm_fold1, zmm_t1);
+
+    /* Barrett reduction of all lanes at once, as in crc32_multi_reduce() */
+    zmm_ctrl = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)(crc_k + 4)));
+    zmm_t1 = _mm512_clmulepi64_epi128(zmm_t0, zmm_ctrl, 0);
+    zmm_t0 = _mm512_xor_si512(zmm_t1, _mm512_bsrli_epi128(zmm_t0, 8));
+
+    zmm_t1 = _mm512_clmulepi64_epi128(_mm512_bslli_epi128(zmm_t0, 4), zmm_ctrl, 0x10);
+    zmm_t0 = _mm512_xor_si512(zmm_t1, zmm_t0);
+    zmm_t0 = _mm512_and_si512(zmm_t0, _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)crc_mask2)));
+
+    zmm_t2 = zmm_t0;
+    zmm_ctrl = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)(crc_k + 8)));
+    zmm_t1 = _mm512_clmulepi64_epi128(zmm_t0, zmm_ctrl, 0);
+    zmm_t1 = _mm512_xor_si512(zmm_t1, zmm_t2);
+    zmm_t1 = _mm512_and_si512(zmm_t1, _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)crc_mask)));
+
+    zmm_t3 = _mm512_clmulepi64_epi128(zmm_t1, zmm_ctrl, 0x10);
+    zmm_t3 = _mm512_ternarylogic_epi32(zmm_t3, zmm_t1, zmm_t2, 0x96);
+
+    _mm512_store_si512((void *)res, zmm_t3);
+    for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+        crc[i] = ~res[4 * i + 2];
+}
+#else
+Z_INTERNAL void CRC32_MULTI(uint32_t *crc, const uint8_t *const *buf, const size_t *len) {
+    crc32_multi_128(crc, buf, len);
+}
+#endif
@@ -22,7 +22,7 @@
 #include <immintrin.h>
 #include <wmmintrin.h>
 #include <smmintrin.h> // _mm_extract_epi32
-#ifdef X86_VPCLMULQDQ
+#if defined(X86_VPCLMULQDQ) || defined(X86_VPCLMULQDQ_AVX2)
 #  include <immintrin.h>
 #endif
 
@@ -38,6 +38,12 @@ static size_t fold_16_vpclmulqdq(__m128i *xmm_crc0, __m128i *xmm_crc1,
     int32_t first);
 static size_t fold_16_vpclmulqdq_copy(__m128i *xmm_crc0, __m128i *xmm_crc1,
     __m128i *xmm_crc2, __m128i *xmm_crc3, uint8_t *dst, const uint8_t *src, size_t len);
+#elif defined(X86_VPCLMULQDQ_AVX2)
+static size_t fold_8_vpclmulqdq_avx2(__m128i *xmm_crc0, __m128i *xmm_crc1,
+    __m128i *xmm_crc2, __m128i *xmm_crc3, const uint8_t *src, size_t len, __m128i init_crc,
+    int32_t first);
+static size_t fold_8_vpclmulqdq_avx2_copy(__m128i *xmm_crc0, __m128i *xmm_crc1,
+    __m128i *xmm_crc2, __m128i *xmm_crc3, uint8_t *dst, const uint8_t *src, size_t len);
 #endif
 
 static void fold_1(__m128i *xmm_crc0, __m128i *xmm_crc1, __m128i *xmm_crc2, __m128i *xmm_crc3) {
@@ -257,15 +263,21 @@ Z_INTERNAL uint32_t CRC32_FOLD_RESET(crc32_fold *crc) {
 #define XOR_INITIAL128(where)    ONCE(where = _mm_xor_si128(where, xmm_initial))
 #ifdef X86_VPCLMULQDQ
 #  define XOR_INITIAL512(where)  ONCE(where = _mm512_xor_si512(where, zmm_initial))
+#elif defined(X86_VPCLMULQDQ_AVX2)
+#  define XOR_INITIAL256(where)  ONCE(where = _mm256_xor_si256(where, ymm_initial))
 #endif
 
 #ifdef X86_VPCLMULQDQ
 #  include "crc32_fold_vpclmulqdq_tpl.h"
+#elif defined(X86_VPCLMULQDQ_AVX2)
+#  include "crc32_fold_vpclmulqdq_avx2_tpl.h"
 #endif
 #include "crc32_fold_pclmulqdq_tpl.h"
 #define COPY
 #ifdef X86_VPCLMULQDQ
 #  include "crc32_fold_vpclmulqdq_tpl.h"
+#elif defined(X86_VPCLMULQDQ_AVX2)
+#  include "crc32_fold_vpclmulqdq_avx2_tpl.h"
 #endif
 #include "crc32_fold_pclmulqdq_tpl.h"
 
@@ -373,3 +385,7 @@ Z_INTERNAL uint32_t CRC32(uint32_t crc32, const uint8_t *buf, size_t len) {
     CRC32_FOLD(&crc_state, buf, len, crc32);
     return CRC32_FOLD_FINAL(&crc_state);
 }
+
+#ifdef CRC32_MULTI
+#  include "crc32_multi_pclmulqdq_tpl.h"
+#endif
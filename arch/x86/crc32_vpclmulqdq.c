@@ -11,6 +11,7 @@
 #define CRC32_FOLD_RESET crc32_fold_vpclmulqdq_reset
 #define CRC32_FOLD_FINAL crc32_fold_vpclmulqdq_final
 #define CRC32            crc32_vpclmulqdq
+#define CRC32_MULTI      crc32_multi_vpclmulqdq
 
 #include "crc32_pclmulqdq_tpl.h"
 
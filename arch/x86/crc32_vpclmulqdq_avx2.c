@@ -0,0 +1,16 @@
+/* crc32_vpclmulqdq_avx2.c -- 256-bit VPCMULQDQ-based CRC32 folding implementation.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_VPCLMULQDQ_AVX2_CRC
+
+#define X86_VPCLMULQDQ_AVX2
+#define CRC32_FOLD_COPY  crc32_fold_vpclmulqdq_avx2_copy
+#define CRC32_FOLD       crc32_fold_vpclmulqdq_avx2
+#define CRC32_FOLD_RESET crc32_fold_vpclmulqdq_avx2_reset
+#define CRC32_FOLD_FINAL crc32_fold_vpclmulqdq_avx2_final
+#define CRC32            crc32_vpclmulqdq_avx2
+
+#include "crc32_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,125 @@
+/* crc32c_sse42.c -- compute the CRC-32C (Castagnoli) of a data stream using
+ * the SSE4.2 crc32 instruction
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The crc32 instruction has a latency of three cycles but can start every
+ * cycle, so longer buffers are split into three lanes that are hashed
+ * independently. The lane CRCs are then merged by shifting them past the
+ * lanes that follow with a carry-less multiplication, which is reduced back
+ * to 32 bits with the crc32 instruction itself.
+ */
+
+#ifdef X86_PCLMULQDQ_CRC
+
+#include "zbuild.h"
+
+#include <immintrin.h>
+#include <wmmintrin.h>
+#include <smmintrin.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+typedef uint64_t crc32c_word_t;
+#  define CRC32C_WORD(crc, word) ((uint32_t)_mm_crc32_u64(crc, word))
+#else
+typedef uint32_t crc32c_word_t;
+#  define CRC32C_WORD(crc, word) _mm_crc32_u32(crc, word)
+#endif
+
+/* Lane lengths in bytes. Long lanes keep the merge cost negligible, short lanes
+ * still get the interleaving for buffers of a few kilobytes. */
+#define CRC32C_LONG  8192
+#define CRC32C_SHORT 256
+
+/* Multipliers that shift a CRC past one and two lanes of zeros, x^(8*n-33) mod p(x)
+ * with n the number of bytes. The 33 accounts for the 32 bits that the crc32
+ * instruction appends and for the one bit that the carry-less product is short. */
+static const uint32_t crc32c_long_k[2]  = { 0x54a86326, 0x1dc403cc };
+static const uint32_t crc32c_short_k[2] = { 0xb9e02b86, 0xdd7e3b0c };
+
+/* Return the CRC of three consecutive lanes of data, given the CRC of the data before them */
+static inline uint32_t crc32c_3way(uint32_t crc0, uint8_t *dst, const uint8_t *src, const size_t lane,
+                                   const uint32_t k[2], const int COPY) {
+    uint32_t crc1 = 0, crc2 = 0;
+    crc32c_word_t word0, word1, word2;
+    __m128i prod0, prod1, prod;
+    size_t i;
+
+    for (i = 0; i < lane; i += sizeof(crc32c_word_t)) {
+        memcpy(&word0, src + i, sizeof(word0));
+        memcpy(&word1, src + lane + i, sizeof(word1));
+        memcpy(&word2, src + 2 * lane + i, sizeof(word2));
+        if (COPY) {
+            memcpy(dst + i, &word0, sizeof(word0));
+            memcpy(dst + lane + i, &word1, sizeof(word1));
+            memcpy(dst + 2 * lane + i, &word2, sizeof(word2));
+        }
+        crc0 = CRC32C_WORD(crc0, word0);
+        crc1 = CRC32C_WORD(crc1, word1);
+        crc2 = CRC32C_WORD(crc2, word2);
+    }
+
+    prod0 = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int32_t)crc0), _mm_cvtsi32_si128((int32_t)k[1]), 0x00);
+    prod1 = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int32_t)crc1), _mm_cvtsi32_si128((int32_t)k[0]), 0x00);
+    prod = _mm_xor_si128(prod0, prod1);
+
+    crc0 = _mm_crc32_u32(0, (uint32_t)_mm_cvtsi128_si32(prod));
+    crc0 = _mm_crc32_u32(crc0, (uint32_t)_mm_extract_epi32(prod, 1));
+    return crc0 ^ crc2;
+}
+
+static inline uint32_t crc32c_impl(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len, const int COPY) {
+    crc32c_word_t word;
+    uint32_t c = ~crc;
+
+    /* Hash bytes until the source is word aligned */
+    while (len && ((uintptr_t)src & (sizeof(crc32c_word_t) - 1)) != 0) {
+        if (COPY)
+            *dst++ = *src;
+        c = _mm_crc32_u8(c, *src++);
+        len--;
+    }
+
+    while (len >= 3 * CRC32C_LONG) {
+        c = crc32c_3way(c, dst, src, CRC32C_LONG, crc32c_long_k, COPY);
+        if (COPY)
+            dst += 3 * CRC32C_LONG;
+        src += 3 * CRC32C_LONG;
+        len -= 3 * CRC32C_LONG;
+    }
+    while (len >= 3 * CRC32C_SHORT) {
+        c = crc32c_3way(c, dst, src, CRC32C_SHORT, crc32c_short_k, COPY);
+        if (COPY)
+            dst += 3 * CRC32C_SHORT;
+        src += 3 * CRC32C_SHORT;
+        len -= 3 * CRC32C_SHORT;
+    }
+
+    while (len >= sizeof(crc32c_word_t)) {
+        memcpy(&word, src, sizeof(word));
+        if (COPY) {
+            memcpy(dst, &word, sizeof(word));
+            dst += sizeof(word);
+        }
+        c = CRC32C_WORD(c, word);
+        src += sizeof(word);
+        len -= sizeof(word);
+    }
+    while (len) {
+        if (COPY)
+            *dst++ = *src;
+        c = _mm_crc32_u8(c, *src++);
+        len--;
+    }
+
+    return ~c;
+}
+
+Z_INTERNAL uint32_t crc32c_sse42(uint32_t crc, const uint8_t *buf, size_t len) {
+    return crc32c_impl(crc, NULL, buf, len, 0);
+}
+
+Z_INTERNAL uint32_t crc32c_fold_copy_sse42(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    return crc32c_impl(crc, dst, src, len, 1);
+}
+
+#endif
@@ -0,0 +1,14 @@
+/* crc64_pclmulqdq.c -- PCLMULQDQ-based CRC-64 folding implementation
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_PCLMULQDQ_CRC
+
+#define CRC64                crc64_pclmulqdq
+#define CRC64_FOLD_COPY      crc64_fold_copy_pclmulqdq
+#define CRC64_NVME           crc64_nvme_pclmulqdq
+#define CRC64_NVME_FOLD_COPY crc64_nvme_fold_copy_pclmulqdq
+
+#include "crc64_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,185 @@
+/* crc64_pclmulqdq_tpl.h -- compute the CRC-64 of a data stream by folding with
+ * carry-less multiplication
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The input is folded 16 bytes at a time, in four interleaved lanes of 128-bit
+ * registers (or sixteen lanes in four 512-bit registers with VPCLMULQDQ). In
+ * the reflected bit order that the CRC uses, a 128-bit register r = lo:hi is
+ * moved D bits further into the message with
+ *
+ *     r' = clmul(lo, x^(D+63) mod p(x)) ^ clmul(hi, x^(D-1) mod p(x))
+ *
+ * which leaves the CRC of the data unchanged. Once the lanes are folded into a
+ * single register, its 16 bytes and the remaining tail are handed to the table
+ * based implementation, which saves a Barrett reduction for the two
+ * polynomials and costs only a few lookups.
+ */
+
+#include "zbuild.h"
+
+#include <immintrin.h>
+#include <wmmintrin.h>
+#include "arch_functions.h"
+#include "x86_intrins.h"
+
+/* Multipliers for the folding distances of 16, 64 and 256 bytes */
+typedef struct crc64_fold_consts_s {
+    uint64_t fold1[2];
+    uint64_t fold4[2];
+    uint64_t fold16[2];
+} crc64_fold_consts;
+
+static const crc64_fold_consts crc64_xz_consts = {
+    { 0xe05dd497ca393ae4, 0xdabe95afc7875f40 },
+    { 0x6ae3efbb9dd441f3, 0x081f6054a7842df4 },
+    { 0x8260adf2381ad81c, 0xf31fd9271e228b79 }
+};
+
+static const crc64_fold_consts crc64_nvme_consts = {
+    { 0xeadc41fd2ba3d420, 0x21e9761e252621ac },
+    { 0x0c32cdb31e18a84a, 0x62242240ace5045a },
+    { 0x37ccd3e14069cabc, 0xa043808c0f782663 }
+};
+
+/* Buffers shorter than one round of four lanes go straight to the tables */
+#define CRC64_FOLD_MIN 64
+
+static inline __m128i crc64_fold_128(__m128i x, __m128i k, __m128i next) {
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+/* Load 16 bytes at the offset and store them to dst as well when copying */
+static inline __m128i crc64_load_128(uint8_t *dst, const uint8_t *src, size_t offset, const int COPY) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(src + offset));
+    if (COPY)
+        _mm_storeu_si128((__m128i *)(dst + offset), x);
+    return x;
+}
+
+#ifdef X86_VPCLMULQDQ
+static inline __m512i crc64_fold_512(__m512i x, __m512i k, __m512i next) {
+    __m512i lo = _mm512_clmulepi64_epi128(x, k, 0x00);
+    __m512i hi = _mm512_clmulepi64_epi128(x, k, 0x11);
+    return _mm512_ternarylogic_epi32(lo, hi, next, 0x96);
+}
+
+static inline __m512i crc64_load_512(uint8_t *dst, const uint8_t *src, size_t offset, const int COPY) {
+    __m512i z = _mm512_loadu_si512((const void *)(src + offset));
+    if (COPY)
+        _mm512_storeu_si512((void *)(dst + offset), z);
+    return z;
+}
+#endif
+
+static inline uint64_t crc64_impl(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len,
+                                  const crc64_fold_consts *consts, crc64_func crc64_tbl, const int COPY) {
+    uint8_t last[32];
+    __m128i x0, x1, x2, x3, k;
+    __m128i init = _mm_set_epi64x(0, (int64_t)~crc);
+
+    if (len < CRC64_FOLD_MIN) {
+        crc = crc64_tbl(crc, src, len);
+        if (COPY)
+            memcpy(dst, src, len);
+        return crc;
+    }
+
+#ifdef X86_VPCLMULQDQ
+    if (len >= 256) {
+        __m512i z0, z1, z2, z3, zk;
+
+        z0 = crc64_load_512(dst, src, 0, COPY);
+        z1 = crc64_load_512(dst, src, 64, COPY);
+        z2 = crc64_load_512(dst, src, 128, COPY);
+        z3 = crc64_load_512(dst, src, 192, COPY);
+        z0 = _mm512_xor_si512(z0, _mm512_zextsi128_si512(init));
+        if (COPY)
+            dst += 256;
+        src += 256;
+        len -= 256;
+
+        zk = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)consts->fold16));
+        while (len >= 256) {
+            z0 = crc64_fold_512(z0, zk, crc64_load_512(dst, src, 0, COPY));
+            z1 = crc64_fold_512(z1, zk, crc64_load_512(dst, src, 64, COPY));
+            z2 = crc64_fold_512(z2, zk, crc64_load_512(dst, src, 128, COPY));
+            z3 = crc64_fold_512(z3, zk, crc64_load_512(dst, src, 192, COPY));
+            if (COPY)
+                dst += 256;
+            src += 256;
+            len -= 256;
+        }
+
+        /* Fold the four registers into one, which leaves four consecutive lanes */
+        zk = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)consts->fold4));
+        z0 = crc64_fold_512(z0, zk, z1);
+        z0 = crc64_fold_512(z0, zk, z2);
+        z0 = crc64_fold_512(z0, zk, z3);
+
+        x0 = _mm512_extracti32x4_epi32(z0, 0);
+        x1 = _mm512_extracti32x4_epi32(z0, 1);
+        x2 = _mm512_extracti32x4_epi32(z0, 2);
+        x3 = _mm512_extracti32x4_epi32(z0, 3);
+    } else
+#endif
+    {
+        x0 = crc64_load_128(dst, src, 0, COPY);
+        x1 = crc64_load_128(dst, src, 16, COPY);
+        x2 = crc64_load_128(dst, src, 32, COPY);
+        x3 = crc64_load_128(dst, src, 48, COPY);
+        x0 = _mm_xor_si128(x0, init);
+        if (COPY)
+            dst += 64;
+        src += 64;
+        len -= 64;
+    }
+
+    k = _mm_loadu_si128((const __m128i *)consts->fold4);
+    while (len >= 64) {
+        x0 = crc64_fold_128(x0, k, crc64_load_128(dst, src, 0, COPY));
+        x1 = crc64_fold_128(x1, k, crc64_load_128(dst, src, 16, COPY));
+        x2 = crc64_fold_128(x2, k, crc64_load_128(dst, src, 32, COPY));
+        x3 = crc64_fold_128(x3, k, crc64_load_128(dst, src, 48, COPY));
+        if (COPY)
+            dst += 64;
+        src += 64;
+        len -= 64;
+    }
+
+    k = _mm_loadu_si128((const __m128i *)consts->fold1);
+    x0 = crc64_fold_128(x0, k, x1);
+    x0 = crc64_fold_128(x0, k, x2);
+    x0 = crc64_fold_128(x0, k, x3);
+    while (len >= 16) {
+        x0 = crc64_fold_128(x0, k, crc64_load_128(dst, src, 0, COPY));
+        if (COPY)
+            dst += 16;
+        src += 16;
+        len -= 16;
+    }
+
+    /* The folded register is already conditioned, so start the tables from a zero register */
+    _mm_storeu_si128((__m128i *)last, x0);
+    memcpy(last + 16, src, len);
+    if (COPY)
+        memcpy(dst, src, len);
+    return crc64_tbl(~(uint64_t)0, last, 16 + len);
+}
+
+Z_INTERNAL uint64_t CRC64(uint64_t crc, const uint8_t *buf, size_t len) {
+    return crc64_impl(crc, NULL, buf, len, &crc64_xz_consts, crc64_c, 0);
+}
+
+Z_INTERNAL uint64_t CRC64_FOLD_COPY(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    return crc64_impl(crc, dst, src, len, &crc64_xz_consts, crc64_c, 1);
+}
+
+Z_INTERNAL uint64_t CRC64_NVME(uint64_t crc, const uint8_t *buf, size_t len) {
+    return crc64_impl(crc, NULL, buf, len, &crc64_nvme_consts, crc64_nvme_c, 0);
+}
+
+Z_INTERNAL uint64_t CRC64_NVME_FOLD_COPY(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    return crc64_impl(crc, dst, src, len, &crc64_nvme_consts, crc64_nvme_c, 1);
+}
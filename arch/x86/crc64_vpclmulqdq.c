@@ -0,0 +1,15 @@
+/* crc64_vpclmulqdq.c -- VPCLMULQDQ-based CRC-64 folding implementation
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_VPCLMULQDQ_CRC
+
+#define X86_VPCLMULQDQ
+#define CRC64                crc64_vpclmulqdq
+#define CRC64_FOLD_COPY      crc64_fold_copy_vpclmulqdq
+#define CRC64_NVME           crc64_nvme_vpclmulqdq
+#define CRC64_NVME_FOLD_COPY crc64_nvme_fold_copy_vpclmulqdq
+
+#include "crc64_pclmulqdq_tpl.h"
+
+#endif
@@ -0,0 +1,65 @@
+/* insert_string_avx2.c -- AVX2 batched hash insertion
+ *
+ * Computes the integer hash for 8 consecutive positions at a time and then
+ * links them into the hash chains in order, prefetching the head[] buckets
+ * of the next batch while the current one is being linked.
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef X86_AVX2
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "insert_string_p.h"
+
+#include <immintrin.h>
+
+/* Minimum number of remaining positions for which a 16-byte load stays within
+ * the bytes that insert_string() itself reads (4 bytes per position). */
+#define BATCH_MIN_LEN (16 - sizeof(uint32_t) + 1)
+
+/* Hash the 8 positions starting at p. The 16 bytes at p are broadcast to both
+ * lanes and shuffled into the little-endian 32-bit words p[0..3] .. p[7..10]. */
+static inline __m256i hash8(const uint8_t *p, const __m256i shuf, const __m256i mult, const __m256i mask) {
+    __m256i val = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)p));
+    val = _mm256_shuffle_epi8(val, shuf);
+    val = _mm256_srli_epi32(_mm256_mullo_epi32(val, mult), HASH_SLIDE);
+    return _mm256_and_si256(val, mask);
+}
+
+Z_INTERNAL void insert_string_avx2(deflate_state *const s, uint32_t str, uint32_t count) {
+    ALIGNED_(32) uint32_t hashes[2][8];
+    const uint8_t *strstart = s->window + str;
+    uint32_t done = 0;
+    int cur = 0;
+
+    if (count >= BATCH_MIN_LEN) {
+        const __m256i shuf = _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6,
+                                              4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10);
+        const __m256i mult = _mm256_set1_epi32((int)HASH_MULTIPLIER);
+        const __m256i mask = _mm256_set1_epi32(HASH_MASK);
+        int more;
+
+        _mm256_store_si256((__m256i *)hashes[cur], hash8(strstart, shuf, mult, mask));
+        do {
+            more = count - done >= 8 + BATCH_MIN_LEN;
+            if (more) {
+                /* Start on the next batch so its head[] buckets are in cache by the time they are linked */
+                uint32_t *next = hashes[cur ^ 1];
+                _mm256_store_si256((__m256i *)next, hash8(strstart + done + 8, shuf, mult, mask));
+                for (int i = 0; i < 8; i++)
+                    PREFETCH_RW(&s->head[next[i]]);
+            }
+            for (int i = 0; i < 8; i++)
+                insert_string_link(s, hashes[cur][i], (Pos)(str + done + i));
+            done += 8;
+            cur ^= 1;
+        } while (more);
+    }
+
+    if (done < count)
+        insert_string(s, str + done, count - done);
+}
+
+#endif
@@ -90,6 +90,8 @@ void Z_INTERNAL x86_check_features(struct x86_cpu_features *features) {
 
         // check BMI1 bit
         // Reference: https://software.intel.com/sites/default/files/article/405250/how-to-detect-new-instruction-support-in-the-4th-generation-intel-core-processor-family.pdf
+        // check VPCLMULQDQ bit, which is reported independently of AVX-512: the YMM form only needs AVX2
+        // as well, while the ZMM form needs AVX-512
         features->has_vpclmulqdq = ecx & 0x400;
 
         // check AVX2 bit if the OS supports saving YMM registers
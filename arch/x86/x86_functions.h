@@ -34,6 +34,7 @@ uint32_t adler32_avx2(uint32_t adler, const uint8_t *buf, size_t len);
 uint32_t adler32_fold_copy_avx2(uint32_t adler, uint8_t *dst, const uint8_t *src, size_t len);
 uint32_t chunksize_avx2(void);
 uint8_t* chunkmemset_safe_avx2(uint8_t *out, uint8_t *from, unsigned len, unsigned left);
+void insert_string_avx2(deflate_state *const s, uint32_t str, uint32_t count);
 
 #  ifdef HAVE_BUILTIN_CTZ
     uint32_t compare256_avx2(const uint8_t *src0, const uint8_t *src1);
@@ -58,6 +59,13 @@ void     crc32_fold_pclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t
 void     crc32_fold_pclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 uint32_t crc32_fold_pclmulqdq_final(crc32_fold *crc);
 uint32_t crc32_pclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+void     crc32_multi_pclmulqdq(uint32_t *crc, const uint8_t *const *buf, const size_t *len);
+uint32_t crc32c_sse42(uint32_t crc, const uint8_t *buf, size_t len);
+uint32_t crc32c_fold_copy_sse42(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+uint64_t crc64_pclmulqdq(uint64_t crc, const uint8_t *buf, size_t len);
+uint64_t crc64_fold_copy_pclmulqdq(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+uint64_t crc64_nvme_pclmulqdq(uint64_t crc, const uint8_t *buf, size_t len);
+uint64_t crc64_nvme_fold_copy_pclmulqdq(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
 #endif
 #ifdef X86_VPCLMULQDQ_CRC
 uint32_t crc32_fold_vpclmulqdq_reset(crc32_fold *crc);
@@ -65,6 +73,18 @@ void     crc32_fold_vpclmulqdq_copy(crc32_fold *crc, uint8_t *dst, const uint8_t
 void     crc32_fold_vpclmulqdq(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
 uint32_t crc32_fold_vpclmulqdq_final(crc32_fold *crc);
 uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
+void     crc32_multi_vpclmulqdq(uint32_t *crc, const uint8_t *const *buf, const size_t *len);
+uint64_t crc64_vpclmulqdq(uint64_t crc, const uint8_t *buf, size_t len);
+uint64_t crc64_fold_copy_vpclmulqdq(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+uint64_t crc64_nvme_vpclmulqdq(uint64_t crc, const uint8_t *buf, size_t len);
+uint64_t crc64_nvme_fold_copy_vpclmulqdq(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+#endif
+#ifdef X86_VPCLMULQDQ_AVX2_CRC
+uint32_t crc32_fold_vpclmulqdq_avx2_reset(crc32_fold *crc);
+void     crc32_fold_vpclmulqdq_avx2_copy(crc32_fold *crc, uint8_t *dst, const uint8_t *src, size_t len);
+void     crc32_fold_vpclmulqdq_avx2(crc32_fold *crc, const uint8_t *src, size_t len, uint32_t init_crc);
+uint32_t crc32_fold_vpclmulqdq_avx2_final(crc32_fold *crc);
+uint32_t crc32_vpclmulqdq_avx2(uint32_t crc32, const uint8_t *buf, size_t len);
 #endif
 
 
@@ -115,6 +135,22 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #  define native_crc32_fold_final crc32_fold_pclmulqdq_final
 #  undef native_crc32_fold_reset
 #  define native_crc32_fold_reset crc32_fold_pclmulqdq_reset
+#  undef native_crc32_multi
+#  define native_crc32_multi crc32_multi_pclmulqdq
+#  ifdef __SSE4_2__
+#    undef native_crc32c
+#    define native_crc32c crc32c_sse42
+#    undef native_crc32c_fold_copy
+#    define native_crc32c_fold_copy crc32c_fold_copy_sse42
+#  endif
+#  undef native_crc64
+#  define native_crc64 crc64_pclmulqdq
+#  undef native_crc64_fold_copy
+#  define native_crc64_fold_copy crc64_fold_copy_pclmulqdq
+#  undef native_crc64_nvme
+#  define native_crc64_nvme crc64_nvme_pclmulqdq
+#  undef native_crc64_nvme_fold_copy
+#  define native_crc64_nvme_fold_copy crc64_nvme_fold_copy_pclmulqdq
 #endif
 // X86 - AVX
 #  if defined(X86_AVX2) && defined(__AVX2__)
@@ -128,6 +164,8 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #    define native_chunksize chunksize_avx2
 #    undef native_inflate_fast
 #    define native_inflate_fast inflate_fast_avx2
+#    undef native_insert_string
+#    define native_insert_string insert_string_avx2
 #    undef native_slide_hash
 #    define native_slide_hash slide_hash_avx2
 #    ifdef HAVE_BUILTIN_CTZ
@@ -139,6 +177,19 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #      define native_longest_match_slow longest_match_slow_avx2
 #    endif
 #  endif
+// X86 - VPCLMULQDQ (AVX2)
+#  if defined(X86_VPCLMULQDQ_AVX2_CRC) && defined(__PCLMUL__) && defined(__AVX2__) && defined(__VPCLMULQDQ__)
+#    undef native_crc32
+#    define native_crc32 crc32_vpclmulqdq_avx2
+#    undef native_crc32_fold
+#    define native_crc32_fold crc32_fold_vpclmulqdq_avx2
+#    undef native_crc32_fold_copy
+#    define native_crc32_fold_copy crc32_fold_vpclmulqdq_avx2_copy
+#    undef native_crc32_fold_final
+#    define native_crc32_fold_final crc32_fold_vpclmulqdq_avx2_final
+#    undef native_crc32_fold_reset
+#    define native_crc32_fold_reset crc32_fold_vpclmulqdq_avx2_reset
+#  endif
 
 // X86 - AVX512 (F,DQ,BW,Vl)
 #  if defined(X86_AVX512) && defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512BW__) && defined(__AVX512VL__)
@@ -165,6 +216,16 @@ uint32_t crc32_vpclmulqdq(uint32_t crc32, const uint8_t *buf, size_t len);
 #      define native_crc32_fold_final crc32_fold_vpclmulqdq_final
 #      undef native_crc32_fold_reset
 #      define native_crc32_fold_reset crc32_fold_vpclmulqdq_reset
+#      undef native_crc32_multi
+#      define native_crc32_multi crc32_multi_vpclmulqdq
+#      undef native_crc64
+#      define native_crc64 crc64_vpclmulqdq
+#      undef native_crc64_fold_copy
+#      define native_crc64_fold_copy crc64_fold_copy_vpclmulqdq
+#      undef native_crc64_nvme
+#      define native_crc64_nvme crc64_nvme_vpclmulqdq
+#      undef native_crc64_nvme_fold_copy
+#      define native_crc64_nvme_fold_copy crc64_nvme_fold_copy_vpclmulqdq
 #    endif
 #  endif
 #endif
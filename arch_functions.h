@@ -26,4 +26,10 @@
 #  include "arch/riscv/riscv_functions.h"
 #endif
 
+#if defined(POS32) && defined(DISABLE_RUNTIME_CPU_DETECTION)
+/* Arch-optimized slide_hash variants operate on 16-bit positions */
+#  undef native_slide_hash
+#  define native_slide_hash slide_hash_c
+#endif
+
 #endif
@@ -0,0 +1,50 @@
+/* checksum_multi_p.h -- Private inline function that feeds many independent
+ *                       buffers to a multi-buffer checksum kernel
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef CHECKSUM_MULTI_P_H
+#define CHECKSUM_MULTI_P_H
+
+#include "arch_functions.h"
+
+/* Shortest buffer that the multi-buffer kernels accept, shorter ones are hashed one at a time */
+#define CHECKSUM_MULTI_MIN 16
+
+/* Compute check[i] over iov[i] for all count buffers. Buffers are handed to the multi-buffer kernel in
+   groups of CHECKSUM_MULTI_LANES, in order, and the kernel runs every group for as long as its longest
+   buffer. Buffers that are too short, and those left over at the end, go to the single buffer
+   function. */
+static inline void checksum_multi(uint32_t *check, const zng_iovec *iov, size_t count, checksum_multi_func multi,
+                                  uint32_t (*single)(uint32_t check, const uint8_t *buf, size_t len), uint32_t initial) {
+    const uint8_t *buf[CHECKSUM_MULTI_LANES];
+    uint32_t lane_check[CHECKSUM_MULTI_LANES];
+    size_t len[CHECKSUM_MULTI_LANES], index[CHECKSUM_MULTI_LANES];
+    unsigned active = 0, i;
+    size_t next;
+
+    for (next = 0; next < count; next++) {
+        if (iov[next].iov_base == NULL) {
+            check[next] = initial;
+        } else if (iov[next].iov_len < CHECKSUM_MULTI_MIN) {
+            check[next] = single(check[next], (const uint8_t *)iov[next].iov_base, iov[next].iov_len);
+        } else {
+            buf[active] = (const uint8_t *)iov[next].iov_base;
+            len[active] = iov[next].iov_len;
+            lane_check[active] = check[next];
+            index[active] = next;
+            if (++active == CHECKSUM_MULTI_LANES) {
+                multi(lane_check, buf, len);
+                for (i = 0; i < CHECKSUM_MULTI_LANES; i++)
+                    check[index[i]] = lane_check[i];
+                active = 0;
+            }
+        }
+    }
+
+    /* Fewer buffers than lanes are left */
+    for (i = 0; i < active; i++)
+        check[index[i]] = single(lane_check[i], buf[i], len[i]);
+}
+
+#endif /* CHECKSUM_MULTI_P_H */
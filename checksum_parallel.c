@@ -0,0 +1,126 @@
+/* checksum_parallel.c -- compute crc32 and adler32 of large buffers on several threads
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The buffer is cut into one chunk per thread. Each chunk is checksummed on its
+ * own, starting from the initial value, and the results are merged in order with
+ * the combine functions, which only depend on the length of the chunks.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "zthread.h"
+
+/* Limit for the number of threads, so that the jobs fit on the stack */
+#define PARALLEL_MAX_THREADS 64
+/* Default upper bound for the number of threads, a few cores already saturate memory bandwidth */
+#define PARALLEL_DEFAULT_THREADS 8
+/* Default minimum number of bytes per thread, below which starting a thread does not pay off */
+#define PARALLEL_DEFAULT_MIN_CHUNK (1024 * 1024)
+
+typedef uint32_t (*checksum_func)(uint32_t check, const uint8_t *buf, size_t len);
+
+typedef struct checksum_job_s {
+    checksum_func func;
+    const uint8_t *buf;
+    size_t len;
+    uint32_t check;
+    zthread thread;
+    int started;
+} checksum_job;
+
+static void checksum_job_run(void *arg) {
+    checksum_job *job = (checksum_job *)arg;
+    job->check = job->func(job->check, job->buf, job->len);
+}
+
+/* Split the buffer into chunks and checksum them, returning the number of chunks and the length of
+   all but the last one */
+static unsigned checksum_jobs(checksum_job *jobs, checksum_func func, uint32_t check, uint32_t init,
+                              const uint8_t *buf, size_t len, unsigned threads, size_t min_chunk, size_t *chunk) {
+    unsigned count, i;
+
+    if (threads == 0)
+        threads = MIN(zthread_cpu_count(), PARALLEL_DEFAULT_THREADS);
+    if (min_chunk == 0)
+        min_chunk = PARALLEL_DEFAULT_MIN_CHUNK;
+    threads = MIN(threads, PARALLEL_MAX_THREADS);
+    if (len / min_chunk < threads)
+        threads = (unsigned)MAX(len / min_chunk, 1);
+
+    /* Keep the chunks a multiple of the cache line size */
+    *chunk = ((len + threads - 1) / threads + 63) & ~(size_t)63;
+    count = 0;
+    while (len > 0) {
+        jobs[count].func = func;
+        jobs[count].buf = buf;
+        jobs[count].len = MIN(*chunk, len);
+        jobs[count].check = count == 0 ? check : init;
+        jobs[count].started = 0;
+        buf += jobs[count].len;
+        len -= jobs[count].len;
+        count++;
+    }
+
+    /* Hash the first chunk on the calling thread, and any chunk that no thread could be started for */
+    for (i = 1; i < count; i++)
+        jobs[i].started = zthread_create(&jobs[i].thread, checksum_job_run, &jobs[i]) == 0;
+    for (i = 0; i < count; i++) {
+        if (jobs[i].started)
+            zthread_join(&jobs[i].thread);
+        else
+            checksum_job_run(&jobs[i]);
+    }
+    return count;
+}
+
+uint32_t Z_EXPORT PREFIX(crc32_parallel)(uint32_t crc, const uint8_t *buf, size_t len, unsigned threads,
+                                         size_t min_chunk) {
+    checksum_job jobs[PARALLEL_MAX_THREADS];
+    unsigned count, i;
+    size_t chunk;
+    uint32_t op;
+
+    if (buf == NULL) return CRC32_INITIAL_VALUE;
+
+    FUNCTABLE_INIT;
+    count = checksum_jobs(jobs, FUNCTABLE_FPTR(crc32), crc, CRC32_INITIAL_VALUE, buf, len, threads, min_chunk,
+                          &chunk);
+    if (count == 0)
+        return crc;
+
+    op = PREFIX(crc32_combine_gen)((z_off64_t)chunk);
+    crc = jobs[0].check;
+    for (i = 1; i < count; i++) {
+        if (jobs[i].len == chunk)
+            crc = PREFIX(crc32_combine_op)(crc, jobs[i].check, op);
+        else
+            crc = PREFIX(crc32_combine)(crc, jobs[i].check, (z_off64_t)jobs[i].len);
+    }
+    return crc;
+}
+
+uint32_t Z_EXPORT PREFIX(adler32_parallel)(uint32_t adler, const uint8_t *buf, size_t len, unsigned threads,
+                                           size_t min_chunk) {
+    checksum_job jobs[PARALLEL_MAX_THREADS];
+    unsigned count, i;
+    size_t chunk;
+
+    if (buf == NULL) return ADLER32_INITIAL_VALUE;
+
+    FUNCTABLE_INIT;
+    count = checksum_jobs(jobs, FUNCTABLE_FPTR(adler32), adler, ADLER32_INITIAL_VALUE, buf, len, threads,
+                          min_chunk, &chunk);
+    if (count == 0)
+        return adler;
+
+    adler = jobs[0].check;
+    for (i = 1; i < count; i++)
+        adler = PREFIX(adler32_combine)(adler, jobs[i].check, (z_off64_t)jobs[i].len);
+    return adler;
+}
+
+#endif
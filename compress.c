@@ -5,6 +5,7 @@
 
 #include "zbuild.h"
 #include "zutil.h"
+#include "deflate.h"
 
 /* ===========================================================================
  *  Architecture-specific hooks.
@@ -28,8 +29,8 @@
    memory, Z_BUF_ERROR if there was not enough room in the output buffer,
    Z_STREAM_ERROR if the level parameter is invalid.
 */
-int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source,
-                        z_uintmax_t sourceLen, int level) {
+static int compress_buffer(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source,
+                           z_uintmax_t sourceLen, int level, int windowBits, int memLevel) {
     PREFIX3(stream) stream;
     int err;
     const unsigned int max = (unsigned int)-1;
@@ -42,7 +43,7 @@ int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const
     stream.zfree = NULL;
     stream.opaque = NULL;
 
-    err = PREFIX(deflateInit)(&stream, level);
+    err = PREFIX(deflateInit2)(&stream, level, Z_DEFLATED, windowBits, memLevel, Z_DEFAULT_STRATEGY);
     if (err != Z_OK)
         return err;
 
@@ -68,6 +69,24 @@ int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const
     return err == Z_STREAM_END ? Z_OK : err;
 }
 
+int Z_EXPORT PREFIX(compress2)(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source,
+                        z_uintmax_t sourceLen, int level) {
+    return compress_buffer(dest, destLen, source, sourceLen, level, MAX_WBITS, DEF_MEM_LEVEL);
+}
+
+#ifndef ZLIB_COMPAT
+/* ===========================================================================
+     Same as compress2, with the window and the internal buffers sized for
+   sourceLen bytes of input.
+*/
+int32_t Z_EXPORT zng_compress3(uint8_t *dest, size_t *destLen, const uint8_t *source, size_t sourceLen, int32_t level) {
+    int32_t windowBits = MAX_WBITS, memLevel = DEF_MEM_LEVEL;
+
+    deflate_size_params(sourceLen, &windowBits, &memLevel);
+    return compress_buffer(dest, destLen, source, sourceLen, level, windowBits, memLevel);
+}
+#endif
+
 /* ===========================================================================
  */
 int Z_EXPORT PREFIX(compress)(unsigned char *dest, z_uintmax_t *destLen, const unsigned char *source, z_uintmax_t sourceLen) {
@@ -10,6 +10,9 @@
 #include "zbuild.h"
 #include "functable.h"
 #include "crc32_braid_tbl.h"
+#ifndef ZLIB_COMPAT
+#  include "checksum_multi_p.h"
+#endif
 
 /* ========================================================================= */
 
@@ -40,3 +43,10 @@ uint32_t Z_EXPORT PREFIX(crc32)(uint32_t crc, const unsigned char *buf, uint32_t
     return PREFIX(crc32_z)(crc, buf, len);
 }
 #endif
+
+#ifndef ZLIB_COMPAT
+void Z_EXPORT PREFIX(crc32_multi)(uint32_t *crc, const zng_iovec *buf, size_t count) {
+    FUNCTABLE_INIT;
+    checksum_multi(crc, buf, count, FUNCTABLE_FPTR(crc32_multi), FUNCTABLE_FPTR(crc32), CRC32_INITIAL_VALUE);
+}
+#endif
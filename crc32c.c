@@ -0,0 +1,35 @@
+/* crc32c.c -- compute the CRC-32C (Castagnoli) of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "crc32c_braid_tbl.h"
+
+/* Use the combine helpers of CRC-32 with the Castagnoli polynomial and its tables */
+#define POLY 0x82f63b78         /* p(x) reflected, with x^32 implied */
+#define x2n_table crc32c_x2n_table
+#include "crc32_braid_comb_p.h"
+
+/* ========================================================================= */
+
+uint32_t Z_EXPORT PREFIX(crc32c)(uint32_t crc, const uint8_t *buf, size_t len) {
+    if (buf == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc32c)(crc, buf, len);
+}
+
+uint32_t Z_EXPORT PREFIX(crc32c_copy)(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    if (dst == NULL || src == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc32c_fold_copy)(crc, dst, src, len);
+}
+
+uint32_t Z_EXPORT PREFIX(crc32c_combine)(uint32_t crc1, uint32_t crc2, z_off64_t len2) {
+    return multmodp(x2nmodp(len2, 3), crc1) ^ crc2;
+}
+
+#endif
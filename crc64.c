@@ -0,0 +1,71 @@
+/* crc64.c -- compute the CRC-64 of a data stream
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#include "crc64_tbl.h"
+#include "crc64_comb_p.h"
+
+#define POLY_XZ   0xc96c5795d7870f42    /* ECMA-182 p(x) reflected, with x^64 implied */
+#define POLY_NVME 0x9a6c9329ac4bc9b5    /* NVMe p(x) reflected, with x^64 implied */
+
+/*
+  Return x^(n * 2^k) modulo p(x), using the x^2^n table of the polynomial.
+  Unlike CRC-32, the powers of x do not cycle after 64 squarings for every
+  CRC-64 polynomial, so the table covers all k that a positive n can reach.
+  A negative n is taken as zero, since shifting it would never reach zero.
+ */
+static uint64_t crc64_x2nmodp(const uint64_t *x2n, uint64_t poly, z_off64_t n, unsigned k) {
+    uint64_t p;
+
+    p = (uint64_t)1 << 63;           /* x^0 == 1 */
+    if (n < 0)
+        return p;
+    while (n) {
+        if (n & 1)
+            p = crc64_multmodp(x2n[k], p, poly);
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+/* ========================================================================= */
+
+uint64_t Z_EXPORT PREFIX(crc64)(uint64_t crc, const uint8_t *buf, size_t len) {
+    if (buf == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc64)(crc, buf, len);
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_copy)(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    if (dst == NULL || src == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc64_fold_copy)(crc, dst, src, len);
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_combine)(uint64_t crc1, uint64_t crc2, z_off64_t len2) {
+    return crc64_multmodp(crc64_x2nmodp(crc64_x2n_table, POLY_XZ, len2, 3), crc1, POLY_XZ) ^ crc2;
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_nvme)(uint64_t crc, const uint8_t *buf, size_t len) {
+    if (buf == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc64_nvme)(crc, buf, len);
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_nvme_copy)(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len) {
+    if (dst == NULL || src == NULL) return 0;
+
+    return FUNCTABLE_CALL(crc64_nvme_fold_copy)(crc, dst, src, len);
+}
+
+uint64_t Z_EXPORT PREFIX(crc64_nvme_combine)(uint64_t crc1, uint64_t crc2, z_off64_t len2) {
+    return crc64_multmodp(crc64_x2nmodp(crc64_nvme_x2n_table, POLY_NVME, len2, 3), crc1, POLY_NVME) ^ crc2;
+}
+
+#endif
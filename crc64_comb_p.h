@@ -0,0 +1,28 @@
+#ifndef CRC64_COMB_P_H_
+#define CRC64_COMB_P_H_
+
+/* Number of x^2^n mod p(x) entries, enough to shift by any non-negative z_off64_t count of bytes */
+#define CRC64_X2N_SIZE 66
+
+/*
+  Return a(x) multiplied by b(x) modulo p(x), where p(x) is the CRC polynomial,
+  reflected. For speed, this requires that a not be zero.
+ */
+static uint64_t crc64_multmodp(uint64_t a, uint64_t b, uint64_t poly) {
+    uint64_t m, p;
+
+    m = (uint64_t)1 << 63;
+    p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+
+#endif /* CRC64_COMB_P_H_ */
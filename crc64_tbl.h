@@ -0,0 +1,1436 @@
+#ifndef CRC64_TBL_H_
+#define CRC64_TBL_H_
+
+/* crc64_tbl.h -- tables for CRC-64 calculation
+ * Generated automatically by makecrc64t.c
+ */
+
+static const uint64_t crc64_table[][256] = {
+   {0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b,
+    0x47aa7ae9abe7ff34, 0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c,
+    0x8f54f5d357cffe68, 0x3c7ab96d5468a107, 0xf7a18709ff1ebc66,
+    0x448fcbb7fcb9e309, 0x0325b15e575e1c3d, 0xb00bfde054f94352,
+    0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e,
+    0xcbdb3e64ab761d61, 0x7d9ba13851336649, 0xceb5ed8652943926,
+    0x891f976ff973c612, 0x3a31dbd1fad4997d, 0x064b62bcaebc387a,
+    0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+    0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74,
+    0xcd905cd805ca251b, 0xf1eae5b551a2841c, 0x42c4a90b5205db73,
+    0x056ed3e2f9e22447, 0xb6409f5cfa457b28, 0xfb374270a266cc92,
+    0x48190ecea1c193fd, 0x0fb374270a266cc9, 0xbc9d3899098133a6,
+    0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa,
+    0xc74dfb1df60e6d95, 0x0c96c5795d7870f4, 0xbfb889c75edf2f9b,
+    0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0, 0x774606fda2f72ec7,
+    0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+    0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80,
+    0xc10699a158b255ef, 0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87,
+    0x09f8169ba49a54b3, 0xbad65a25a73d0bdc, 0x710d64410c4b16bd,
+    0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+    0x0adda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5,
+    0x4d77dd2c5823b7ba, 0x64b62bcaebc387a1, 0xd7986774e864d8ce,
+    0x90321d9d438327fa, 0x231c512340247895, 0x1f66e84e144cd992,
+    0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+    0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c,
+    0xd4bdd62abf3ac4f3, 0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b,
+    0x1c4359104312c5af, 0xaf6d15ae40b59ac0, 0x192d8af2baf0e1e8,
+    0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+    0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80,
+    0x2557339fee9840ef, 0xee8c0dfb45ee5d8e, 0x5da24145464902e1,
+    0x1a083bacedaefdd5, 0xa9267712ee09a2ba, 0x955cce7fba6103bd,
+    0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+    0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68,
+    0xd82b1353e242b407, 0xe451aa3eb62a1500, 0x577fe680b58d4a6f,
+    0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34, 0x6820eeb3b6bbf755,
+    0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+    0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d,
+    0x545a57dee2d35652, 0xe21ac88218962d7a, 0x5134843c1b317215,
+    0x169efed5b0d68d21, 0xa5b0b26bb371d24e, 0x99ca0b06e7197349,
+    0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+    0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147,
+    0x521135624c6f6e28, 0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040,
+    0x9aefba58b0476f74, 0x29c1f6e6b3e0301b, 0xc96c5795d7870f42,
+    0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+    0xb2bc941128085171, 0x0192d8af2baf0e1e, 0x4638a2468048f12a,
+    0xf516eef883efae45, 0x3ecdd09c2899b324, 0x8de39c222b3eec4b,
+    0xca49e6cb80d9137f, 0x7967aa75837e4c10, 0x451d1318d716ed17,
+    0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x02b769f17cf11223,
+    0xb4f7f6ad86b4690b, 0x07d9ba1385133664, 0x4073c0fa2ef4c950,
+    0xf35d8c442d53963f, 0xcf273529793b3738, 0x7c0979977a9c6857,
+    0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c, 0x435671a479aad56d,
+    0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x04fc0b4dd24d2a59,
+    0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05,
+    0x7f2cc8c92dc2746a, 0x325b15e575e1c3d0, 0x8175595b76469cbf,
+    0xc6df23b2dda1638b, 0x75f16f0cde063ce4, 0x498bd6618a6e9de3,
+    0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0x0e21ac88218962d7,
+    0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed,
+    0x8250e80521188082, 0xbe2a516875702185, 0x0d041dd676d77eea,
+    0x4aae673fdd3081de, 0xf9802b81de97deb1, 0x4fc0b4dd24d2a599,
+    0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x086ace348f355aad,
+    0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1,
+    0x73ba0db070ba049e, 0xb86133d4dbcc19ff, 0x0b4f7f6ad86b4690,
+    0x4ce50583738cb9a4, 0xffcb493d702be6cb, 0xc3b1f050244347cc,
+    0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+    0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8,
+    0xea7006b697a377d7, 0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf,
+    0x228e898c6b8b768b, 0x91a0c532682c29e4, 0x5a7bfb56c35a3485,
+    0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+    0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed,
+    0x6601423b97329582, 0xd041dd676d77eeaa, 0x636f91d96ed0b1c5,
+    0x24c5eb30c5374ef1, 0x97eba78ec690119e, 0xab911ee392f8b099,
+    0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+    0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297,
+    0x604a2087398eadf8, 0x5c3099ea6de60cff, 0xef1ed5546e415390,
+    0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb, 0x56ed3e2f9e224471,
+    0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+    0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19,
+    0x6a978742ca4ae576, 0xa14cb926613cf817, 0x1262f598629ba778,
+    0x55c88f71c97c584c, 0xe6e6c3cfcadb0723, 0xda9c7aa29eb3a624,
+    0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+    0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263,
+    0x6cdce5fe64f6dd0c, 0x50a65c93309e7c0b, 0xe388102d33392364,
+    0xa4226ac498dedc50, 0x170c267a9b79833f, 0xdcd7181e300f9e5e,
+    0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+    0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036,
+    0xe0ada17364673f59},
+   {0x0000000000000000, 0x54e979925cd0f10d, 0xa9d2f324b9a1e21a,
+    0xfd3b8ab6e5711317, 0xc17d4962dc4ddab1, 0x959430f0809d2bbc,
+    0x68afba4665ec38ab, 0x3c46c3d4393cc9a6, 0x10223dee1795abe7,
+    0x44cb447c4b455aea, 0xb9f0cecaae3449fd, 0xed19b758f2e4b8f0,
+    0xd15f748ccbd87156, 0x85b60d1e9708805b, 0x788d87a87279934c,
+    0x2c64fe3a2ea96241, 0x20447bdc2f2b57ce, 0x74ad024e73fba6c3,
+    0x899688f8968ab5d4, 0xdd7ff16aca5a44d9, 0xe13932bef3668d7f,
+    0xb5d04b2cafb67c72, 0x48ebc19a4ac76f65, 0x1c02b80816179e68,
+    0x3066463238befc29, 0x648f3fa0646e0d24, 0x99b4b516811f1e33,
+    0xcd5dcc84ddcfef3e, 0xf11b0f50e4f32698, 0xa5f276c2b823d795,
+    0x58c9fc745d52c482, 0x0c2085e60182358f, 0x4088f7b85e56af9c,
+    0x14618e2a02865e91, 0xe95a049ce7f74d86, 0xbdb37d0ebb27bc8b,
+    0x81f5beda821b752d, 0xd51cc748decb8420, 0x28274dfe3bba9737,
+    0x7cce346c676a663a, 0x50aaca5649c3047b, 0x0443b3c41513f576,
+    0xf9783972f062e661, 0xad9140e0acb2176c, 0x91d78334958edeca,
+    0xc53efaa6c95e2fc7, 0x380570102c2f3cd0, 0x6cec098270ffcddd,
+    0x60cc8c64717df852, 0x3425f5f62dad095f, 0xc91e7f40c8dc1a48,
+    0x9df706d2940ceb45, 0xa1b1c506ad3022e3, 0xf558bc94f1e0d3ee,
+    0x086336221491c0f9, 0x5c8a4fb0484131f4, 0x70eeb18a66e853b5,
+    0x2407c8183a38a2b8, 0xd93c42aedf49b1af, 0x8dd53b3c839940a2,
+    0xb193f8e8baa58904, 0xe57a817ae6757809, 0x18410bcc03046b1e,
+    0x4ca8725e5fd49a13, 0x8111ef70bcad5f38, 0xd5f896e2e07dae35,
+    0x28c31c54050cbd22, 0x7c2a65c659dc4c2f, 0x406ca61260e08589,
+    0x1485df803c307484, 0xe9be5536d9416793, 0xbd572ca48591969e,
+    0x9133d29eab38f4df, 0xc5daab0cf7e805d2, 0x38e121ba129916c5,
+    0x6c0858284e49e7c8, 0x504e9bfc77752e6e, 0x04a7e26e2ba5df63,
+    0xf99c68d8ced4cc74, 0xad75114a92043d79, 0xa15594ac938608f6,
+    0xf5bced3ecf56f9fb, 0x088767882a27eaec, 0x5c6e1e1a76f71be1,
+    0x6028ddce4fcbd247, 0x34c1a45c131b234a, 0xc9fa2eeaf66a305d,
+    0x9d135778aabac150, 0xb177a9428413a311, 0xe59ed0d0d8c3521c,
+    0x18a55a663db2410b, 0x4c4c23f46162b006, 0x700ae020585e79a0,
+    0x24e399b2048e88ad, 0xd9d81304e1ff9bba, 0x8d316a96bd2f6ab7,
+    0xc19918c8e2fbf0a4, 0x9570615abe2b01a9, 0x684bebec5b5a12be,
+    0x3ca2927e078ae3b3, 0x00e451aa3eb62a15, 0x540d28386266db18,
+    0xa936a28e8717c80f, 0xfddfdb1cdbc73902, 0xd1bb2526f56e5b43,
+    0x85525cb4a9beaa4e, 0x7869d6024ccfb959, 0x2c80af90101f4854,
+    0x10c66c44292381f2, 0x442f15d675f370ff, 0xb9149f60908263e8,
+    0xedfde6f2cc5292e5, 0xe1dd6314cdd0a76a, 0xb5341a8691005667,
+    0x480f903074714570, 0x1ce6e9a228a1b47d, 0x20a02a76119d7ddb,
+    0x744953e44d4d8cd6, 0x8972d952a83c9fc1, 0xdd9ba0c0f4ec6ecc,
+    0xf1ff5efada450c8d, 0xa51627688695fd80, 0x582dadde63e4ee97,
+    0x0cc4d44c3f341f9a, 0x308217980608d63c, 0x646b6e0a5ad82731,
+    0x9950e4bcbfa93426, 0xcdb99d2ee379c52b, 0x90fb71cad654a0f5,
+    0xc41208588a8451f8, 0x392982ee6ff542ef, 0x6dc0fb7c3325b3e2,
+    0x518638a80a197a44, 0x056f413a56c98b49, 0xf854cb8cb3b8985e,
+    0xacbdb21eef686953, 0x80d94c24c1c10b12, 0xd43035b69d11fa1f,
+    0x290bbf007860e908, 0x7de2c69224b01805, 0x41a405461d8cd1a3,
+    0x154d7cd4415c20ae, 0xe876f662a42d33b9, 0xbc9f8ff0f8fdc2b4,
+    0xb0bf0a16f97ff73b, 0xe4567384a5af0636, 0x196df93240de1521,
+    0x4d8480a01c0ee42c, 0x71c2437425322d8a, 0x252b3ae679e2dc87,
+    0xd810b0509c93cf90, 0x8cf9c9c2c0433e9d, 0xa09d37f8eeea5cdc,
+    0xf4744e6ab23aadd1, 0x094fc4dc574bbec6, 0x5da6bd4e0b9b4fcb,
+    0x61e07e9a32a7866d, 0x350907086e777760, 0xc8328dbe8b066477,
+    0x9cdbf42cd7d6957a, 0xd073867288020f69, 0x849affe0d4d2fe64,
+    0x79a1755631a3ed73, 0x2d480cc46d731c7e, 0x110ecf10544fd5d8,
+    0x45e7b682089f24d5, 0xb8dc3c34edee37c2, 0xec3545a6b13ec6cf,
+    0xc051bb9c9f97a48e, 0x94b8c20ec3475583, 0x698348b826364694,
+    0x3d6a312a7ae6b799, 0x012cf2fe43da7e3f, 0x55c58b6c1f0a8f32,
+    0xa8fe01dafa7b9c25, 0xfc177848a6ab6d28, 0xf037fdaea72958a7,
+    0xa4de843cfbf9a9aa, 0x59e50e8a1e88babd, 0x0d0c771842584bb0,
+    0x314ab4cc7b648216, 0x65a3cd5e27b4731b, 0x989847e8c2c5600c,
+    0xcc713e7a9e159101, 0xe015c040b0bcf340, 0xb4fcb9d2ec6c024d,
+    0x49c73364091d115a, 0x1d2e4af655cde057, 0x216889226cf129f1,
+    0x7581f0b03021d8fc, 0x88ba7a06d550cbeb, 0xdc53039489803ae6,
+    0x11ea9eba6af9ffcd, 0x4503e72836290ec0, 0xb8386d9ed3581dd7,
+    0xecd1140c8f88ecda, 0xd097d7d8b6b4257c, 0x847eae4aea64d471,
+    0x794524fc0f15c766, 0x2dac5d6e53c5366b, 0x01c8a3547d6c542a,
+    0x5521dac621bca527, 0xa81a5070c4cdb630, 0xfcf329e2981d473d,
+    0xc0b5ea36a1218e9b, 0x945c93a4fdf17f96, 0x6967191218806c81,
+    0x3d8e608044509d8c, 0x31aee56645d2a803, 0x65479cf41902590e,
+    0x987c1642fc734a19, 0xcc956fd0a0a3bb14, 0xf0d3ac04999f72b2,
+    0xa43ad596c54f83bf, 0x59015f20203e90a8, 0x0de826b27cee61a5,
+    0x218cd888524703e4, 0x7565a11a0e97f2e9, 0x885e2bacebe6e1fe,
+    0xdcb7523eb73610f3, 0xe0f191ea8e0ad955, 0xb418e878d2da2858,
+    0x492362ce37ab3b4f, 0x1dca1b5c6b7bca42, 0x5162690234af5051,
+    0x058b1090687fa15c, 0xf8b09a268d0eb24b, 0xac59e3b4d1de4346,
+    0x901f2060e8e28ae0, 0xc4f659f2b4327bed, 0x39cdd344514368fa,
+    0x6d24aad60d9399f7, 0x414054ec233afbb6, 0x15a92d7e7fea0abb,
+    0xe892a7c89a9b19ac, 0xbc7bde5ac64be8a1, 0x803d1d8eff772107,
+    0xd4d4641ca3a7d00a, 0x29efeeaa46d6c31d, 0x7d0697381a063210,
+    0x712612de1b84079f, 0x25cf6b4c4754f692, 0xd8f4e1faa225e585,
+    0x8c1d9868fef51488, 0xb05b5bbcc7c9dd2e, 0xe4b2222e9b192c23,
+    0x1989a8987e683f34, 0x4d60d10a22b8ce39, 0x61042f300c11ac78,
+    0x35ed56a250c15d75, 0xc8d6dc14b5b04e62, 0x9c3fa586e960bf6f,
+    0xa0796652d05c76c9, 0xf4901fc08c8c87c4, 0x09ab957669fd94d3,
+    0x5d42ece4352d65de},
+   {0x0000000000000000, 0x3f0be14a916a6dcb, 0x7e17c29522d4db96,
+    0x411c23dfb3beb65d, 0xfc2f852a45a9b72c, 0xc3246460d4c3dae7,
+    0x823847bf677d6cba, 0xbd33a6f5f6170171, 0x6a87a57f245d70dd,
+    0x558c4435b5371d16, 0x149067ea0689ab4b, 0x2b9b86a097e3c680,
+    0x96a8205561f4c7f1, 0xa9a3c11ff09eaa3a, 0xe8bfe2c043201c67,
+    0xd7b4038ad24a71ac, 0xd50f4afe48bae1ba, 0xea04abb4d9d08c71,
+    0xab18886b6a6e3a2c, 0x94136921fb0457e7, 0x2920cfd40d135696,
+    0x162b2e9e9c793b5d, 0x57370d412fc78d00, 0x683cec0bbeade0cb,
+    0xbf88ef816ce79167, 0x80830ecbfd8dfcac, 0xc19f2d144e334af1,
+    0xfe94cc5edf59273a, 0x43a76aab294e264b, 0x7cac8be1b8244b80,
+    0x3db0a83e0b9afddd, 0x02bb49749af09016, 0x38c63ad73e7bddf1,
+    0x07cddb9daf11b03a, 0x46d1f8421caf0667, 0x79da19088dc56bac,
+    0xc4e9bffd7bd26add, 0xfbe25eb7eab80716, 0xbafe7d685906b14b,
+    0x85f59c22c86cdc80, 0x52419fa81a26ad2c, 0x6d4a7ee28b4cc0e7,
+    0x2c565d3d38f276ba, 0x135dbc77a9981b71, 0xae6e1a825f8f1a00,
+    0x9165fbc8cee577cb, 0xd079d8177d5bc196, 0xef72395dec31ac5d,
+    0xedc9702976c13c4b, 0xd2c29163e7ab5180, 0x93deb2bc5415e7dd,
+    0xacd553f6c57f8a16, 0x11e6f50333688b67, 0x2eed1449a202e6ac,
+    0x6ff1379611bc50f1, 0x50fad6dc80d63d3a, 0x874ed556529c4c96,
+    0xb845341cc3f6215d, 0xf95917c370489700, 0xc652f689e122facb,
+    0x7b61507c1735fbba, 0x446ab136865f9671, 0x057692e935e1202c,
+    0x3a7d73a3a48b4de7, 0x718c75ae7cf7bbe2, 0x4e8794e4ed9dd629,
+    0x0f9bb73b5e236074, 0x30905671cf490dbf, 0x8da3f084395e0cce,
+    0xb2a811cea8346105, 0xf3b432111b8ad758, 0xccbfd35b8ae0ba93,
+    0x1b0bd0d158aacb3f, 0x2400319bc9c0a6f4, 0x651c12447a7e10a9,
+    0x5a17f30eeb147d62, 0xe72455fb1d037c13, 0xd82fb4b18c6911d8,
+    0x9933976e3fd7a785, 0xa6387624aebdca4e, 0xa4833f50344d5a58,
+    0x9b88de1aa5273793, 0xda94fdc5169981ce, 0xe59f1c8f87f3ec05,
+    0x58acba7a71e4ed74, 0x67a75b30e08e80bf, 0x26bb78ef533036e2,
+    0x19b099a5c25a5b29, 0xce049a2f10102a85, 0xf10f7b65817a474e,
+    0xb01358ba32c4f113, 0x8f18b9f0a3ae9cd8, 0x322b1f0555b99da9,
+    0x0d20fe4fc4d3f062, 0x4c3cdd90776d463f, 0x73373cdae6072bf4,
+    0x494a4f79428c6613, 0x7641ae33d3e60bd8, 0x375d8dec6058bd85,
+    0x08566ca6f132d04e, 0xb565ca530725d13f, 0x8a6e2b19964fbcf4,
+    0xcb7208c625f10aa9, 0xf479e98cb49b6762, 0x23cdea0666d116ce,
+    0x1cc60b4cf7bb7b05, 0x5dda28934405cd58, 0x62d1c9d9d56fa093,
+    0xdfe26f2c2378a1e2, 0xe0e98e66b212cc29, 0xa1f5adb901ac7a74,
+    0x9efe4cf390c617bf, 0x9c4505870a3687a9, 0xa34ee4cd9b5cea62,
+    0xe252c71228e25c3f, 0xdd592658b98831f4, 0x606a80ad4f9f3085,
+    0x5f6161e7def55d4e, 0x1e7d42386d4beb13, 0x2176a372fc2186d8,
+    0xf6c2a0f82e6bf774, 0xc9c941b2bf019abf, 0x88d5626d0cbf2ce2,
+    0xb7de83279dd54129, 0x0aed25d26bc24058, 0x35e6c498faa82d93,
+    0x74fae74749169bce, 0x4bf1060dd87cf605, 0xe318eb5cf9ef77c4,
+    0xdc130a1668851a0f, 0x9d0f29c9db3bac52, 0xa204c8834a51c199,
+    0x1f376e76bc46c0e8, 0x203c8f3c2d2cad23, 0x6120ace39e921b7e,
+    0x5e2b4da90ff876b5, 0x899f4e23ddb20719, 0xb694af694cd86ad2,
+    0xf7888cb6ff66dc8f, 0xc8836dfc6e0cb144, 0x75b0cb09981bb035,
+    0x4abb2a430971ddfe, 0x0ba7099cbacf6ba3, 0x34ace8d62ba50668,
+    0x3617a1a2b155967e, 0x091c40e8203ffbb5, 0x4800633793814de8,
+    0x770b827d02eb2023, 0xca382488f4fc2152, 0xf533c5c265964c99,
+    0xb42fe61dd628fac4, 0x8b2407574742970f, 0x5c9004dd9508e6a3,
+    0x639be59704628b68, 0x2287c648b7dc3d35, 0x1d8c270226b650fe,
+    0xa0bf81f7d0a1518f, 0x9fb460bd41cb3c44, 0xdea84362f2758a19,
+    0xe1a3a228631fe7d2, 0xdbded18bc794aa35, 0xe4d530c156fec7fe,
+    0xa5c9131ee54071a3, 0x9ac2f254742a1c68, 0x27f154a1823d1d19,
+    0x18fab5eb135770d2, 0x59e69634a0e9c68f, 0x66ed777e3183ab44,
+    0xb15974f4e3c9dae8, 0x8e5295be72a3b723, 0xcf4eb661c11d017e,
+    0xf045572b50776cb5, 0x4d76f1dea6606dc4, 0x727d1094370a000f,
+    0x3361334b84b4b652, 0x0c6ad20115dedb99, 0x0ed19b758f2e4b8f,
+    0x31da7a3f1e442644, 0x70c659e0adfa9019, 0x4fcdb8aa3c90fdd2,
+    0xf2fe1e5fca87fca3, 0xcdf5ff155bed9168, 0x8ce9dccae8532735,
+    0xb3e23d8079394afe, 0x64563e0aab733b52, 0x5b5ddf403a195699,
+    0x1a41fc9f89a7e0c4, 0x254a1dd518cd8d0f, 0x9879bb20eeda8c7e,
+    0xa7725a6a7fb0e1b5, 0xe66e79b5cc0e57e8, 0xd96598ff5d643a23,
+    0x92949ef28518cc26, 0xad9f7fb81472a1ed, 0xec835c67a7cc17b0,
+    0xd388bd2d36a67a7b, 0x6ebb1bd8c0b17b0a, 0x51b0fa9251db16c1,
+    0x10acd94de265a09c, 0x2fa73807730fcd57, 0xf8133b8da145bcfb,
+    0xc718dac7302fd130, 0x8604f9188391676d, 0xb90f185212fb0aa6,
+    0x043cbea7e4ec0bd7, 0x3b375fed7586661c, 0x7a2b7c32c638d041,
+    0x45209d785752bd8a, 0x479bd40ccda22d9c, 0x789035465cc84057,
+    0x398c1699ef76f60a, 0x0687f7d37e1c9bc1, 0xbbb45126880b9ab0,
+    0x84bfb06c1961f77b, 0xc5a393b3aadf4126, 0xfaa872f93bb52ced,
+    0x2d1c7173e9ff5d41, 0x121790397895308a, 0x530bb3e6cb2b86d7,
+    0x6c0052ac5a41eb1c, 0xd133f459ac56ea6d, 0xee3815133d3c87a6,
+    0xaf2436cc8e8231fb, 0x902fd7861fe85c30, 0xaa52a425bb6311d7,
+    0x9559456f2a097c1c, 0xd44566b099b7ca41, 0xeb4e87fa08dda78a,
+    0x567d210ffecaa6fb, 0x6976c0456fa0cb30, 0x286ae39adc1e7d6d,
+    0x176102d04d7410a6, 0xc0d5015a9f3e610a, 0xffdee0100e540cc1,
+    0xbec2c3cfbdeaba9c, 0x81c922852c80d757, 0x3cfa8470da97d626,
+    0x03f1653a4bfdbbed, 0x42ed46e5f8430db0, 0x7de6a7af6929607b,
+    0x7f5deedbf3d9f06d, 0x40560f9162b39da6, 0x014a2c4ed10d2bfb,
+    0x3e41cd0440674630, 0x83726bf1b6704741, 0xbc798abb271a2a8a,
+    0xfd65a96494a49cd7, 0xc26e482e05cef11c, 0x15da4ba4d78480b0,
+    0x2ad1aaee46eeed7b, 0x6bcd8931f5505b26, 0x54c6687b643a36ed,
+    0xe9f5ce8e922d379c, 0xd6fe2fc403475a57, 0x97e20c1bb0f9ec0a,
+    0xa8e9ed51219381c1},
+   {0x0000000000000000, 0x1dee8a5e222ca1dc, 0x3bdd14bc445943b8,
+    0x26339ee26675e264, 0x77ba297888b28770, 0x6a54a326aa9e26ac,
+    0x4c673dc4ccebc4c8, 0x5189b79aeec76514, 0xef7452f111650ee0,
+    0xf29ad8af3349af3c, 0xd4a9464d553c4d58, 0xc947cc137710ec84,
+    0x98ce7b8999d78990, 0x8520f1d7bbfb284c, 0xa3136f35dd8eca28,
+    0xbefde56bffa26bf4, 0x4c300ac98dc40345, 0x51de8097afe8a299,
+    0x77ed1e75c99d40fd, 0x6a03942bebb1e121, 0x3b8a23b105768435,
+    0x2664a9ef275a25e9, 0x0057370d412fc78d, 0x1db9bd5363036651,
+    0xa34458389ca10da5, 0xbeaad266be8dac79, 0x98994c84d8f84e1d,
+    0x8577c6dafad4efc1, 0xd4fe714014138ad5, 0xc910fb1e363f2b09,
+    0xef2365fc504ac96d, 0xf2cdefa2726668b1, 0x986015931b88068a,
+    0x858e9fcd39a4a756, 0xa3bd012f5fd14532, 0xbe538b717dfde4ee,
+    0xefda3ceb933a81fa, 0xf234b6b5b1162026, 0xd4072857d763c242,
+    0xc9e9a209f54f639e, 0x771447620aed086a, 0x6afacd3c28c1a9b6,
+    0x4cc953de4eb44bd2, 0x5127d9806c98ea0e, 0x00ae6e1a825f8f1a,
+    0x1d40e444a0732ec6, 0x3b737aa6c606cca2, 0x269df0f8e42a6d7e,
+    0xd4501f5a964c05cf, 0xc9be9504b460a413, 0xef8d0be6d2154677,
+    0xf26381b8f039e7ab, 0xa3ea36221efe82bf, 0xbe04bc7c3cd22363,
+    0x9837229e5aa7c107, 0x85d9a8c0788b60db, 0x3b244dab87290b2f,
+    0x26cac7f5a505aaf3, 0x00f95917c3704897, 0x1d17d349e15ce94b,
+    0x4c9e64d30f9b8c5f, 0x5170ee8d2db72d83, 0x7743706f4bc2cfe7,
+    0x6aadfa3169ee6e3b, 0xa218840d981e1391, 0xbff60e53ba32b24d,
+    0x99c590b1dc475029, 0x842b1aeffe6bf1f5, 0xd5a2ad7510ac94e1,
+    0xc84c272b3280353d, 0xee7fb9c954f5d759, 0xf391339776d97685,
+    0x4d6cd6fc897b1d71, 0x50825ca2ab57bcad, 0x76b1c240cd225ec9,
+    0x6b5f481eef0eff15, 0x3ad6ff8401c99a01, 0x273875da23e53bdd,
+    0x010beb384590d9b9, 0x1ce5616667bc7865, 0xee288ec415da10d4,
+    0xf3c6049a37f6b108, 0xd5f59a785183536c, 0xc81b102673aff2b0,
+    0x9992a7bc9d6897a4, 0x847c2de2bf443678, 0xa24fb300d931d41c,
+    0xbfa1395efb1d75c0, 0x015cdc3504bf1e34, 0x1cb2566b2693bfe8,
+    0x3a81c88940e65d8c, 0x276f42d762cafc50, 0x76e6f54d8c0d9944,
+    0x6b087f13ae213898, 0x4d3be1f1c854dafc, 0x50d56bafea787b20,
+    0x3a78919e8396151b, 0x27961bc0a1bab4c7, 0x01a58522c7cf56a3,
+    0x1c4b0f7ce5e3f77f, 0x4dc2b8e60b24926b, 0x502c32b8290833b7,
+    0x761fac5a4f7dd1d3, 0x6bf126046d51700f, 0xd50cc36f92f31bfb,
+    0xc8e24931b0dfba27, 0xeed1d7d3d6aa5843, 0xf33f5d8df486f99f,
+    0xa2b6ea171a419c8b, 0xbf586049386d3d57, 0x996bfeab5e18df33,
+    0x848574f57c347eef, 0x76489b570e52165e, 0x6ba611092c7eb782,
+    0x4d958feb4a0b55e6, 0x507b05b56827f43a, 0x01f2b22f86e0912e,
+    0x1c1c3871a4cc30f2, 0x3a2fa693c2b9d296, 0x27c12ccde095734a,
+    0x993cc9a61f3718be, 0x84d243f83d1bb962, 0xa2e1dd1a5b6e5b06,
+    0xbf0f57447942fada, 0xee86e0de97859fce, 0xf3686a80b5a93e12,
+    0xd55bf462d3dcdc76, 0xc8b57e3cf1f07daa, 0xd6e9a7309f3239a7,
+    0xcb072d6ebd1e987b, 0xed34b38cdb6b7a1f, 0xf0da39d2f947dbc3,
+    0xa1538e481780bed7, 0xbcbd041635ac1f0b, 0x9a8e9af453d9fd6f,
+    0x876010aa71f55cb3, 0x399df5c18e573747, 0x24737f9fac7b969b,
+    0x0240e17dca0e74ff, 0x1fae6b23e822d523, 0x4e27dcb906e5b037,
+    0x53c956e724c911eb, 0x75fac80542bcf38f, 0x6814425b60905253,
+    0x9ad9adf912f63ae2, 0x873727a730da9b3e, 0xa104b94556af795a,
+    0xbcea331b7483d886, 0xed6384819a44bd92, 0xf08d0edfb8681c4e,
+    0xd6be903dde1dfe2a, 0xcb501a63fc315ff6, 0x75adff0803933402,
+    0x6843755621bf95de, 0x4e70ebb447ca77ba, 0x539e61ea65e6d666,
+    0x0217d6708b21b372, 0x1ff95c2ea90d12ae, 0x39cac2cccf78f0ca,
+    0x24244892ed545116, 0x4e89b2a384ba3f2d, 0x536738fda6969ef1,
+    0x7554a61fc0e37c95, 0x68ba2c41e2cfdd49, 0x39339bdb0c08b85d,
+    0x24dd11852e241981, 0x02ee8f674851fbe5, 0x1f0005396a7d5a39,
+    0xa1fde05295df31cd, 0xbc136a0cb7f39011, 0x9a20f4eed1867275,
+    0x87ce7eb0f3aad3a9, 0xd647c92a1d6db6bd, 0xcba943743f411761,
+    0xed9add965934f505, 0xf07457c87b1854d9, 0x02b9b86a097e3c68,
+    0x1f5732342b529db4, 0x3964acd64d277fd0, 0x248a26886f0bde0c,
+    0x7503911281ccbb18, 0x68ed1b4ca3e01ac4, 0x4ede85aec595f8a0,
+    0x53300ff0e7b9597c, 0xedcdea9b181b3288, 0xf02360c53a379354,
+    0xd610fe275c427130, 0xcbfe74797e6ed0ec, 0x9a77c3e390a9b5f8,
+    0x879949bdb2851424, 0xa1aad75fd4f0f640, 0xbc445d01f6dc579c,
+    0x74f1233d072c2a36, 0x691fa96325008bea, 0x4f2c37814375698e,
+    0x52c2bddf6159c852, 0x034b0a458f9ead46, 0x1ea5801badb20c9a,
+    0x38961ef9cbc7eefe, 0x257894a7e9eb4f22, 0x9b8571cc164924d6,
+    0x866bfb923465850a, 0xa05865705210676e, 0xbdb6ef2e703cc6b2,
+    0xec3f58b49efba3a6, 0xf1d1d2eabcd7027a, 0xd7e24c08daa2e01e,
+    0xca0cc656f88e41c2, 0x38c129f48ae82973, 0x252fa3aaa8c488af,
+    0x031c3d48ceb16acb, 0x1ef2b716ec9dcb17, 0x4f7b008c025aae03,
+    0x52958ad220760fdf, 0x74a614304603edbb, 0x69489e6e642f4c67,
+    0xd7b57b059b8d2793, 0xca5bf15bb9a1864f, 0xec686fb9dfd4642b,
+    0xf186e5e7fdf8c5f7, 0xa00f527d133fa0e3, 0xbde1d8233113013f,
+    0x9bd246c15766e35b, 0x863ccc9f754a4287, 0xec9136ae1ca42cbc,
+    0xf17fbcf03e888d60, 0xd74c221258fd6f04, 0xcaa2a84c7ad1ced8,
+    0x9b2b1fd69416abcc, 0x86c59588b63a0a10, 0xa0f60b6ad04fe874,
+    0xbd188134f26349a8, 0x03e5645f0dc1225c, 0x1e0bee012fed8380,
+    0x383870e3499861e4, 0x25d6fabd6bb4c038, 0x745f4d278573a52c,
+    0x69b1c779a75f04f0, 0x4f82599bc12ae694, 0x526cd3c5e3064748,
+    0xa0a13c6791602ff9, 0xbd4fb639b34c8e25, 0x9b7c28dbd5396c41,
+    0x8692a285f715cd9d, 0xd71b151f19d2a889, 0xcaf59f413bfe0955,
+    0xecc601a35d8beb31, 0xf1288bfd7fa74aed, 0x4fd56e9680052119,
+    0x523be4c8a22980c5, 0x74087a2ac45c62a1, 0x69e6f074e670c37d,
+    0x386f47ee08b7a669, 0x2581cdb02a9b07b5, 0x03b253524ceee5d1,
+    0x1e5cd90c6ec2440d},
+   {0x0000000000000000, 0x5c2d776033c4205e, 0xb85aeec0678840bc,
+    0xe47799a0544c60e2, 0xe26d72ab601e9ffd, 0xbe4005cb53dabfa3,
+    0x5a379c6b0796df41, 0x061aeb0b3452ff1f, 0x56024a7d6f33217f,
+    0x0a2f3d1d5cf70121, 0xee58a4bd08bb61c3, 0xb275d3dd3b7f419d,
+    0xb46f38d60f2dbe82, 0xe8424fb63ce99edc, 0x0c35d61668a5fe3e,
+    0x5018a1765b61de60, 0xac0494fade6642fe, 0xf029e39aeda262a0,
+    0x145e7a3ab9ee0242, 0x48730d5a8a2a221c, 0x4e69e651be78dd03,
+    0x124491318dbcfd5d, 0xf6330891d9f09dbf, 0xaa1e7ff1ea34bde1,
+    0xfa06de87b1556381, 0xa62ba9e7829143df, 0x425c3047d6dd233d,
+    0x1e714727e5190363, 0x186bac2cd14bfc7c, 0x4446db4ce28fdc22,
+    0xa03142ecb6c3bcc0, 0xfc1c358c85079c9e, 0xcad186de13c29b79,
+    0x96fcf1be2006bb27, 0x728b681e744adbc5, 0x2ea61f7e478efb9b,
+    0x28bcf47573dc0484, 0x74918315401824da, 0x90e61ab514544438,
+    0xcccb6dd527906466, 0x9cd3cca37cf1ba06, 0xc0febbc34f359a58,
+    0x248922631b79faba, 0x78a4550328bddae4, 0x7ebebe081cef25fb,
+    0x2293c9682f2b05a5, 0xc6e450c87b676547, 0x9ac927a848a34519,
+    0x66d51224cda4d987, 0x3af86544fe60f9d9, 0xde8ffce4aa2c993b,
+    0x82a28b8499e8b965, 0x84b8608fadba467a, 0xd89517ef9e7e6624,
+    0x3ce28e4fca3206c6, 0x60cff92ff9f62698, 0x30d75859a297f8f8,
+    0x6cfa2f399153d8a6, 0x888db699c51fb844, 0xd4a0c1f9f6db981a,
+    0xd2ba2af2c2896705, 0x8e975d92f14d475b, 0x6ae0c432a50127b9,
+    0x36cdb35296c507e7, 0x077ba297888b2877, 0x5b56d5f7bb4f0829,
+    0xbf214c57ef0368cb, 0xe30c3b37dcc74895, 0xe516d03ce895b78a,
+    0xb93ba75cdb5197d4, 0x5d4c3efc8f1df736, 0x0161499cbcd9d768,
+    0x5179e8eae7b80908, 0x0d549f8ad47c2956, 0xe923062a803049b4,
+    0xb50e714ab3f469ea, 0xb3149a4187a696f5, 0xef39ed21b462b6ab,
+    0x0b4e7481e02ed649, 0x576303e1d3eaf617, 0xab7f366d56ed6a89,
+    0xf752410d65294ad7, 0x1325d8ad31652a35, 0x4f08afcd02a10a6b,
+    0x491244c636f3f574, 0x153f33a60537d52a, 0xf148aa06517bb5c8,
+    0xad65dd6662bf9596, 0xfd7d7c1039de4bf6, 0xa1500b700a1a6ba8,
+    0x452792d05e560b4a, 0x190ae5b06d922b14, 0x1f100ebb59c0d40b,
+    0x433d79db6a04f455, 0xa74ae07b3e4894b7, 0xfb67971b0d8cb4e9,
+    0xcdaa24499b49b30e, 0x91875329a88d9350, 0x75f0ca89fcc1f3b2,
+    0x29ddbde9cf05d3ec, 0x2fc756e2fb572cf3, 0x73ea2182c8930cad,
+    0x979db8229cdf6c4f, 0xcbb0cf42af1b4c11, 0x9ba86e34f47a9271,
+    0xc7851954c7beb22f, 0x23f280f493f2d2cd, 0x7fdff794a036f293,
+    0x79c51c9f94640d8c, 0x25e86bffa7a02dd2, 0xc19ff25ff3ec4d30,
+    0x9db2853fc0286d6e, 0x61aeb0b3452ff1f0, 0x3d83c7d376ebd1ae,
+    0xd9f45e7322a7b14c, 0x85d9291311639112, 0x83c3c21825316e0d,
+    0xdfeeb57816f54e53, 0x3b992cd842b92eb1, 0x67b45bb8717d0eef,
+    0x37acface2a1cd08f, 0x6b818dae19d8f0d1, 0x8ff6140e4d949033,
+    0xd3db636e7e50b06d, 0xd5c188654a024f72, 0x89ecff0579c66f2c,
+    0x6d9b66a52d8a0fce, 0x31b611c51e4e2f90, 0x0ef7452f111650ee,
+    0x52da324f22d270b0, 0xb6adabef769e1052, 0xea80dc8f455a300c,
+    0xec9a37847108cf13, 0xb0b740e442ccef4d, 0x54c0d94416808faf,
+    0x08edae242544aff1, 0x58f50f527e257191, 0x04d878324de151cf,
+    0xe0afe19219ad312d, 0xbc8296f22a691173, 0xba987df91e3bee6c,
+    0xe6b50a992dffce32, 0x02c2933979b3aed0, 0x5eefe4594a778e8e,
+    0xa2f3d1d5cf701210, 0xfedea6b5fcb4324e, 0x1aa93f15a8f852ac,
+    0x468448759b3c72f2, 0x409ea37eaf6e8ded, 0x1cb3d41e9caaadb3,
+    0xf8c44dbec8e6cd51, 0xa4e93adefb22ed0f, 0xf4f19ba8a043336f,
+    0xa8dcecc893871331, 0x4cab7568c7cb73d3, 0x10860208f40f538d,
+    0x169ce903c05dac92, 0x4ab19e63f3998ccc, 0xaec607c3a7d5ec2e,
+    0xf2eb70a39411cc70, 0xc426c3f102d4cb97, 0x980bb4913110ebc9,
+    0x7c7c2d31655c8b2b, 0x20515a515698ab75, 0x264bb15a62ca546a,
+    0x7a66c63a510e7434, 0x9e115f9a054214d6, 0xc23c28fa36863488,
+    0x9224898c6de7eae8, 0xce09feec5e23cab6, 0x2a7e674c0a6faa54,
+    0x7653102c39ab8a0a, 0x7049fb270df97515, 0x2c648c473e3d554b,
+    0xc81315e76a7135a9, 0x943e628759b515f7, 0x6822570bdcb28969,
+    0x340f206bef76a937, 0xd078b9cbbb3ac9d5, 0x8c55ceab88fee98b,
+    0x8a4f25a0bcac1694, 0xd66252c08f6836ca, 0x3215cb60db245628,
+    0x6e38bc00e8e07676, 0x3e201d76b381a816, 0x620d6a1680458848,
+    0x867af3b6d409e8aa, 0xda5784d6e7cdc8f4, 0xdc4d6fddd39f37eb,
+    0x806018bde05b17b5, 0x6417811db4177757, 0x383af67d87d35709,
+    0x098ce7b8999d7899, 0x55a190d8aa5958c7, 0xb1d60978fe153825,
+    0xedfb7e18cdd1187b, 0xebe19513f983e764, 0xb7cce273ca47c73a,
+    0x53bb7bd39e0ba7d8, 0x0f960cb3adcf8786, 0x5f8eadc5f6ae59e6,
+    0x03a3daa5c56a79b8, 0xe7d443059126195a, 0xbbf93465a2e23904,
+    0xbde3df6e96b0c61b, 0xe1cea80ea574e645, 0x05b931aef13886a7,
+    0x599446cec2fca6f9, 0xa588734247fb3a67, 0xf9a50422743f1a39,
+    0x1dd29d8220737adb, 0x41ffeae213b75a85, 0x47e501e927e5a59a,
+    0x1bc87689142185c4, 0xffbfef29406de526, 0xa392984973a9c578,
+    0xf38a393f28c81b18, 0xafa74e5f1b0c3b46, 0x4bd0d7ff4f405ba4,
+    0x17fda09f7c847bfa, 0x11e74b9448d684e5, 0x4dca3cf47b12a4bb,
+    0xa9bda5542f5ec459, 0xf590d2341c9ae407, 0xc35d61668a5fe3e0,
+    0x9f701606b99bc3be, 0x7b078fa6edd7a35c, 0x272af8c6de138302,
+    0x213013cdea417c1d, 0x7d1d64add9855c43, 0x996afd0d8dc93ca1,
+    0xc5478a6dbe0d1cff, 0x955f2b1be56cc29f, 0xc9725c7bd6a8e2c1,
+    0x2d05c5db82e48223, 0x7128b2bbb120a27d, 0x773259b085725d62,
+    0x2b1f2ed0b6b67d3c, 0xcf68b770e2fa1dde, 0x9345c010d13e3d80,
+    0x6f59f59c5439a11e, 0x337482fc67fd8140, 0xd7031b5c33b1e1a2,
+    0x8b2e6c3c0075c1fc, 0x8d34873734273ee3, 0xd119f05707e31ebd,
+    0x356e69f753af7e5f, 0x69431e97606b5e01, 0x395bbfe13b0a8061,
+    0x6576c88108cea03f, 0x810151215c82c0dd, 0xdd2c26416f46e083,
+    0xdb36cd4a5b141f9c, 0x871bba2a68d03fc2, 0x636c238a3c9c5f20,
+    0x3f4154ea0f587f7e},
+   {0x0000000000000000, 0x6184d55f721267c6, 0xc309aabee424cf8c,
+    0xa28d7fe19636a84a, 0x14cbfa566747819d, 0x754f2f091555e65b,
+    0xd7c250e883634e11, 0xb64685b7f17129d7, 0x2997f4acce8f033a,
+    0x481321f3bc9d64fc, 0xea9e5e122aabccb6, 0x8b1a8b4d58b9ab70,
+    0x3d5c0efaa9c882a7, 0x5cd8dba5dbdae561, 0xfe55a4444dec4d2b,
+    0x9fd1711b3ffe2aed, 0x532fe9599d1e0674, 0x32ab3c06ef0c61b2,
+    0x902643e7793ac9f8, 0xf1a296b80b28ae3e, 0x47e4130ffa5987e9,
+    0x2660c650884be02f, 0x84edb9b11e7d4865, 0xe5696cee6c6f2fa3,
+    0x7ab81df55391054e, 0x1b3cc8aa21836288, 0xb9b1b74bb7b5cac2,
+    0xd8356214c5a7ad04, 0x6e73e7a334d684d3, 0x0ff732fc46c4e315,
+    0xad7a4d1dd0f24b5f, 0xccfe9842a2e02c99, 0xa65fd2b33a3c0ce8,
+    0xc7db07ec482e6b2e, 0x6556780dde18c364, 0x04d2ad52ac0aa4a2,
+    0xb29428e55d7b8d75, 0xd310fdba2f69eab3, 0x719d825bb95f42f9,
+    0x10195704cb4d253f, 0x8fc8261ff4b30fd2, 0xee4cf34086a16814,
+    0x4cc18ca11097c05e, 0x2d4559fe6285a798, 0x9b03dc4993f48e4f,
+    0xfa870916e1e6e989, 0x580a76f777d041c3, 0x398ea3a805c22605,
+    0xf5703beaa7220a9c, 0x94f4eeb5d5306d5a, 0x367991544306c510,
+    0x57fd440b3114a2d6, 0xe1bbc1bcc0658b01, 0x803f14e3b277ecc7,
+    0x22b26b022441448d, 0x4336be5d5653234b, 0xdce7cf4669ad09a6,
+    0xbd631a191bbf6e60, 0x1fee65f88d89c62a, 0x7e6ab0a7ff9ba1ec,
+    0xc82c35100eea883b, 0xa9a8e04f7cf8effd, 0x0b259faeeace47b7,
+    0x6aa14af198dc2071, 0xde670a4ddb760755, 0xbfe3df12a9646093,
+    0x1d6ea0f33f52c8d9, 0x7cea75ac4d40af1f, 0xcaacf01bbc3186c8,
+    0xab282544ce23e10e, 0x09a55aa558154944, 0x68218ffa2a072e82,
+    0xf7f0fee115f9046f, 0x96742bbe67eb63a9, 0x34f9545ff1ddcbe3,
+    0x557d810083cfac25, 0xe33b04b772be85f2, 0x82bfd1e800ace234,
+    0x2032ae09969a4a7e, 0x41b67b56e4882db8, 0x8d48e31446680121,
+    0xeccc364b347a66e7, 0x4e4149aaa24ccead, 0x2fc59cf5d05ea96b,
+    0x99831942212f80bc, 0xf807cc1d533de77a, 0x5a8ab3fcc50b4f30,
+    0x3b0e66a3b71928f6, 0xa4df17b888e7021b, 0xc55bc2e7faf565dd,
+    0x67d6bd066cc3cd97, 0x065268591ed1aa51, 0xb014edeeefa08386,
+    0xd19038b19db2e440, 0x731d47500b844c0a, 0x1299920f79962bcc,
+    0x7838d8fee14a0bbd, 0x19bc0da193586c7b, 0xbb317240056ec431,
+    0xdab5a71f777ca3f7, 0x6cf322a8860d8a20, 0x0d77f7f7f41fede6,
+    0xaffa8816622945ac, 0xce7e5d49103b226a, 0x51af2c522fc50887,
+    0x302bf90d5dd76f41, 0x92a686eccbe1c70b, 0xf32253b3b9f3a0cd,
+    0x4564d6044882891a, 0x24e0035b3a90eedc, 0x866d7cbaaca64696,
+    0xe7e9a9e5deb42150, 0x2b1731a77c540dc9, 0x4a93e4f80e466a0f,
+    0xe81e9b199870c245, 0x899a4e46ea62a583, 0x3fdccbf11b138c54,
+    0x5e581eae6901eb92, 0xfcd5614fff3743d8, 0x9d51b4108d25241e,
+    0x0280c50bb2db0ef3, 0x63041054c0c96935, 0xc1896fb556ffc17f,
+    0xa00dbaea24eda6b9, 0x164b3f5dd59c8f6e, 0x77cfea02a78ee8a8,
+    0xd54295e331b840e2, 0xb4c640bc43aa2724, 0x2e16bbb019e2102f,
+    0x4f926eef6bf077e9, 0xed1f110efdc6dfa3, 0x8c9bc4518fd4b865,
+    0x3add41e67ea591b2, 0x5b5994b90cb7f674, 0xf9d4eb589a815e3e,
+    0x98503e07e89339f8, 0x07814f1cd76d1315, 0x66059a43a57f74d3,
+    0xc488e5a23349dc99, 0xa50c30fd415bbb5f, 0x134ab54ab02a9288,
+    0x72ce6015c238f54e, 0xd0431ff4540e5d04, 0xb1c7caab261c3ac2,
+    0x7d3952e984fc165b, 0x1cbd87b6f6ee719d, 0xbe30f85760d8d9d7,
+    0xdfb42d0812cabe11, 0x69f2a8bfe3bb97c6, 0x08767de091a9f000,
+    0xaafb0201079f584a, 0xcb7fd75e758d3f8c, 0x54aea6454a731561,
+    0x352a731a386172a7, 0x97a70cfbae57daed, 0xf623d9a4dc45bd2b,
+    0x40655c132d3494fc, 0x21e1894c5f26f33a, 0x836cf6adc9105b70,
+    0xe2e823f2bb023cb6, 0x8849690323de1cc7, 0xe9cdbc5c51cc7b01,
+    0x4b40c3bdc7fad34b, 0x2ac416e2b5e8b48d, 0x9c82935544999d5a,
+    0xfd06460a368bfa9c, 0x5f8b39eba0bd52d6, 0x3e0fecb4d2af3510,
+    0xa1de9dafed511ffd, 0xc05a48f09f43783b, 0x62d737110975d071,
+    0x0353e24e7b67b7b7, 0xb51567f98a169e60, 0xd491b2a6f804f9a6,
+    0x761ccd476e3251ec, 0x179818181c20362a, 0xdb66805abec01ab3,
+    0xbae25505ccd27d75, 0x186f2ae45ae4d53f, 0x79ebffbb28f6b2f9,
+    0xcfad7a0cd9879b2e, 0xae29af53ab95fce8, 0x0ca4d0b23da354a2,
+    0x6d2005ed4fb13364, 0xf2f174f6704f1989, 0x9375a1a9025d7e4f,
+    0x31f8de48946bd605, 0x507c0b17e679b1c3, 0xe63a8ea017089814,
+    0x87be5bff651affd2, 0x2533241ef32c5798, 0x44b7f141813e305e,
+    0xf071b1fdc294177a, 0x91f564a2b08670bc, 0x33781b4326b0d8f6,
+    0x52fcce1c54a2bf30, 0xe4ba4baba5d396e7, 0x853e9ef4d7c1f121,
+    0x27b3e11541f7596b, 0x4637344a33e53ead, 0xd9e645510c1b1440,
+    0xb862900e7e097386, 0x1aefefefe83fdbcc, 0x7b6b3ab09a2dbc0a,
+    0xcd2dbf076b5c95dd, 0xaca96a58194ef21b, 0x0e2415b98f785a51,
+    0x6fa0c0e6fd6a3d97, 0xa35e58a45f8a110e, 0xc2da8dfb2d9876c8,
+    0x6057f21abbaede82, 0x01d32745c9bcb944, 0xb795a2f238cd9093,
+    0xd61177ad4adff755, 0x749c084cdce95f1f, 0x1518dd13aefb38d9,
+    0x8ac9ac0891051234, 0xeb4d7957e31775f2, 0x49c006b67521ddb8,
+    0x2844d3e90733ba7e, 0x9e02565ef64293a9, 0xff8683018450f46f,
+    0x5d0bfce012665c25, 0x3c8f29bf60743be3, 0x562e634ef8a81b92,
+    0x37aab6118aba7c54, 0x9527c9f01c8cd41e, 0xf4a31caf6e9eb3d8,
+    0x42e599189fef9a0f, 0x23614c47edfdfdc9, 0x81ec33a67bcb5583,
+    0xe068e6f909d93245, 0x7fb997e2362718a8, 0x1e3d42bd44357f6e,
+    0xbcb03d5cd203d724, 0xdd34e803a011b0e2, 0x6b726db451609935,
+    0x0af6b8eb2372fef3, 0xa87bc70ab54456b9, 0xc9ff1255c756317f,
+    0x05018a1765b61de6, 0x64855f4817a47a20, 0xc60820a98192d26a,
+    0xa78cf5f6f380b5ac, 0x11ca704102f19c7b, 0x704ea51e70e3fbbd,
+    0xd2c3daffe6d553f7, 0xb3470fa094c73431, 0x2c967ebbab391edc,
+    0x4d12abe4d92b791a, 0xef9fd4054f1dd150, 0x8e1b015a3d0fb696,
+    0x385d84edcc7e9f41, 0x59d951b2be6cf887, 0xfb542e53285a50cd,
+    0x9ad0fb0c5a48370b},
+   {0x0000000000000000, 0x22ef0d5934f964ec, 0x45de1ab269f2c9d8,
+    0x673117eb5d0bad34, 0x8bbc3564d3e593b0, 0xa953383de71cf75c,
+    0xce622fd6ba175a68, 0xec8d228f8eee3e84, 0x85a0c5e208c539e5,
+    0xa74fc8bb3c3c5d09, 0xc07edf506137f03d, 0xe291d20955ce94d1,
+    0x0e1cf086db20aa55, 0x2cf3fddfefd9ceb9, 0x4bc2ea34b2d2638d,
+    0x692de76d862b0761, 0x999924efbe846d4f, 0xbb7629b68a7d09a3,
+    0xdc473e5dd776a497, 0xfea83304e38fc07b, 0x1225118b6d61feff,
+    0x30ca1cd259989a13, 0x57fb0b3904933727, 0x75140660306a53cb,
+    0x1c39e10db64154aa, 0x3ed6ec5482b83046, 0x59e7fbbfdfb39d72,
+    0x7b08f6e6eb4af99e, 0x9785d46965a4c71a, 0xb56ad930515da3f6,
+    0xd25bcedb0c560ec2, 0xf0b4c38238af6a2e, 0xa1eae6f4d206c41b,
+    0x8305ebade6ffa0f7, 0xe434fc46bbf40dc3, 0xc6dbf11f8f0d692f,
+    0x2a56d39001e357ab, 0x08b9dec9351a3347, 0x6f88c92268119e73,
+    0x4d67c47b5ce8fa9f, 0x244a2316dac3fdfe, 0x06a52e4fee3a9912,
+    0x619439a4b3313426, 0x437b34fd87c850ca, 0xaff6167209266e4e,
+    0x8d191b2b3ddf0aa2, 0xea280cc060d4a796, 0xc8c70199542dc37a,
+    0x3873c21b6c82a954, 0x1a9ccf42587bcdb8, 0x7dadd8a90570608c,
+    0x5f42d5f031890460, 0xb3cff77fbf673ae4, 0x9120fa268b9e5e08,
+    0xf611edcdd695f33c, 0xd4fee094e26c97d0, 0xbdd307f9644790b1,
+    0x9f3c0aa050bef45d, 0xf80d1d4b0db55969, 0xdae21012394c3d85,
+    0x366f329db7a20301, 0x14803fc4835b67ed, 0x73b1282fde50cad9,
+    0x515e2576eaa9ae35, 0xd10d62c20b0396b3, 0xf3e26f9b3ffaf25f,
+    0x94d3787062f15f6b, 0xb63c752956083b87, 0x5ab157a6d8e60503,
+    0x785e5affec1f61ef, 0x1f6f4d14b114ccdb, 0x3d80404d85eda837,
+    0x54ada72003c6af56, 0x7642aa79373fcbba, 0x1173bd926a34668e,
+    0x339cb0cb5ecd0262, 0xdf119244d0233ce6, 0xfdfe9f1de4da580a,
+    0x9acf88f6b9d1f53e, 0xb82085af8d2891d2, 0x4894462db587fbfc,
+    0x6a7b4b74817e9f10, 0x0d4a5c9fdc753224, 0x2fa551c6e88c56c8,
+    0xc32873496662684c, 0xe1c77e10529b0ca0, 0x86f669fb0f90a194,
+    0xa41964a23b69c578, 0xcd3483cfbd42c219, 0xefdb8e9689bba6f5,
+    0x88ea997dd4b00bc1, 0xaa059424e0496f2d, 0x4688b6ab6ea751a9,
+    0x6467bbf25a5e3545, 0x0356ac1907559871, 0x21b9a14033acfc9d,
+    0x70e78436d90552a8, 0x5208896fedfc3644, 0x35399e84b0f79b70,
+    0x17d693dd840eff9c, 0xfb5bb1520ae0c118, 0xd9b4bc0b3e19a5f4,
+    0xbe85abe0631208c0, 0x9c6aa6b957eb6c2c, 0xf54741d4d1c06b4d,
+    0xd7a84c8de5390fa1, 0xb0995b66b832a295, 0x9276563f8ccbc679,
+    0x7efb74b00225f8fd, 0x5c1479e936dc9c11, 0x3b256e026bd73125,
+    0x19ca635b5f2e55c9, 0xe97ea0d967813fe7, 0xcb91ad8053785b0b,
+    0xaca0ba6b0e73f63f, 0x8e4fb7323a8a92d3, 0x62c295bdb464ac57,
+    0x402d98e4809dc8bb, 0x271c8f0fdd96658f, 0x05f38256e96f0163,
+    0x6cde653b6f440602, 0x4e3168625bbd62ee, 0x29007f8906b6cfda,
+    0x0bef72d0324fab36, 0xe762505fbca195b2, 0xc58d5d068858f15e,
+    0xa2bc4aedd5535c6a, 0x805347b4e1aa3886, 0x30c26aafb90933e3,
+    0x122d67f68df0570f, 0x751c701dd0fbfa3b, 0x57f37d44e4029ed7,
+    0xbb7e5fcb6aeca053, 0x999152925e15c4bf, 0xfea04579031e698b,
+    0xdc4f482037e70d67, 0xb562af4db1cc0a06, 0x978da21485356eea,
+    0xf0bcb5ffd83ec3de, 0xd253b8a6ecc7a732, 0x3ede9a29622999b6,
+    0x1c31977056d0fd5a, 0x7b00809b0bdb506e, 0x59ef8dc23f223482,
+    0xa95b4e40078d5eac, 0x8bb4431933743a40, 0xec8554f26e7f9774,
+    0xce6a59ab5a86f398, 0x22e77b24d468cd1c, 0x0008767de091a9f0,
+    0x67396196bd9a04c4, 0x45d66ccf89636028, 0x2cfb8ba20f486749,
+    0x0e1486fb3bb103a5, 0x6925911066baae91, 0x4bca9c495243ca7d,
+    0xa747bec6dcadf4f9, 0x85a8b39fe8549015, 0xe299a474b55f3d21,
+    0xc076a92d81a659cd, 0x91288c5b6b0ff7f8, 0xb3c781025ff69314,
+    0xd4f696e902fd3e20, 0xf6199bb036045acc, 0x1a94b93fb8ea6448,
+    0x387bb4668c1300a4, 0x5f4aa38dd118ad90, 0x7da5aed4e5e1c97c,
+    0x148849b963cace1d, 0x366744e05733aaf1, 0x5156530b0a3807c5,
+    0x73b95e523ec16329, 0x9f347cddb02f5dad, 0xbddb718484d63941,
+    0xdaea666fd9dd9475, 0xf8056b36ed24f099, 0x08b1a8b4d58b9ab7,
+    0x2a5ea5ede172fe5b, 0x4d6fb206bc79536f, 0x6f80bf5f88803783,
+    0x830d9dd0066e0907, 0xa1e2908932976deb, 0xc6d387626f9cc0df,
+    0xe43c8a3b5b65a433, 0x8d116d56dd4ea352, 0xaffe600fe9b7c7be,
+    0xc8cf77e4b4bc6a8a, 0xea207abd80450e66, 0x06ad58320eab30e2,
+    0x2442556b3a52540e, 0x437342806759f93a, 0x619c4fd953a09dd6,
+    0xe1cf086db20aa550, 0xc320053486f3c1bc, 0xa41112dfdbf86c88,
+    0x86fe1f86ef010864, 0x6a733d0961ef36e0, 0x489c30505516520c,
+    0x2fad27bb081dff38, 0x0d422ae23ce49bd4, 0x646fcd8fbacf9cb5,
+    0x4680c0d68e36f859, 0x21b1d73dd33d556d, 0x035eda64e7c43181,
+    0xefd3f8eb692a0f05, 0xcd3cf5b25dd36be9, 0xaa0de25900d8c6dd,
+    0x88e2ef003421a231, 0x78562c820c8ec81f, 0x5ab921db3877acf3,
+    0x3d883630657c01c7, 0x1f673b695185652b, 0xf3ea19e6df6b5baf,
+    0xd10514bfeb923f43, 0xb6340354b6999277, 0x94db0e0d8260f69b,
+    0xfdf6e960044bf1fa, 0xdf19e43930b29516, 0xb828f3d26db93822,
+    0x9ac7fe8b59405cce, 0x764adc04d7ae624a, 0x54a5d15de35706a6,
+    0x3394c6b6be5cab92, 0x117bcbef8aa5cf7e, 0x4025ee99600c614b,
+    0x62cae3c054f505a7, 0x05fbf42b09fea893, 0x2714f9723d07cc7f,
+    0xcb99dbfdb3e9f2fb, 0xe976d6a487109617, 0x8e47c14fda1b3b23,
+    0xaca8cc16eee25fcf, 0xc5852b7b68c958ae, 0xe76a26225c303c42,
+    0x805b31c9013b9176, 0xa2b43c9035c2f59a, 0x4e391e1fbb2ccb1e,
+    0x6cd613468fd5aff2, 0x0be704add2de02c6, 0x290809f4e627662a,
+    0xd9bcca76de880c04, 0xfb53c72fea7168e8, 0x9c62d0c4b77ac5dc,
+    0xbe8ddd9d8383a130, 0x5200ff120d6d9fb4, 0x70eff24b3994fb58,
+    0x17dee5a0649f566c, 0x3531e8f950663280, 0x5c1c0f94d64d35e1,
+    0x7ef302cde2b4510d, 0x19c21526bfbffc39, 0x3b2d187f8b4698d5,
+    0xd7a03af005a8a651, 0xf54f37a93151c2bd, 0x927e20426c5a6f89,
+    0xb0912d1b58a30b65},
+   {0x0000000000000000, 0xdabe95afc7875f40, 0x27a584742000a005,
+    0xfd1b11dbe787ff45, 0x4f4b08e84001400a, 0x95f59d4787861f4a,
+    0x68ee8c9c6001e00f, 0xb2501933a786bf4f, 0x9e9611d080028014,
+    0x4428847f4785df54, 0xb93395a4a0022011, 0x638d000b67857f51,
+    0xd1dd1938c003c01e, 0x0b638c9707849f5e, 0xf6789d4ce003601b,
+    0x2cc608e327843f5b, 0xaff48c8aaf0b1ead, 0x754a1925688c41ed,
+    0x885108fe8f0bbea8, 0x52ef9d51488ce1e8, 0xe0bf8462ef0a5ea7,
+    0x3a0111cd288d01e7, 0xc71a0016cf0afea2, 0x1da495b9088da1e2,
+    0x31629d5a2f099eb9, 0xebdc08f5e88ec1f9, 0x16c7192e0f093ebc,
+    0xcc798c81c88e61fc, 0x7e2995b26f08deb3, 0xa497001da88f81f3,
+    0x598c11c64f087eb6, 0x83328469888f21f6, 0xcd31b63ef11823df,
+    0x178f2391369f7c9f, 0xea94324ad11883da, 0x302aa7e5169fdc9a,
+    0x827abed6b11963d5, 0x58c42b79769e3c95, 0xa5df3aa29119c3d0,
+    0x7f61af0d569e9c90, 0x53a7a7ee711aa3cb, 0x89193241b69dfc8b,
+    0x7402239a511a03ce, 0xaebcb635969d5c8e, 0x1cecaf06311be3c1,
+    0xc6523aa9f69cbc81, 0x3b492b72111b43c4, 0xe1f7beddd69c1c84,
+    0x62c53ab45e133d72, 0xb87baf1b99946232, 0x4560bec07e139d77,
+    0x9fde2b6fb994c237, 0x2d8e325c1e127d78, 0xf730a7f3d9952238,
+    0x0a2bb6283e12dd7d, 0xd0952387f995823d, 0xfc532b64de11bd66,
+    0x26edbecb1996e226, 0xdbf6af10fe111d63, 0x01483abf39964223,
+    0xb318238c9e10fd6c, 0x69a6b6235997a22c, 0x94bda7f8be105d69,
+    0x4e03325779970229, 0x08bbc3564d3e593b, 0xd20556f98ab9067b,
+    0x2f1e47226d3ef93e, 0xf5a0d28daab9a67e, 0x47f0cbbe0d3f1931,
+    0x9d4e5e11cab84671, 0x60554fca2d3fb934, 0xbaebda65eab8e674,
+    0x962dd286cd3cd92f, 0x4c9347290abb866f, 0xb18856f2ed3c792a,
+    0x6b36c35d2abb266a, 0xd966da6e8d3d9925, 0x03d84fc14abac665,
+    0xfec35e1aad3d3920, 0x247dcbb56aba6660, 0xa74f4fdce2354796,
+    0x7df1da7325b218d6, 0x80eacba8c235e793, 0x5a545e0705b2b8d3,
+    0xe8044734a234079c, 0x32bad29b65b358dc, 0xcfa1c3408234a799,
+    0x151f56ef45b3f8d9, 0x39d95e0c6237c782, 0xe367cba3a5b098c2,
+    0x1e7cda7842376787, 0xc4c24fd785b038c7, 0x769256e422368788,
+    0xac2cc34be5b1d8c8, 0x5137d2900236278d, 0x8b89473fc5b178cd,
+    0xc58a7568bc267ae4, 0x1f34e0c77ba125a4, 0xe22ff11c9c26dae1,
+    0x389164b35ba185a1, 0x8ac17d80fc273aee, 0x507fe82f3ba065ae,
+    0xad64f9f4dc279aeb, 0x77da6c5b1ba0c5ab, 0x5b1c64b83c24faf0,
+    0x81a2f117fba3a5b0, 0x7cb9e0cc1c245af5, 0xa6077563dba305b5,
+    0x14576c507c25bafa, 0xcee9f9ffbba2e5ba, 0x33f2e8245c251aff,
+    0xe94c7d8b9ba245bf, 0x6a7ef9e2132d6449, 0xb0c06c4dd4aa3b09,
+    0x4ddb7d96332dc44c, 0x9765e839f4aa9b0c, 0x2535f10a532c2443,
+    0xff8b64a594ab7b03, 0x0290757e732c8446, 0xd82ee0d1b4abdb06,
+    0xf4e8e832932fe45d, 0x2e567d9d54a8bb1d, 0xd34d6c46b32f4458,
+    0x09f3f9e974a81b18, 0xbba3e0dad32ea457, 0x611d757514a9fb17,
+    0x9c0664aef32e0452, 0x46b8f10134a95b12, 0x117786ac9a7cb276,
+    0xcbc913035dfbed36, 0x36d202d8ba7c1273, 0xec6c97777dfb4d33,
+    0x5e3c8e44da7df27c, 0x84821beb1dfaad3c, 0x79990a30fa7d5279,
+    0xa3279f9f3dfa0d39, 0x8fe1977c1a7e3262, 0x555f02d3ddf96d22,
+    0xa84413083a7e9267, 0x72fa86a7fdf9cd27, 0xc0aa9f945a7f7268,
+    0x1a140a3b9df82d28, 0xe70f1be07a7fd26d, 0x3db18e4fbdf88d2d,
+    0xbe830a263577acdb, 0x643d9f89f2f0f39b, 0x99268e5215770cde,
+    0x43981bfdd2f0539e, 0xf1c802ce7576ecd1, 0x2b769761b2f1b391,
+    0xd66d86ba55764cd4, 0x0cd3131592f11394, 0x20151bf6b5752ccf,
+    0xfaab8e5972f2738f, 0x07b09f8295758cca, 0xdd0e0a2d52f2d38a,
+    0x6f5e131ef5746cc5, 0xb5e086b132f33385, 0x48fb976ad574ccc0,
+    0x924502c512f39380, 0xdc4630926b6491a9, 0x06f8a53dace3cee9,
+    0xfbe3b4e64b6431ac, 0x215d21498ce36eec, 0x930d387a2b65d1a3,
+    0x49b3add5ece28ee3, 0xb4a8bc0e0b6571a6, 0x6e1629a1cce22ee6,
+    0x42d02142eb6611bd, 0x986eb4ed2ce14efd, 0x6575a536cb66b1b8,
+    0xbfcb30990ce1eef8, 0x0d9b29aaab6751b7, 0xd725bc056ce00ef7,
+    0x2a3eadde8b67f1b2, 0xf08038714ce0aef2, 0x73b2bc18c46f8f04,
+    0xa90c29b703e8d044, 0x5417386ce46f2f01, 0x8ea9adc323e87041,
+    0x3cf9b4f0846ecf0e, 0xe647215f43e9904e, 0x1b5c3084a46e6f0b,
+    0xc1e2a52b63e9304b, 0xed24adc8446d0f10, 0x379a386783ea5050,
+    0xca8129bc646daf15, 0x103fbc13a3eaf055, 0xa26fa520046c4f1a,
+    0x78d1308fc3eb105a, 0x85ca2154246cef1f, 0x5f74b4fbe3ebb05f,
+    0x19cc45fad742eb4d, 0xc372d05510c5b40d, 0x3e69c18ef7424b48,
+    0xe4d7542130c51408, 0x56874d129743ab47, 0x8c39d8bd50c4f407,
+    0x7122c966b7430b42, 0xab9c5cc970c45402, 0x875a542a57406b59,
+    0x5de4c18590c73419, 0xa0ffd05e7740cb5c, 0x7a4145f1b0c7941c,
+    0xc8115cc217412b53, 0x12afc96dd0c67413, 0xefb4d8b637418b56,
+    0x350a4d19f0c6d416, 0xb638c9707849f5e0, 0x6c865cdfbfceaaa0,
+    0x919d4d04584955e5, 0x4b23d8ab9fce0aa5, 0xf973c1983848b5ea,
+    0x23cd5437ffcfeaaa, 0xded645ec184815ef, 0x0468d043dfcf4aaf,
+    0x28aed8a0f84b75f4, 0xf2104d0f3fcc2ab4, 0x0f0b5cd4d84bd5f1,
+    0xd5b5c97b1fcc8ab1, 0x67e5d048b84a35fe, 0xbd5b45e77fcd6abe,
+    0x4040543c984a95fb, 0x9afec1935fcdcabb, 0xd4fdf3c4265ac892,
+    0x0e43666be1dd97d2, 0xf35877b0065a6897, 0x29e6e21fc1dd37d7,
+    0x9bb6fb2c665b8898, 0x41086e83a1dcd7d8, 0xbc137f58465b289d,
+    0x66adeaf781dc77dd, 0x4a6be214a6584886, 0x90d577bb61df17c6,
+    0x6dce66608658e883, 0xb770f3cf41dfb7c3, 0x0520eafce659088c,
+    0xdf9e7f5321de57cc, 0x22856e88c659a889, 0xf83bfb2701def7c9,
+    0x7b097f4e8951d63f, 0xa1b7eae14ed6897f, 0x5cacfb3aa951763a,
+    0x86126e956ed6297a, 0x344277a6c9509635, 0xeefce2090ed7c975,
+    0x13e7f3d2e9503630, 0xc959667d2ed76970, 0xe59f6e9e0953562b,
+    0x3f21fb31ced4096b, 0xc23aeaea2953f62e, 0x18847f45eed4a96e,
+    0xaad4667649521621, 0x706af3d98ed54961, 0x8d71e2026952b624,
+    0x57cf77adaed5e964}};
+
+static const uint64_t crc64_x2n_table[] = {
+    0x4000000000000000, 0x2000000000000000, 0x0800000000000000,
+    0x0080000000000000, 0x0000800000000000, 0x0000000080000000,
+    0xc96c5795d7870f42, 0x6d5f4ad7e3c3afa0, 0xd49f7e445077d8ea,
+    0x040fb02a53c216fa, 0x6bec35957b9ef3a0, 0xb0e3bb0658964afe,
+    0x218578c7a2dff638, 0x6dbb920f24dd5cf2, 0x7a140cfcdb4d5eb5,
+    0x41b3705ecbc4057b, 0xd46ab656accac1ea, 0x329beda6fc34fb73,
+    0x51a4fcd4350b9797, 0x314fa85637efae9d, 0xacf27e9a1518d512,
+    0xffe2a3388a4d8ce7, 0x48b9697e60cc2e4e, 0xada73cb78dd62460,
+    0x3ea5454d8ce5c1bb, 0x5e84e3a6c70feaf1, 0x90fd49b66cbd81d1,
+    0xe2943e0c1db254e8, 0xecfa6adeca8834a1, 0xf513e212593ee321,
+    0xf36ae57331040916, 0x63fbd333b87b6717, 0xbd60f8e152f50b8b,
+    0xa5ce4a8299c1567d, 0x0bd445f0cbdb55ee, 0xfdd6824e20134285,
+    0xcead8b6ebda2227a, 0xe44b17e4f5d4fb5c, 0x9b29c81ad01ca7c5,
+    0x1b4366e40fea4055, 0x27bca1551aae167b, 0xaa57bcd1b39a5690,
+    0xd7fce83fa1234db9, 0xcce4986efea3ff8e, 0x3602a4d9e65341f1,
+    0x722b1da2df516145, 0xecfc3ddd3a08da83, 0x0fb96dcca83507e6,
+    0x125f2fe78d70f080, 0x842f50b7651aa516, 0x09bc34188cd9836f,
+    0xf43666c84196d909, 0xb56feb30c0df6ccb, 0xaa66e04ce7f30958,
+    0xb7b1187e9af29547, 0x113255f8476495de, 0x8fb19f783095d77e,
+    0xaec4aacc7c82b133, 0xf64e6d09218428cf, 0x036a72ea5ac258a0,
+    0x5235ef12eb7aaa6a, 0x2fed7b1685657853, 0x8ef8951d46606fb5,
+    0x9d58c1090f034d14, 0x36f6c59a9fdaa97b, 0xbe2d517d98682592};
+
+static const uint64_t crc64_nvme_table[][256] = {
+   {0x0000000000000000, 0x7f6ef0c830358979, 0xfedde190606b12f2,
+    0x81b31158505e9b8b, 0xc962e5739841b68f, 0xb60c15bba8743ff6,
+    0x37bf04e3f82aa47d, 0x48d1f42bc81f2d04, 0xa61cecb46814fe75,
+    0xd9721c7c5821770c, 0x58c10d24087fec87, 0x27affdec384a65fe,
+    0x6f7e09c7f05548fa, 0x1010f90fc060c183, 0x91a3e857903e5a08,
+    0xeecd189fa00bd371, 0x78e0ff3b88be6f81, 0x078e0ff3b88be6f8,
+    0x863d1eabe8d57d73, 0xf953ee63d8e0f40a, 0xb1821a4810ffd90e,
+    0xceecea8020ca5077, 0x4f5ffbd87094cbfc, 0x30310b1040a14285,
+    0xdefc138fe0aa91f4, 0xa192e347d09f188d, 0x2021f21f80c18306,
+    0x5f4f02d7b0f40a7f, 0x179ef6fc78eb277b, 0x68f0063448deae02,
+    0xe943176c18803589, 0x962de7a428b5bcf0, 0xf1c1fe77117cdf02,
+    0x8eaf0ebf2149567b, 0x0f1c1fe77117cdf0, 0x7072ef2f41224489,
+    0x38a31b04893d698d, 0x47cdebccb908e0f4, 0xc67efa94e9567b7f,
+    0xb9100a5cd963f206, 0x57dd12c379682177, 0x28b3e20b495da80e,
+    0xa900f35319033385, 0xd66e039b2936bafc, 0x9ebff7b0e12997f8,
+    0xe1d10778d11c1e81, 0x606216208142850a, 0x1f0ce6e8b1770c73,
+    0x8921014c99c2b083, 0xf64ff184a9f739fa, 0x77fce0dcf9a9a271,
+    0x08921014c99c2b08, 0x4043e43f0183060c, 0x3f2d14f731b68f75,
+    0xbe9e05af61e814fe, 0xc1f0f56751dd9d87, 0x2f3dedf8f1d64ef6,
+    0x50531d30c1e3c78f, 0xd1e00c6891bd5c04, 0xae8efca0a188d57d,
+    0xe65f088b6997f879, 0x9931f84359a27100, 0x1882e91b09fcea8b,
+    0x67ec19d339c963f2, 0xd75adabd7a6e2d6f, 0xa8342a754a5ba416,
+    0x29873b2d1a053f9d, 0x56e9cbe52a30b6e4, 0x1e383fcee22f9be0,
+    0x6156cf06d21a1299, 0xe0e5de5e82448912, 0x9f8b2e96b271006b,
+    0x71463609127ad31a, 0x0e28c6c1224f5a63, 0x8f9bd7997211c1e8,
+    0xf0f5275142244891, 0xb824d37a8a3b6595, 0xc74a23b2ba0eecec,
+    0x46f932eaea507767, 0x3997c222da65fe1e, 0xafba2586f2d042ee,
+    0xd0d4d54ec2e5cb97, 0x5167c41692bb501c, 0x2e0934dea28ed965,
+    0x66d8c0f56a91f461, 0x19b6303d5aa47d18, 0x980521650afae693,
+    0xe76bd1ad3acf6fea, 0x09a6c9329ac4bc9b, 0x76c839faaaf135e2,
+    0xf77b28a2faafae69, 0x8815d86aca9a2710, 0xc0c42c4102850a14,
+    0xbfaadc8932b0836d, 0x3e19cdd162ee18e6, 0x41773d1952db919f,
+    0x269b24ca6b12f26d, 0x59f5d4025b277b14, 0xd846c55a0b79e09f,
+    0xa72835923b4c69e6, 0xeff9c1b9f35344e2, 0x90973171c366cd9b,
+    0x1124202993385610, 0x6e4ad0e1a30ddf69, 0x8087c87e03060c18,
+    0xffe938b633338561, 0x7e5a29ee636d1eea, 0x0134d92653589793,
+    0x49e52d0d9b47ba97, 0x368bddc5ab7233ee, 0xb738cc9dfb2ca865,
+    0xc8563c55cb19211c, 0x5e7bdbf1e3ac9dec, 0x21152b39d3991495,
+    0xa0a63a6183c78f1e, 0xdfc8caa9b3f20667, 0x97193e827bed2b63,
+    0xe877ce4a4bd8a21a, 0x69c4df121b863991, 0x16aa2fda2bb3b0e8,
+    0xf86737458bb86399, 0x8709c78dbb8deae0, 0x06bad6d5ebd3716b,
+    0x79d4261ddbe6f812, 0x3105d23613f9d516, 0x4e6b22fe23cc5c6f,
+    0xcfd833a67392c7e4, 0xb0b6c36e43a74e9d, 0x9a6c9329ac4bc9b5,
+    0xe50263e19c7e40cc, 0x64b172b9cc20db47, 0x1bdf8271fc15523e,
+    0x530e765a340a7f3a, 0x2c608692043ff643, 0xadd397ca54616dc8,
+    0xd2bd67026454e4b1, 0x3c707f9dc45f37c0, 0x431e8f55f46abeb9,
+    0xc2ad9e0da4342532, 0xbdc36ec59401ac4b, 0xf5129aee5c1e814f,
+    0x8a7c6a266c2b0836, 0x0bcf7b7e3c7593bd, 0x74a18bb60c401ac4,
+    0xe28c6c1224f5a634, 0x9de29cda14c02f4d, 0x1c518d82449eb4c6,
+    0x633f7d4a74ab3dbf, 0x2bee8961bcb410bb, 0x548079a98c8199c2,
+    0xd53368f1dcdf0249, 0xaa5d9839ecea8b30, 0x449080a64ce15841,
+    0x3bfe706e7cd4d138, 0xba4d61362c8a4ab3, 0xc52391fe1cbfc3ca,
+    0x8df265d5d4a0eece, 0xf29c951de49567b7, 0x732f8445b4cbfc3c,
+    0x0c41748d84fe7545, 0x6bad6d5ebd3716b7, 0x14c39d968d029fce,
+    0x95708ccedd5c0445, 0xea1e7c06ed698d3c, 0xa2cf882d2576a038,
+    0xdda178e515432941, 0x5c1269bd451db2ca, 0x237c997575283bb3,
+    0xcdb181ead523e8c2, 0xb2df7122e51661bb, 0x336c607ab548fa30,
+    0x4c0290b2857d7349, 0x04d364994d625e4d, 0x7bbd94517d57d734,
+    0xfa0e85092d094cbf, 0x856075c11d3cc5c6, 0x134d926535897936,
+    0x6c2362ad05bcf04f, 0xed9073f555e26bc4, 0x92fe833d65d7e2bd,
+    0xda2f7716adc8cfb9, 0xa54187de9dfd46c0, 0x24f29686cda3dd4b,
+    0x5b9c664efd965432, 0xb5517ed15d9d8743, 0xca3f8e196da80e3a,
+    0x4b8c9f413df695b1, 0x34e26f890dc31cc8, 0x7c339ba2c5dc31cc,
+    0x035d6b6af5e9b8b5, 0x82ee7a32a5b7233e, 0xfd808afa9582aa47,
+    0x4d364994d625e4da, 0x3258b95ce6106da3, 0xb3eba804b64ef628,
+    0xcc8558cc867b7f51, 0x8454ace74e645255, 0xfb3a5c2f7e51db2c,
+    0x7a894d772e0f40a7, 0x05e7bdbf1e3ac9de, 0xeb2aa520be311aaf,
+    0x944455e88e0493d6, 0x15f744b0de5a085d, 0x6a99b478ee6f8124,
+    0x224840532670ac20, 0x5d26b09b16452559, 0xdc95a1c3461bbed2,
+    0xa3fb510b762e37ab, 0x35d6b6af5e9b8b5b, 0x4ab846676eae0222,
+    0xcb0b573f3ef099a9, 0xb465a7f70ec510d0, 0xfcb453dcc6da3dd4,
+    0x83daa314f6efb4ad, 0x0269b24ca6b12f26, 0x7d0742849684a65f,
+    0x93ca5a1b368f752e, 0xeca4aad306bafc57, 0x6d17bb8b56e467dc,
+    0x12794b4366d1eea5, 0x5aa8bf68aecec3a1, 0x25c64fa09efb4ad8,
+    0xa4755ef8cea5d153, 0xdb1bae30fe90582a, 0xbcf7b7e3c7593bd8,
+    0xc399472bf76cb2a1, 0x422a5673a732292a, 0x3d44a6bb9707a053,
+    0x759552905f188d57, 0x0afba2586f2d042e, 0x8b48b3003f739fa5,
+    0xf42643c80f4616dc, 0x1aeb5b57af4dc5ad, 0x6585ab9f9f784cd4,
+    0xe436bac7cf26d75f, 0x9b584a0fff135e26, 0xd389be24370c7322,
+    0xace74eec0739fa5b, 0x2d545fb4576761d0, 0x523aaf7c6752e8a9,
+    0xc41748d84fe75459, 0xbb79b8107fd2dd20, 0x3acaa9482f8c46ab,
+    0x45a459801fb9cfd2, 0x0d75adabd7a6e2d6, 0x721b5d63e7936baf,
+    0xf3a84c3bb7cdf024, 0x8cc6bcf387f8795d, 0x620ba46c27f3aa2c,
+    0x1d6554a417c62355, 0x9cd645fc4798b8de, 0xe3b8b53477ad31a7,
+    0xab69411fbfb21ca3, 0xd407b1d78f8795da, 0x55b4a08fdfd90e51,
+    0x2ada5047efec8728},
+   {0x0000000000000000, 0x8776a97d73bddf69, 0x3a3474a9bfec2db9,
+    0xbd42ddd4cc51f2d0, 0x7468e9537fd85b72, 0xf31e402e0c65841b,
+    0x4e5c9dfac03476cb, 0xc92a3487b389a9a2, 0xe8d1d2a6ffb0b6e4,
+    0x6fa77bdb8c0d698d, 0xd2e5a60f405c9b5d, 0x55930f7233e14434,
+    0x9cb93bf58068ed96, 0x1bcf9288f3d532ff, 0xa68d4f5c3f84c02f,
+    0x21fbe6214c391f46, 0xe57a831ea7f6fea3, 0x620c2a63d44b21ca,
+    0xdf4ef7b7181ad31a, 0x58385eca6ba70c73, 0x91126a4dd82ea5d1,
+    0x1664c330ab937ab8, 0xab261ee467c28868, 0x2c50b799147f5701,
+    0x0dab51b858464847, 0x8addf8c52bfb972e, 0x379f2511e7aa65fe,
+    0xb0e98c6c9417ba97, 0x79c3b8eb279e1335, 0xfeb511965423cc5c,
+    0x43f7cc4298723e8c, 0xc481653febcfe1e5, 0xfe2c206e177a6e2d,
+    0x795a891364c7b144, 0xc41854c7a8964394, 0x436efdbadb2b9cfd,
+    0x8a44c93d68a2355f, 0x0d3260401b1fea36, 0xb070bd94d74e18e6,
+    0x370614e9a4f3c78f, 0x16fdf2c8e8cad8c9, 0x918b5bb59b7707a0,
+    0x2cc986615726f570, 0xabbf2f1c249b2a19, 0x62951b9b971283bb,
+    0xe5e3b2e6e4af5cd2, 0x58a16f3228feae02, 0xdfd7c64f5b43716b,
+    0x1b56a370b08c908e, 0x9c200a0dc3314fe7, 0x2162d7d90f60bd37,
+    0xa6147ea47cdd625e, 0x6f3e4a23cf54cbfc, 0xe848e35ebce91495,
+    0x550a3e8a70b8e645, 0xd27c97f70305392c, 0xf38771d64f3c266a,
+    0x74f1d8ab3c81f903, 0xc9b3057ff0d00bd3, 0x4ec5ac02836dd4ba,
+    0x87ef988530e47d18, 0x009931f84359a271, 0xbddbec2c8f0850a1,
+    0x3aad4551fcb58fc8, 0xc881668f76634f31, 0x4ff7cff205de9058,
+    0xf2b51226c98f6288, 0x75c3bb5bba32bde1, 0xbce98fdc09bb1443,
+    0x3b9f26a17a06cb2a, 0x86ddfb75b65739fa, 0x01ab5208c5eae693,
+    0x2050b42989d3f9d5, 0xa7261d54fa6e26bc, 0x1a64c080363fd46c,
+    0x9d1269fd45820b05, 0x54385d7af60ba2a7, 0xd34ef40785b67dce,
+    0x6e0c29d349e78f1e, 0xe97a80ae3a5a5077, 0x2dfbe591d195b192,
+    0xaa8d4ceca2286efb, 0x17cf91386e799c2b, 0x90b938451dc44342,
+    0x59930cc2ae4deae0, 0xdee5a5bfddf03589, 0x63a7786b11a1c759,
+    0xe4d1d116621c1830, 0xc52a37372e250776, 0x425c9e4a5d98d81f,
+    0xff1e439e91c92acf, 0x7868eae3e274f5a6, 0xb142de6451fd5c04,
+    0x363477192240836d, 0x8b76aacdee1171bd, 0x0c0003b09dacaed4,
+    0x36ad46e16119211c, 0xb1dbef9c12a4fe75, 0x0c993248def50ca5,
+    0x8bef9b35ad48d3cc, 0x42c5afb21ec17a6e, 0xc5b306cf6d7ca507,
+    0x78f1db1ba12d57d7, 0xff877266d29088be, 0xde7c94479ea997f8,
+    0x590a3d3aed144891, 0xe448e0ee2145ba41, 0x633e499352f86528,
+    0xaa147d14e171cc8a, 0x2d62d46992cc13e3, 0x902009bd5e9de133,
+    0x1756a0c02d203e5a, 0xd3d7c5ffc6efdfbf, 0x54a16c82b55200d6,
+    0xe9e3b1567903f206, 0x6e95182b0abe2d6f, 0xa7bf2cacb93784cd,
+    0x20c985d1ca8a5ba4, 0x9d8b580506dba974, 0x1afdf1787566761d,
+    0x3b061759395f695b, 0xbc70be244ae2b632, 0x013263f086b344e2,
+    0x8644ca8df50e9b8b, 0x4f6efe0a46873229, 0xc8185777353aed40,
+    0x755a8aa3f96b1f90, 0xf22c23de8ad6c0f9, 0xa5dbeb4db4510d09,
+    0x22ad4230c7ecd260, 0x9fef9fe40bbd20b0, 0x189936997800ffd9,
+    0xd1b3021ecb89567b, 0x56c5ab63b8348912, 0xeb8776b774657bc2,
+    0x6cf1dfca07d8a4ab, 0x4d0a39eb4be1bbed, 0xca7c9096385c6484,
+    0x773e4d42f40d9654, 0xf048e43f87b0493d, 0x3962d0b83439e09f,
+    0xbe1479c547843ff6, 0x0356a4118bd5cd26, 0x84200d6cf868124f,
+    0x40a1685313a7f3aa, 0xc7d7c12e601a2cc3, 0x7a951cfaac4bde13,
+    0xfde3b587dff6017a, 0x34c981006c7fa8d8, 0xb3bf287d1fc277b1,
+    0x0efdf5a9d3938561, 0x898b5cd4a02e5a08, 0xa870baf5ec17454e,
+    0x2f0613889faa9a27, 0x9244ce5c53fb68f7, 0x153267212046b79e,
+    0xdc1853a693cf1e3c, 0x5b6efadbe072c155, 0xe62c270f2c233385,
+    0x615a8e725f9eecec, 0x5bf7cb23a32b6324, 0xdc81625ed096bc4d,
+    0x61c3bf8a1cc74e9d, 0xe6b516f76f7a91f4, 0x2f9f2270dcf33856,
+    0xa8e98b0daf4ee73f, 0x15ab56d9631f15ef, 0x92ddffa410a2ca86,
+    0xb32619855c9bd5c0, 0x3450b0f82f260aa9, 0x89126d2ce377f879,
+    0x0e64c45190ca2710, 0xc74ef0d623438eb2, 0x403859ab50fe51db,
+    0xfd7a847f9cafa30b, 0x7a0c2d02ef127c62, 0xbe8d483d04dd9d87,
+    0x39fbe140776042ee, 0x84b93c94bb31b03e, 0x03cf95e9c88c6f57,
+    0xcae5a16e7b05c6f5, 0x4d93081308b8199c, 0xf0d1d5c7c4e9eb4c,
+    0x77a77cbab7543425, 0x565c9a9bfb6d2b63, 0xd12a33e688d0f40a,
+    0x6c68ee32448106da, 0xeb1e474f373cd9b3, 0x223473c884b57011,
+    0xa542dab5f708af78, 0x180007613b595da8, 0x9f76ae1c48e482c1,
+    0x6d5a8dc2c2324238, 0xea2c24bfb18f9d51, 0x576ef96b7dde6f81,
+    0xd01850160e63b0e8, 0x19326491bdea194a, 0x9e44cdecce57c623,
+    0x23061038020634f3, 0xa470b94571bbeb9a, 0x858b5f643d82f4dc,
+    0x02fdf6194e3f2bb5, 0xbfbf2bcd826ed965, 0x38c982b0f1d3060c,
+    0xf1e3b637425aafae, 0x76951f4a31e770c7, 0xcbd7c29efdb68217,
+    0x4ca16be38e0b5d7e, 0x88200edc65c4bc9b, 0x0f56a7a1167963f2,
+    0xb2147a75da289122, 0x3562d308a9954e4b, 0xfc48e78f1a1ce7e9,
+    0x7b3e4ef269a13880, 0xc67c9326a5f0ca50, 0x410a3a5bd64d1539,
+    0x60f1dc7a9a740a7f, 0xe7877507e9c9d516, 0x5ac5a8d3259827c6,
+    0xddb301ae5625f8af, 0x14993529e5ac510d, 0x93ef9c5496118e64,
+    0x2ead41805a407cb4, 0xa9dbe8fd29fda3dd, 0x9376adacd5482c15,
+    0x140004d1a6f5f37c, 0xa942d9056aa401ac, 0x2e3470781919dec5,
+    0xe71e44ffaa907767, 0x6068ed82d92da80e, 0xdd2a3056157c5ade,
+    0x5a5c992b66c185b7, 0x7ba77f0a2af89af1, 0xfcd1d67759454598,
+    0x41930ba39514b748, 0xc6e5a2dee6a96821, 0x0fcf96595520c183,
+    0x88b93f24269d1eea, 0x35fbe2f0eaccec3a, 0xb28d4b8d99713353,
+    0x760c2eb272bed2b6, 0xf17a87cf01030ddf, 0x4c385a1bcd52ff0f,
+    0xcb4ef366beef2066, 0x0264c7e10d6689c4, 0x85126e9c7edb56ad,
+    0x3850b348b28aa47d, 0xbf261a35c1377b14, 0x9eddfc148d0e6452,
+    0x19ab5569feb3bb3b, 0xa4e988bd32e249eb, 0x239f21c0415f9682,
+    0xeab51547f2d63f20, 0x6dc3bc3a816be049, 0xd08161ee4d3a1299,
+    0x57f7c8933e87cdf0},
+   {0x0000000000000000, 0xff6e4e1f4e4038be, 0xca05ba6dc417e217,
+    0x356bf4728a57daa9, 0xa0d25288d0b85745, 0x5fbc1c979ef86ffb,
+    0x6ad7e8e514afb552, 0x95b9a6fa5aef8dec, 0x757d8342f9e73de1,
+    0x8a13cd5db7a7055f, 0xbf78392f3df0dff6, 0x4016773073b0e748,
+    0xd5afd1ca295f6aa4, 0x2ac19fd5671f521a, 0x1faa6ba7ed4888b3,
+    0xe0c425b8a308b00d, 0xeafb0685f3ce7bc2, 0x1595489abd8e437c,
+    0x20febce837d999d5, 0xdf90f2f77999a16b, 0x4a29540d23762c87,
+    0xb5471a126d361439, 0x802cee60e761ce90, 0x7f42a07fa921f62e,
+    0x9f8685c70a294623, 0x60e8cbd844697e9d, 0x55833faace3ea434,
+    0xaaed71b5807e9c8a, 0x3f54d74fda911166, 0xc03a995094d129d8,
+    0xf5516d221e86f371, 0x0a3f233d50c6cbcf, 0xe12f2b58bf0b64ef,
+    0x1e416547f14b5c51, 0x2b2a91357b1c86f8, 0xd444df2a355cbe46,
+    0x41fd79d06fb333aa, 0xbe9337cf21f30b14, 0x8bf8c3bdaba4d1bd,
+    0x74968da2e5e4e903, 0x9452a81a46ec590e, 0x6b3ce60508ac61b0,
+    0x5e57127782fbbb19, 0xa1395c68ccbb83a7, 0x3480fa9296540e4b,
+    0xcbeeb48dd81436f5, 0xfe8540ff5243ec5c, 0x01eb0ee01c03d4e2,
+    0x0bd42ddd4cc51f2d, 0xf4ba63c202852793, 0xc1d197b088d2fd3a,
+    0x3ebfd9afc692c584, 0xab067f559c7d4868, 0x5468314ad23d70d6,
+    0x6103c538586aaa7f, 0x9e6d8b27162a92c1, 0x7ea9ae9fb52222cc,
+    0x81c7e080fb621a72, 0xb4ac14f27135c0db, 0x4bc25aed3f75f865,
+    0xde7bfc17659a7589, 0x2115b2082bda4d37, 0x147e467aa18d979e,
+    0xeb100865efcdaf20, 0xf68770e226815ab5, 0x09e93efd68c1620b,
+    0x3c82ca8fe296b8a2, 0xc3ec8490acd6801c, 0x5655226af6390df0,
+    0xa93b6c75b879354e, 0x9c509807322eefe7, 0x633ed6187c6ed759,
+    0x83faf3a0df666754, 0x7c94bdbf91265fea, 0x49ff49cd1b718543,
+    0xb69107d25531bdfd, 0x2328a1280fde3011, 0xdc46ef37419e08af,
+    0xe92d1b45cbc9d206, 0x1643555a8589eab8, 0x1c7c7667d54f2177,
+    0xe31238789b0f19c9, 0xd679cc0a1158c360, 0x291782155f18fbde,
+    0xbcae24ef05f77632, 0x43c06af04bb74e8c, 0x76ab9e82c1e09425,
+    0x89c5d09d8fa0ac9b, 0x6901f5252ca81c96, 0x966fbb3a62e82428,
+    0xa3044f48e8bffe81, 0x5c6a0157a6ffc63f, 0xc9d3a7adfc104bd3,
+    0x36bde9b2b250736d, 0x03d61dc03807a9c4, 0xfcb853df7647917a,
+    0x17a85bba998a3e5a, 0xe8c615a5d7ca06e4, 0xddade1d75d9ddc4d,
+    0x22c3afc813dde4f3, 0xb77a09324932691f, 0x4814472d077251a1,
+    0x7d7fb35f8d258b08, 0x8211fd40c365b3b6, 0x62d5d8f8606d03bb,
+    0x9dbb96e72e2d3b05, 0xa8d06295a47ae1ac, 0x57be2c8aea3ad912,
+    0xc2078a70b0d554fe, 0x3d69c46ffe956c40, 0x0802301d74c2b6e9,
+    0xf76c7e023a828e57, 0xfd535d3f6a444598, 0x023d132024047d26,
+    0x3756e752ae53a78f, 0xc838a94de0139f31, 0x5d810fb7bafc12dd,
+    0xa2ef41a8f4bc2a63, 0x9784b5da7eebf0ca, 0x68eafbc530abc874,
+    0x882ede7d93a37879, 0x77409062dde340c7, 0x422b641057b49a6e,
+    0xbd452a0f19f4a2d0, 0x28fc8cf5431b2f3c, 0xd792c2ea0d5b1782,
+    0xe2f93698870ccd2b, 0x1d977887c94cf595, 0xd9d7c79715952601,
+    0x26b989885bd51ebf, 0x13d27dfad182c416, 0xecbc33e59fc2fca8,
+    0x7905951fc52d7144, 0x866bdb008b6d49fa, 0xb3002f72013a9353,
+    0x4c6e616d4f7aabed, 0xacaa44d5ec721be0, 0x53c40acaa232235e,
+    0x66affeb82865f9f7, 0x99c1b0a76625c149, 0x0c78165d3cca4ca5,
+    0xf3165842728a741b, 0xc67dac30f8ddaeb2, 0x3913e22fb69d960c,
+    0x332cc112e65b5dc3, 0xcc428f0da81b657d, 0xf9297b7f224cbfd4,
+    0x064735606c0c876a, 0x93fe939a36e30a86, 0x6c90dd8578a33238,
+    0x59fb29f7f2f4e891, 0xa69567e8bcb4d02f, 0x465142501fbc6022,
+    0xb93f0c4f51fc589c, 0x8c54f83ddbab8235, 0x733ab62295ebba8b,
+    0xe68310d8cf043767, 0x19ed5ec781440fd9, 0x2c86aab50b13d570,
+    0xd3e8e4aa4553edce, 0x38f8eccfaa9e42ee, 0xc796a2d0e4de7a50,
+    0xf2fd56a26e89a0f9, 0x0d9318bd20c99847, 0x982abe477a2615ab,
+    0x6744f05834662d15, 0x522f042abe31f7bc, 0xad414a35f071cf02,
+    0x4d856f8d53797f0f, 0xb2eb21921d3947b1, 0x8780d5e0976e9d18,
+    0x78ee9bffd92ea5a6, 0xed573d0583c1284a, 0x1239731acd8110f4,
+    0x2752876847d6ca5d, 0xd83cc9770996f2e3, 0xd203ea4a5950392c,
+    0x2d6da45517100192, 0x180650279d47db3b, 0xe7681e38d307e385,
+    0x72d1b8c289e86e69, 0x8dbff6ddc7a856d7, 0xb8d402af4dff8c7e,
+    0x47ba4cb003bfb4c0, 0xa77e6908a0b704cd, 0x58102717eef73c73,
+    0x6d7bd36564a0e6da, 0x92159d7a2ae0de64, 0x07ac3b80700f5388,
+    0xf8c2759f3e4f6b36, 0xcda981edb418b19f, 0x32c7cff2fa588921,
+    0x2f50b77533147cb4, 0xd03ef96a7d54440a, 0xe5550d18f7039ea3,
+    0x1a3b4307b943a61d, 0x8f82e5fde3ac2bf1, 0x70ecabe2adec134f,
+    0x45875f9027bbc9e6, 0xbae9118f69fbf158, 0x5a2d3437caf34155,
+    0xa5437a2884b379eb, 0x90288e5a0ee4a342, 0x6f46c04540a49bfc,
+    0xfaff66bf1a4b1610, 0x059128a0540b2eae, 0x30fadcd2de5cf407,
+    0xcf9492cd901cccb9, 0xc5abb1f0c0da0776, 0x3ac5ffef8e9a3fc8,
+    0x0fae0b9d04cde561, 0xf0c045824a8ddddf, 0x6579e37810625033,
+    0x9a17ad675e22688d, 0xaf7c5915d475b224, 0x5012170a9a358a9a,
+    0xb0d632b2393d3a97, 0x4fb87cad777d0229, 0x7ad388dffd2ad880,
+    0x85bdc6c0b36ae03e, 0x1004603ae9856dd2, 0xef6a2e25a7c5556c,
+    0xda01da572d928fc5, 0x256f944863d2b77b, 0xce7f9c2d8c1f185b,
+    0x3111d232c25f20e5, 0x047a26404808fa4c, 0xfb14685f0648c2f2,
+    0x6eadcea55ca74f1e, 0x91c380ba12e777a0, 0xa4a874c898b0ad09,
+    0x5bc63ad7d6f095b7, 0xbb021f6f75f825ba, 0x446c51703bb81d04,
+    0x7107a502b1efc7ad, 0x8e69eb1dffafff13, 0x1bd04de7a54072ff,
+    0xe4be03f8eb004a41, 0xd1d5f78a615790e8, 0x2ebbb9952f17a856,
+    0x24849aa87fd16399, 0xdbead4b731915b27, 0xee8120c5bbc6818e,
+    0x11ef6edaf586b930, 0x8456c820af6934dc, 0x7b38863fe1290c62,
+    0x4e53724d6b7ed6cb, 0xb13d3c52253eee75, 0x51f919ea86365e78,
+    0xae9757f5c87666c6, 0x9bfca3874221bc6f, 0x6492ed980c6184d1,
+    0xf12b4b62568e093d, 0x0e45057d18ce3183, 0x3b2ef10f9299eb2a,
+    0xc440bf10dcd9d394},
+   {0x0000000000000000, 0x8211147cbaf96306, 0x30fb0eaa2d655567,
+    0xb2ea1ad6979c3661, 0x61f61d545acaaace, 0xe3e70928e033c9c8,
+    0x510d13fe77afffa9, 0xd31c0782cd569caf, 0xc3ec3aa8b595559c,
+    0x41fd2ed40f6c369a, 0xf317340298f000fb, 0x7106207e220963fd,
+    0xa21a27fcef5fff52, 0x200b338055a69c54, 0x92e12956c23aaa35,
+    0x10f03d2a78c3c933, 0xb301530233bd3853, 0x3110477e89445b55,
+    0x83fa5da81ed86d34, 0x01eb49d4a4210e32, 0xd2f74e566977929d,
+    0x50e65a2ad38ef19b, 0xe20c40fc4412c7fa, 0x601d5480feeba4fc,
+    0x70ed69aa86286dcf, 0xf2fc7dd63cd10ec9, 0x40166700ab4d38a8,
+    0xc207737c11b45bae, 0x111b74fedce2c701, 0x930a6082661ba407,
+    0x21e07a54f1879266, 0xa3f16e284b7ef160, 0x52db80573fede3cd,
+    0xd0ca942b851480cb, 0x62208efd1288b6aa, 0xe0319a81a871d5ac,
+    0x332d9d0365274903, 0xb13c897fdfde2a05, 0x03d693a948421c64,
+    0x81c787d5f2bb7f62, 0x9137baff8a78b651, 0x1326ae833081d557,
+    0xa1ccb455a71de336, 0x23dda0291de48030, 0xf0c1a7abd0b21c9f,
+    0x72d0b3d76a4b7f99, 0xc03aa901fdd749f8, 0x422bbd7d472e2afe,
+    0xe1dad3550c50db9e, 0x63cbc729b6a9b898, 0xd121ddff21358ef9,
+    0x5330c9839bccedff, 0x802cce01569a7150, 0x023dda7dec631256,
+    0xb0d7c0ab7bff2437, 0x32c6d4d7c1064731, 0x2236e9fdb9c58e02,
+    0xa027fd81033ced04, 0x12cde75794a0db65, 0x90dcf32b2e59b863,
+    0x43c0f4a9e30f24cc, 0xc1d1e0d559f647ca, 0x733bfa03ce6a71ab,
+    0xf12aee7f749312ad, 0xa5b700ae7fdbc79a, 0x27a614d2c522a49c,
+    0x954c0e0452be92fd, 0x175d1a78e847f1fb, 0xc4411dfa25116d54,
+    0x465009869fe80e52, 0xf4ba135008743833, 0x76ab072cb28d5b35,
+    0x665b3a06ca4e9206, 0xe44a2e7a70b7f100, 0x56a034ace72bc761,
+    0xd4b120d05dd2a467, 0x07ad2752908438c8, 0x85bc332e2a7d5bce,
+    0x375629f8bde16daf, 0xb5473d8407180ea9, 0x16b653ac4c66ffc9,
+    0x94a747d0f69f9ccf, 0x264d5d066103aaae, 0xa45c497adbfac9a8,
+    0x77404ef816ac5507, 0xf5515a84ac553601, 0x47bb40523bc90060,
+    0xc5aa542e81306366, 0xd55a6904f9f3aa55, 0x574b7d78430ac953,
+    0xe5a167aed496ff32, 0x67b073d26e6f9c34, 0xb4ac7450a339009b,
+    0x36bd602c19c0639d, 0x84577afa8e5c55fc, 0x06466e8634a536fa,
+    0xf76c80f940362457, 0x757d9485facf4751, 0xc7978e536d537130,
+    0x45869a2fd7aa1236, 0x969a9dad1afc8e99, 0x148b89d1a005ed9f,
+    0xa66193073799dbfe, 0x2470877b8d60b8f8, 0x3480ba51f5a371cb,
+    0xb691ae2d4f5a12cd, 0x047bb4fbd8c624ac, 0x866aa087623f47aa,
+    0x5576a705af69db05, 0xd767b3791590b803, 0x658da9af820c8e62,
+    0xe79cbdd338f5ed64, 0x446dd3fb738b1c04, 0xc67cc787c9727f02,
+    0x7496dd515eee4963, 0xf687c92de4172a65, 0x259bceaf2941b6ca,
+    0xa78adad393b8d5cc, 0x1560c0050424e3ad, 0x9771d479bedd80ab,
+    0x8781e953c61e4998, 0x0590fd2f7ce72a9e, 0xb77ae7f9eb7b1cff,
+    0x356bf38551827ff9, 0xe677f4079cd4e356, 0x6466e07b262d8050,
+    0xd68cfaadb1b1b631, 0x549deed10b48d537, 0x7fb7270fa7201c5f,
+    0xfda633731dd97f59, 0x4f4c29a58a454938, 0xcd5d3dd930bc2a3e,
+    0x1e413a5bfdeab691, 0x9c502e274713d597, 0x2eba34f1d08fe3f6,
+    0xacab208d6a7680f0, 0xbc5b1da712b549c3, 0x3e4a09dba84c2ac5,
+    0x8ca0130d3fd01ca4, 0x0eb1077185297fa2, 0xddad00f3487fe30d,
+    0x5fbc148ff286800b, 0xed560e59651ab66a, 0x6f471a25dfe3d56c,
+    0xccb6740d949d240c, 0x4ea760712e64470a, 0xfc4d7aa7b9f8716b,
+    0x7e5c6edb0301126d, 0xad406959ce578ec2, 0x2f517d2574aeedc4,
+    0x9dbb67f3e332dba5, 0x1faa738f59cbb8a3, 0x0f5a4ea521087190,
+    0x8d4b5ad99bf11296, 0x3fa1400f0c6d24f7, 0xbdb05473b69447f1,
+    0x6eac53f17bc2db5e, 0xecbd478dc13bb858, 0x5e575d5b56a78e39,
+    0xdc464927ec5eed3f, 0x2d6ca75898cdff92, 0xaf7db32422349c94,
+    0x1d97a9f2b5a8aaf5, 0x9f86bd8e0f51c9f3, 0x4c9aba0cc207555c,
+    0xce8bae7078fe365a, 0x7c61b4a6ef62003b, 0xfe70a0da559b633d,
+    0xee809df02d58aa0e, 0x6c91898c97a1c908, 0xde7b935a003dff69,
+    0x5c6a8726bac49c6f, 0x8f7680a4779200c0, 0x0d6794d8cd6b63c6,
+    0xbf8d8e0e5af755a7, 0x3d9c9a72e00e36a1, 0x9e6df45aab70c7c1,
+    0x1c7ce0261189a4c7, 0xae96faf0861592a6, 0x2c87ee8c3cecf1a0,
+    0xff9be90ef1ba6d0f, 0x7d8afd724b430e09, 0xcf60e7a4dcdf3868,
+    0x4d71f3d866265b6e, 0x5d81cef21ee5925d, 0xdf90da8ea41cf15b,
+    0x6d7ac0583380c73a, 0xef6bd4248979a43c, 0x3c77d3a6442f3893,
+    0xbe66c7dafed65b95, 0x0c8cdd0c694a6df4, 0x8e9dc970d3b30ef2,
+    0xda0027a1d8fbdbc5, 0x581133dd6202b8c3, 0xeafb290bf59e8ea2,
+    0x68ea3d774f67eda4, 0xbbf63af58231710b, 0x39e72e8938c8120d,
+    0x8b0d345faf54246c, 0x091c202315ad476a, 0x19ec1d096d6e8e59,
+    0x9bfd0975d797ed5f, 0x291713a3400bdb3e, 0xab0607dffaf2b838,
+    0x781a005d37a42497, 0xfa0b14218d5d4791, 0x48e10ef71ac171f0,
+    0xcaf01a8ba03812f6, 0x690174a3eb46e396, 0xeb1060df51bf8090,
+    0x59fa7a09c623b6f1, 0xdbeb6e757cdad5f7, 0x08f769f7b18c4958,
+    0x8ae67d8b0b752a5e, 0x380c675d9ce91c3f, 0xba1d732126107f39,
+    0xaaed4e0b5ed3b60a, 0x28fc5a77e42ad50c, 0x9a1640a173b6e36d,
+    0x180754ddc94f806b, 0xcb1b535f04191cc4, 0x490a4723bee07fc2,
+    0xfbe05df5297c49a3, 0x79f1498993852aa5, 0x88dba7f6e7163808,
+    0x0acab38a5def5b0e, 0xb820a95cca736d6f, 0x3a31bd20708a0e69,
+    0xe92dbaa2bddc92c6, 0x6b3caede0725f1c0, 0xd9d6b40890b9c7a1,
+    0x5bc7a0742a40a4a7, 0x4b379d5e52836d94, 0xc9268922e87a0e92,
+    0x7bcc93f47fe638f3, 0xf9dd8788c51f5bf5, 0x2ac1800a0849c75a,
+    0xa8d09476b2b0a45c, 0x1a3a8ea0252c923d, 0x982b9adc9fd5f13b,
+    0x3bdaf4f4d4ab005b, 0xb9cbe0886e52635d, 0x0b21fa5ef9ce553c,
+    0x8930ee224337363a, 0x5a2ce9a08e61aa95, 0xd83dfddc3498c993,
+    0x6ad7e70aa304fff2, 0xe8c6f37619fd9cf4, 0xf836ce5c613e55c7,
+    0x7a27da20dbc736c1, 0xc8cdc0f64c5b00a0, 0x4adcd48af6a263a6,
+    0x99c0d3083bf4ff09, 0x1bd1c774810d9c0f, 0xa93bdda21691aa6e,
+    0x2b2ac9deac68c968},
+   {0x0000000000000000, 0x373d15f784905d1e, 0x6e7a2bef0920ba3c,
+    0x59473e188db0e722, 0xdcf457de12417478, 0xebc9422996d12966,
+    0xb28e7c311b61ce44, 0x85b369c69ff1935a, 0x8d3189ef7c157b9b,
+    0xba0c9c18f8852685, 0xe34ba2007535c1a7, 0xd476b7f7f1a59cb9,
+    0x51c5de316e540fe3, 0x66f8cbc6eac452fd, 0x3fbff5de6774b5df,
+    0x0882e029e3e4e8c1, 0x2eba358da0bd645d, 0x1987207a242d3943,
+    0x40c01e62a99dde61, 0x77fd0b952d0d837f, 0xf24e6253b2fc1025,
+    0xc57377a4366c4d3b, 0x9c3449bcbbdcaa19, 0xab095c4b3f4cf707,
+    0xa38bbc62dca81fc6, 0x94b6a995583842d8, 0xcdf1978dd588a5fa,
+    0xfacc827a5118f8e4, 0x7f7febbccee96bbe, 0x4842fe4b4a7936a0,
+    0x1105c053c7c9d182, 0x2638d5a443598c9c, 0x5d746b1b417ac8ba,
+    0x6a497eecc5ea95a4, 0x330e40f4485a7286, 0x04335503ccca2f98,
+    0x81803cc5533bbcc2, 0xb6bd2932d7abe1dc, 0xeffa172a5a1b06fe,
+    0xd8c702ddde8b5be0, 0xd045e2f43d6fb321, 0xe778f703b9ffee3f,
+    0xbe3fc91b344f091d, 0x8902dcecb0df5403, 0x0cb1b52a2f2ec759,
+    0x3b8ca0ddabbe9a47, 0x62cb9ec5260e7d65, 0x55f68b32a29e207b,
+    0x73ce5e96e1c7ace7, 0x44f34b616557f1f9, 0x1db47579e8e716db,
+    0x2a89608e6c774bc5, 0xaf3a0948f386d89f, 0x98071cbf77168581,
+    0xc14022a7faa662a3, 0xf67d37507e363fbd, 0xfeffd7799dd2d77c,
+    0xc9c2c28e19428a62, 0x9085fc9694f26d40, 0xa7b8e9611062305e,
+    0x220b80a78f93a304, 0x153695500b03fe1a, 0x4c71ab4886b31938,
+    0x7b4cbebf02234426, 0xbae8d63682f59174, 0x8dd5c3c10665cc6a,
+    0xd492fdd98bd52b48, 0xe3afe82e0f457656, 0x661c81e890b4e50c,
+    0x5121941f1424b812, 0x0866aa0799945f30, 0x3f5bbff01d04022e,
+    0x37d95fd9fee0eaef, 0x00e44a2e7a70b7f1, 0x59a37436f7c050d3,
+    0x6e9e61c173500dcd, 0xeb2d0807eca19e97, 0xdc101df06831c389,
+    0x855723e8e58124ab, 0xb26a361f611179b5, 0x9452e3bb2248f529,
+    0xa36ff64ca6d8a837, 0xfa28c8542b684f15, 0xcd15dda3aff8120b,
+    0x48a6b46530098151, 0x7f9ba192b499dc4f, 0x26dc9f8a39293b6d,
+    0x11e18a7dbdb96673, 0x19636a545e5d8eb2, 0x2e5e7fa3dacdd3ac,
+    0x771941bb577d348e, 0x4024544cd3ed6990, 0xc5973d8a4c1cfaca,
+    0xf2aa287dc88ca7d4, 0xabed1665453c40f6, 0x9cd00392c1ac1de8,
+    0xe79cbd2dc38f59ce, 0xd0a1a8da471f04d0, 0x89e696c2caafe3f2,
+    0xbedb83354e3fbeec, 0x3b68eaf3d1ce2db6, 0x0c55ff04555e70a8,
+    0x5512c11cd8ee978a, 0x622fd4eb5c7eca94, 0x6aad34c2bf9a2255,
+    0x5d9021353b0a7f4b, 0x04d71f2db6ba9869, 0x33ea0ada322ac577,
+    0xb659631caddb562d, 0x816476eb294b0b33, 0xd82348f3a4fbec11,
+    0xef1e5d04206bb10f, 0xc92688a063323d93, 0xfe1b9d57e7a2608d,
+    0xa75ca34f6a1287af, 0x9061b6b8ee82dab1, 0x15d2df7e717349eb,
+    0x22efca89f5e314f5, 0x7ba8f4917853f3d7, 0x4c95e166fcc3aec9,
+    0x4417014f1f274608, 0x732a14b89bb71b16, 0x2a6d2aa01607fc34,
+    0x1d503f579297a12a, 0x98e356910d663270, 0xafde436689f66f6e,
+    0xf6997d7e0446884c, 0xc1a4688980d6d552, 0x41088a3e5d7cb183,
+    0x76359fc9d9ecec9d, 0x2f72a1d1545c0bbf, 0x184fb426d0cc56a1,
+    0x9dfcdde04f3dc5fb, 0xaac1c817cbad98e5, 0xf386f60f461d7fc7,
+    0xc4bbe3f8c28d22d9, 0xcc3903d12169ca18, 0xfb041626a5f99706,
+    0xa243283e28497024, 0x957e3dc9acd92d3a, 0x10cd540f3328be60,
+    0x27f041f8b7b8e37e, 0x7eb77fe03a08045c, 0x498a6a17be985942,
+    0x6fb2bfb3fdc1d5de, 0x588faa44795188c0, 0x01c8945cf4e16fe2,
+    0x36f581ab707132fc, 0xb346e86def80a1a6, 0x847bfd9a6b10fcb8,
+    0xdd3cc382e6a01b9a, 0xea01d67562304684, 0xe283365c81d4ae45,
+    0xd5be23ab0544f35b, 0x8cf91db388f41479, 0xbbc408440c644967,
+    0x3e7761829395da3d, 0x094a747517058723, 0x500d4a6d9ab56001,
+    0x67305f9a1e253d1f, 0x1c7ce1251c067939, 0x2b41f4d298962427,
+    0x7206caca1526c305, 0x453bdf3d91b69e1b, 0xc088b6fb0e470d41,
+    0xf7b5a30c8ad7505f, 0xaef29d140767b77d, 0x99cf88e383f7ea63,
+    0x914d68ca601302a2, 0xa6707d3de4835fbc, 0xff3743256933b89e,
+    0xc80a56d2eda3e580, 0x4db93f14725276da, 0x7a842ae3f6c22bc4,
+    0x23c314fb7b72cce6, 0x14fe010cffe291f8, 0x32c6d4a8bcbb1d64,
+    0x05fbc15f382b407a, 0x5cbcff47b59ba758, 0x6b81eab0310bfa46,
+    0xee328376aefa691c, 0xd90f96812a6a3402, 0x8048a899a7dad320,
+    0xb775bd6e234a8e3e, 0xbff75d47c0ae66ff, 0x88ca48b0443e3be1,
+    0xd18d76a8c98edcc3, 0xe6b0635f4d1e81dd, 0x63030a99d2ef1287,
+    0x543e1f6e567f4f99, 0x0d792176dbcfa8bb, 0x3a4434815f5ff5a5,
+    0xfbe05c08df8920f7, 0xccdd49ff5b197de9, 0x959a77e7d6a99acb,
+    0xa2a762105239c7d5, 0x27140bd6cdc8548f, 0x10291e2149580991,
+    0x496e2039c4e8eeb3, 0x7e5335ce4078b3ad, 0x76d1d5e7a39c5b6c,
+    0x41ecc010270c0672, 0x18abfe08aabce150, 0x2f96ebff2e2cbc4e,
+    0xaa258239b1dd2f14, 0x9d1897ce354d720a, 0xc45fa9d6b8fd9528,
+    0xf362bc213c6dc836, 0xd55a69857f3444aa, 0xe2677c72fba419b4,
+    0xbb20426a7614fe96, 0x8c1d579df284a388, 0x09ae3e5b6d7530d2,
+    0x3e932bace9e56dcc, 0x67d415b464558aee, 0x50e90043e0c5d7f0,
+    0x586be06a03213f31, 0x6f56f59d87b1622f, 0x3611cb850a01850d,
+    0x012cde728e91d813, 0x849fb7b411604b49, 0xb3a2a24395f01657,
+    0xeae59c5b1840f175, 0xddd889ac9cd0ac6b, 0xa69437139ef3e84d,
+    0x91a922e41a63b553, 0xc8ee1cfc97d35271, 0xffd3090b13430f6f,
+    0x7a6060cd8cb29c35, 0x4d5d753a0822c12b, 0x141a4b2285922609,
+    0x23275ed501027b17, 0x2ba5befce2e693d6, 0x1c98ab0b6676cec8,
+    0x45df9513ebc629ea, 0x72e280e46f5674f4, 0xf751e922f0a7e7ae,
+    0xc06cfcd57437bab0, 0x992bc2cdf9875d92, 0xae16d73a7d17008c,
+    0x882e029e3e4e8c10, 0xbf131769baded10e, 0xe6542971376e362c,
+    0xd1693c86b3fe6b32, 0x54da55402c0ff868, 0x63e740b7a89fa576,
+    0x3aa07eaf252f4254, 0x0d9d6b58a1bf1f4a, 0x051f8b71425bf78b,
+    0x32229e86c6cbaa95, 0x6b65a09e4b7b4db7, 0x5c58b569cfeb10a9,
+    0xd9ebdcaf501a83f3, 0xeed6c958d48adeed, 0xb791f740593a39cf,
+    0x80ace2b7ddaa64d1},
+   {0x0000000000000000, 0xe9742a79ef04a5d4, 0xe63172a0869ed8c3,
+    0x0f4558d9699a7d17, 0xf8bbc31255aa22ed, 0x11cfe96bbaae8739,
+    0x1e8ab1b2d334fa2e, 0xf7fe9bcb3c305ffa, 0xc5aea077f3c3d6b1,
+    0x2cda8a0e1cc77365, 0x239fd2d7755d0e72, 0xcaebf8ae9a59aba6,
+    0x3d156365a669f45c, 0xd461491c496d5188, 0xdb2411c520f72c9f,
+    0x32503bbccff3894b, 0xbf8466bcbf103e09, 0x56f04cc550149bdd,
+    0x59b5141c398ee6ca, 0xb0c13e65d68a431e, 0x473fa5aeeaba1ce4,
+    0xae4b8fd705beb930, 0xa10ed70e6c24c427, 0x487afd77832061f3,
+    0x7a2ac6cb4cd3e8b8, 0x935eecb2a3d74d6c, 0x9c1bb46bca4d307b,
+    0x756f9e12254995af, 0x829105d91979ca55, 0x6be52fa0f67d6f81,
+    0x64a077799fe71296, 0x8dd45d0070e3b742, 0x4bd1eb2a26b7ef79,
+    0xa2a5c153c9b34aad, 0xade0998aa02937ba, 0x4494b3f34f2d926e,
+    0xb36a2838731dcd94, 0x5a1e02419c196840, 0x555b5a98f5831557,
+    0xbc2f70e11a87b083, 0x8e7f4b5dd57439c8, 0x670b61243a709c1c,
+    0x684e39fd53eae10b, 0x813a1384bcee44df, 0x76c4884f80de1b25,
+    0x9fb0a2366fdabef1, 0x90f5faef0640c3e6, 0x7981d096e9446632,
+    0xf4558d9699a7d170, 0x1d21a7ef76a374a4, 0x1264ff361f3909b3,
+    0xfb10d54ff03dac67, 0x0cee4e84cc0df39d, 0xe59a64fd23095649,
+    0xeadf3c244a932b5e, 0x03ab165da5978e8a, 0x31fb2de16a6407c1,
+    0xd88f07988560a215, 0xd7ca5f41ecfadf02, 0x3ebe753803fe7ad6,
+    0xc940eef33fce252c, 0x2034c48ad0ca80f8, 0x2f719c53b950fdef,
+    0xc605b62a5654583b, 0x97a3d6544d6fdef2, 0x7ed7fc2da26b7b26,
+    0x7192a4f4cbf10631, 0x98e68e8d24f5a3e5, 0x6f18154618c5fc1f,
+    0x866c3f3ff7c159cb, 0x892967e69e5b24dc, 0x605d4d9f715f8108,
+    0x520d7623beac0843, 0xbb795c5a51a8ad97, 0xb43c04833832d080,
+    0x5d482efad7367554, 0xaab6b531eb062aae, 0x43c29f4804028f7a,
+    0x4c87c7916d98f26d, 0xa5f3ede8829c57b9, 0x2827b0e8f27fe0fb,
+    0xc1539a911d7b452f, 0xce16c24874e13838, 0x2762e8319be59dec,
+    0xd09c73faa7d5c216, 0x39e8598348d167c2, 0x36ad015a214b1ad5,
+    0xdfd92b23ce4fbf01, 0xed89109f01bc364a, 0x04fd3ae6eeb8939e,
+    0x0bb8623f8722ee89, 0xe2cc484668264b5d, 0x1532d38d541614a7,
+    0xfc46f9f4bb12b173, 0xf303a12dd288cc64, 0x1a778b543d8c69b0,
+    0xdc723d7e6bd8318b, 0x3506170784dc945f, 0x3a434fdeed46e948,
+    0xd33765a702424c9c, 0x24c9fe6c3e721366, 0xcdbdd415d176b6b2,
+    0xc2f88cccb8eccba5, 0x2b8ca6b557e86e71, 0x19dc9d09981be73a,
+    0xf0a8b770771f42ee, 0xffedefa91e853ff9, 0x1699c5d0f1819a2d,
+    0xe1675e1bcdb1c5d7, 0x0813746222b56003, 0x07562cbb4b2f1d14,
+    0xee2206c2a42bb8c0, 0x63f65bc2d4c80f82, 0x8a8271bb3bccaa56,
+    0x85c729625256d741, 0x6cb3031bbd527295, 0x9b4d98d081622d6f,
+    0x7239b2a96e6688bb, 0x7d7cea7007fcf5ac, 0x9408c009e8f85078,
+    0xa658fbb5270bd933, 0x4f2cd1ccc80f7ce7, 0x40698915a19501f0,
+    0xa91da36c4e91a424, 0x5ee338a772a1fbde, 0xb79712de9da55e0a,
+    0xb8d24a07f43f231d, 0x51a6607e1b3b86c9, 0x1b9e8afbc2482e8f,
+    0xf2eaa0822d4c8b5b, 0xfdaff85b44d6f64c, 0x14dbd222abd25398,
+    0xe32549e997e20c62, 0x0a51639078e6a9b6, 0x05143b49117cd4a1,
+    0xec601130fe787175, 0xde302a8c318bf83e, 0x374400f5de8f5dea,
+    0x3801582cb71520fd, 0xd175725558118529, 0x268be99e6421dad3,
+    0xcfffc3e78b257f07, 0xc0ba9b3ee2bf0210, 0x29ceb1470dbba7c4,
+    0xa41aec477d581086, 0x4d6ec63e925cb552, 0x422b9ee7fbc6c845,
+    0xab5fb49e14c26d91, 0x5ca12f5528f2326b, 0xb5d5052cc7f697bf,
+    0xba905df5ae6ceaa8, 0x53e4778c41684f7c, 0x61b44c308e9bc637,
+    0x88c06649619f63e3, 0x87853e9008051ef4, 0x6ef114e9e701bb20,
+    0x990f8f22db31e4da, 0x707ba55b3435410e, 0x7f3efd825daf3c19,
+    0x964ad7fbb2ab99cd, 0x504f61d1e4ffc1f6, 0xb93b4ba80bfb6422,
+    0xb67e137162611935, 0x5f0a39088d65bce1, 0xa8f4a2c3b155e31b,
+    0x418088ba5e5146cf, 0x4ec5d06337cb3bd8, 0xa7b1fa1ad8cf9e0c,
+    0x95e1c1a6173c1747, 0x7c95ebdff838b293, 0x73d0b30691a2cf84,
+    0x9aa4997f7ea66a50, 0x6d5a02b4429635aa, 0x842e28cdad92907e,
+    0x8b6b7014c408ed69, 0x621f5a6d2b0c48bd, 0xefcb076d5befffff,
+    0x06bf2d14b4eb5a2b, 0x09fa75cddd71273c, 0xe08e5fb4327582e8,
+    0x1770c47f0e45dd12, 0xfe04ee06e14178c6, 0xf141b6df88db05d1,
+    0x18359ca667dfa005, 0x2a65a71aa82c294e, 0xc3118d6347288c9a,
+    0xcc54d5ba2eb2f18d, 0x2520ffc3c1b65459, 0xd2de6408fd860ba3,
+    0x3baa4e711282ae77, 0x34ef16a87b18d360, 0xdd9b3cd1941c76b4,
+    0x8c3d5caf8f27f07d, 0x654976d6602355a9, 0x6a0c2e0f09b928be,
+    0x83780476e6bd8d6a, 0x74869fbdda8dd290, 0x9df2b5c435897744,
+    0x92b7ed1d5c130a53, 0x7bc3c764b317af87, 0x4993fcd87ce426cc,
+    0xa0e7d6a193e08318, 0xafa28e78fa7afe0f, 0x46d6a401157e5bdb,
+    0xb1283fca294e0421, 0x585c15b3c64aa1f5, 0x57194d6aafd0dce2,
+    0xbe6d671340d47936, 0x33b93a133037ce74, 0xdacd106adf336ba0,
+    0xd58848b3b6a916b7, 0x3cfc62ca59adb363, 0xcb02f901659dec99,
+    0x2276d3788a99494d, 0x2d338ba1e303345a, 0xc447a1d80c07918e,
+    0xf6179a64c3f418c5, 0x1f63b01d2cf0bd11, 0x1026e8c4456ac006,
+    0xf952c2bdaa6e65d2, 0x0eac5976965e3a28, 0xe7d8730f795a9ffc,
+    0xe89d2bd610c0e2eb, 0x01e901afffc4473f, 0xc7ecb785a9901f04,
+    0x2e989dfc4694bad0, 0x21ddc5252f0ec7c7, 0xc8a9ef5cc00a6213,
+    0x3f577497fc3a3de9, 0xd6235eee133e983d, 0xd96606377aa4e52a,
+    0x30122c4e95a040fe, 0x024217f25a53c9b5, 0xeb363d8bb5576c61,
+    0xe4736552dccd1176, 0x0d074f2b33c9b4a2, 0xfaf9d4e00ff9eb58,
+    0x138dfe99e0fd4e8c, 0x1cc8a6408967339b, 0xf5bc8c396663964f,
+    0x7868d1391680210d, 0x911cfb40f98484d9, 0x9e59a399901ef9ce,
+    0x772d89e07f1a5c1a, 0x80d3122b432a03e0, 0x69a73852ac2ea634,
+    0x66e2608bc5b4db23, 0x8f964af22ab07ef7, 0xbdc6714ee543f7bc,
+    0x54b25b370a475268, 0x5bf703ee63dd2f7f, 0xb28329978cd98aab,
+    0x457db25cb0e9d551, 0xac0998255fed7085, 0xa34cc0fc36770d92,
+    0x4a38ea85d973a846},
+   {0x0000000000000000, 0xfc5d27f6bf353971, 0xcc6369be26fde189,
+    0x303e4e4899c8d8f8, 0xac1ff52f156c5079, 0x5042d2d9aa596908,
+    0x607c9c913391b1f0, 0x9c21bb678ca48881, 0x6ce6cc0d724f3399,
+    0x90bbebfbcd7a0ae8, 0xa085a5b354b2d210, 0x5cd88245eb87eb61,
+    0xc0f93922672363e0, 0x3ca41ed4d8165a91, 0x0c9a509c41de8269,
+    0xf0c7776afeebbb18, 0xd9cd981ae49e6732, 0x2590bfec5bab5e43,
+    0x15aef1a4c26386bb, 0xe9f3d6527d56bfca, 0x75d26d35f1f2374b,
+    0x898f4ac34ec70e3a, 0xb9b1048bd70fd6c2, 0x45ec237d683aefb3,
+    0xb52b541796d154ab, 0x497673e129e46dda, 0x79483da9b02cb522,
+    0x85151a5f0f198c53, 0x1934a13883bd04d2, 0xe56986ce3c883da3,
+    0xd557c886a540e55b, 0x290aef701a75dc2a, 0x8742166691ab5d0f,
+    0x7b1f31902e9e647e, 0x4b217fd8b756bc86, 0xb77c582e086385f7,
+    0x2b5de34984c70d76, 0xd700c4bf3bf23407, 0xe73e8af7a23aecff,
+    0x1b63ad011d0fd58e, 0xeba4da6be3e46e96, 0x17f9fd9d5cd157e7,
+    0x27c7b3d5c5198f1f, 0xdb9a94237a2cb66e, 0x47bb2f44f6883eef,
+    0xbbe608b249bd079e, 0x8bd846fad075df66, 0x7785610c6f40e617,
+    0x5e8f8e7c75353a3d, 0xa2d2a98aca00034c, 0x92ece7c253c8dbb4,
+    0x6eb1c034ecfde2c5, 0xf2907b5360596a44, 0x0ecd5ca5df6c5335,
+    0x3ef312ed46a48bcd, 0xc2ae351bf991b2bc, 0x32694271077a09a4,
+    0xce346587b84f30d5, 0xfe0a2bcf2187e82d, 0x02570c399eb2d15c,
+    0x9e76b75e121659dd, 0x622b90a8ad2360ac, 0x5215dee034ebb854,
+    0xae48f9168bde8125, 0x3a5d0a9e7bc12975, 0xc6002d68c4f41004,
+    0xf63e63205d3cc8fc, 0x0a6344d6e209f18d, 0x9642ffb16ead790c,
+    0x6a1fd847d198407d, 0x5a21960f48509885, 0xa67cb1f9f765a1f4,
+    0x56bbc693098e1aec, 0xaae6e165b6bb239d, 0x9ad8af2d2f73fb65,
+    0x668588db9046c214, 0xfaa433bc1ce24a95, 0x06f9144aa3d773e4,
+    0x36c75a023a1fab1c, 0xca9a7df4852a926d, 0xe39092849f5f4e47,
+    0x1fcdb572206a7736, 0x2ff3fb3ab9a2afce, 0xd3aedccc069796bf,
+    0x4f8f67ab8a331e3e, 0xb3d2405d3506274f, 0x83ec0e15acceffb7,
+    0x7fb129e313fbc6c6, 0x8f765e89ed107dde, 0x732b797f522544af,
+    0x43153737cbed9c57, 0xbf4810c174d8a526, 0x2369aba6f87c2da7,
+    0xdf348c50474914d6, 0xef0ac218de81cc2e, 0x1357e5ee61b4f55f,
+    0xbd1f1cf8ea6a747a, 0x41423b0e555f4d0b, 0x717c7546cc9795f3,
+    0x8d2152b073a2ac82, 0x1100e9d7ff062403, 0xed5dce2140331d72,
+    0xdd638069d9fbc58a, 0x213ea79f66cefcfb, 0xd1f9d0f5982547e3,
+    0x2da4f70327107e92, 0x1d9ab94bbed8a66a, 0xe1c79ebd01ed9f1b,
+    0x7de625da8d49179a, 0x81bb022c327c2eeb, 0xb1854c64abb4f613,
+    0x4dd86b921481cf62, 0x64d284e20ef41348, 0x988fa314b1c12a39,
+    0xa8b1ed5c2809f2c1, 0x54eccaaa973ccbb0, 0xc8cd71cd1b984331,
+    0x3490563ba4ad7a40, 0x04ae18733d65a2b8, 0xf8f33f8582509bc9,
+    0x083448ef7cbb20d1, 0xf4696f19c38e19a0, 0xc45721515a46c158,
+    0x380a06a7e573f829, 0xa42bbdc069d770a8, 0x58769a36d6e249d9,
+    0x6848d47e4f2a9121, 0x9415f388f01fa850, 0x74ba153cf78252ea,
+    0x88e732ca48b76b9b, 0xb8d97c82d17fb363, 0x44845b746e4a8a12,
+    0xd8a5e013e2ee0293, 0x24f8c7e55ddb3be2, 0x14c689adc413e31a,
+    0xe89bae5b7b26da6b, 0x185cd93185cd6173, 0xe401fec73af85802,
+    0xd43fb08fa33080fa, 0x286297791c05b98b, 0xb4432c1e90a1310a,
+    0x481e0be82f94087b, 0x782045a0b65cd083, 0x847d62560969e9f2,
+    0xad778d26131c35d8, 0x512aaad0ac290ca9, 0x6114e49835e1d451,
+    0x9d49c36e8ad4ed20, 0x01687809067065a1, 0xfd355fffb9455cd0,
+    0xcd0b11b7208d8428, 0x315636419fb8bd59, 0xc191412b61530641,
+    0x3dcc66ddde663f30, 0x0df2289547aee7c8, 0xf1af0f63f89bdeb9,
+    0x6d8eb404743f5638, 0x91d393f2cb0a6f49, 0xa1edddba52c2b7b1,
+    0x5db0fa4cedf78ec0, 0xf3f8035a66290fe5, 0x0fa524acd91c3694,
+    0x3f9b6ae440d4ee6c, 0xc3c64d12ffe1d71d, 0x5fe7f67573455f9c,
+    0xa3bad183cc7066ed, 0x93849fcb55b8be15, 0x6fd9b83dea8d8764,
+    0x9f1ecf5714663c7c, 0x6343e8a1ab53050d, 0x537da6e9329bddf5,
+    0xaf20811f8daee484, 0x33013a78010a6c05, 0xcf5c1d8ebe3f5574,
+    0xff6253c627f78d8c, 0x033f743098c2b4fd, 0x2a359b4082b768d7,
+    0xd668bcb63d8251a6, 0xe656f2fea44a895e, 0x1a0bd5081b7fb02f,
+    0x862a6e6f97db38ae, 0x7a77499928ee01df, 0x4a4907d1b126d927,
+    0xb61420270e13e056, 0x46d3574df0f85b4e, 0xba8e70bb4fcd623f,
+    0x8ab03ef3d605bac7, 0x76ed1905693083b6, 0xeacca262e5940b37,
+    0x169185945aa13246, 0x26afcbdcc369eabe, 0xdaf2ec2a7c5cd3cf,
+    0x4ee71fa28c437b9f, 0xb2ba3854337642ee, 0x8284761caabe9a16,
+    0x7ed951ea158ba367, 0xe2f8ea8d992f2be6, 0x1ea5cd7b261a1297,
+    0x2e9b8333bfd2ca6f, 0xd2c6a4c500e7f31e, 0x2201d3affe0c4806,
+    0xde5cf45941397177, 0xee62ba11d8f1a98f, 0x123f9de767c490fe,
+    0x8e1e2680eb60187f, 0x724301765455210e, 0x427d4f3ecd9df9f6,
+    0xbe2068c872a8c087, 0x972a87b868dd1cad, 0x6b77a04ed7e825dc,
+    0x5b49ee064e20fd24, 0xa714c9f0f115c455, 0x3b3572977db14cd4,
+    0xc7685561c28475a5, 0xf7561b295b4cad5d, 0x0b0b3cdfe479942c,
+    0xfbcc4bb51a922f34, 0x07916c43a5a71645, 0x37af220b3c6fcebd,
+    0xcbf205fd835af7cc, 0x57d3be9a0ffe7f4d, 0xab8e996cb0cb463c,
+    0x9bb0d72429039ec4, 0x67edf0d29636a7b5, 0xc9a509c41de82690,
+    0x35f82e32a2dd1fe1, 0x05c6607a3b15c719, 0xf99b478c8420fe68,
+    0x65bafceb088476e9, 0x99e7db1db7b14f98, 0xa9d995552e799760,
+    0x5584b2a3914cae11, 0xa543c5c96fa71509, 0x591ee23fd0922c78,
+    0x6920ac77495af480, 0x957d8b81f66fcdf1, 0x095c30e67acb4570,
+    0xf5011710c5fe7c01, 0xc53f59585c36a4f9, 0x39627eaee3039d88,
+    0x106891def97641a2, 0xec35b628464378d3, 0xdc0bf860df8ba02b,
+    0x2056df9660be995a, 0xbc7764f1ec1a11db, 0x402a4307532f28aa,
+    0x70140d4fcae7f052, 0x8c492ab975d2c923, 0x7c8e5dd38b39723b,
+    0x80d37a25340c4b4a, 0xb0ed346dadc493b2, 0x4cb0139b12f1aac3,
+    0xd091a8fc9e552242, 0x2ccc8f0a21601b33, 0x1cf2c142b8a8c3cb,
+    0xe0afe6b4079dfaba},
+   {0x0000000000000000, 0x21e9761e252621ac, 0x43d2ec3c4a4c4358,
+    0x623b9a226f6a62f4, 0x87a5d878949886b0, 0xa64cae66b1bea71c,
+    0xc4773444ded4c5e8, 0xe59e425afbf2e444, 0x3b9296a271a69e0b,
+    0x1a7be0bc5480bfa7, 0x78407a9e3beadd53, 0x59a90c801eccfcff,
+    0xbc374edae53e18bb, 0x9dde38c4c0183917, 0xffe5a2e6af725be3,
+    0xde0cd4f88a547a4f, 0x77252d44e34d3c16, 0x56cc5b5ac66b1dba,
+    0x34f7c178a9017f4e, 0x151eb7668c275ee2, 0xf080f53c77d5baa6,
+    0xd169832252f39b0a, 0xb35219003d99f9fe, 0x92bb6f1e18bfd852,
+    0x4cb7bbe692eba21d, 0x6d5ecdf8b7cd83b1, 0x0f6557dad8a7e145,
+    0x2e8c21c4fd81c0e9, 0xcb12639e067324ad, 0xeafb158023550501,
+    0x88c08fa24c3f67f5, 0xa929f9bc69194659, 0xee4a5a89c69a782c,
+    0xcfa32c97e3bc5980, 0xad98b6b58cd63b74, 0x8c71c0aba9f01ad8,
+    0x69ef82f15202fe9c, 0x4806f4ef7724df30, 0x2a3d6ecd184ebdc4,
+    0x0bd418d33d689c68, 0xd5d8cc2bb73ce627, 0xf431ba35921ac78b,
+    0x960a2017fd70a57f, 0xb7e35609d85684d3, 0x527d145323a46097,
+    0x7394624d0682413b, 0x11aff86f69e823cf, 0x30468e714cce0263,
+    0x996f77cd25d7443a, 0xb88601d300f16596, 0xdabd9bf16f9b0762,
+    0xfb54edef4abd26ce, 0x1ecaafb5b14fc28a, 0x3f23d9ab9469e326,
+    0x5d184389fb0381d2, 0x7cf13597de25a07e, 0xa2fde16f5471da31,
+    0x831497717157fb9d, 0xe12f0d531e3d9969, 0xc0c67b4d3b1bb8c5,
+    0x25583917c0e95c81, 0x04b14f09e5cf7d2d, 0x668ad52b8aa51fd9,
+    0x4763a335af833e75, 0xe84d9340d5a36333, 0xc9a4e55ef085429f,
+    0xab9f7f7c9fef206b, 0x8a760962bac901c7, 0x6fe84b38413be583,
+    0x4e013d26641dc42f, 0x2c3aa7040b77a6db, 0x0dd3d11a2e518777,
+    0xd3df05e2a405fd38, 0xf23673fc8123dc94, 0x900de9deee49be60,
+    0xb1e49fc0cb6f9fcc, 0x547add9a309d7b88, 0x7593ab8415bb5a24,
+    0x17a831a67ad138d0, 0x364147b85ff7197c, 0x9f68be0436ee5f25,
+    0xbe81c81a13c87e89, 0xdcba52387ca21c7d, 0xfd53242659843dd1,
+    0x18cd667ca276d995, 0x392410628750f839, 0x5b1f8a40e83a9acd,
+    0x7af6fc5ecd1cbb61, 0xa4fa28a64748c12e, 0x85135eb8626ee082,
+    0xe728c49a0d048276, 0xc6c1b2842822a3da, 0x235ff0ded3d0479e,
+    0x02b686c0f6f66632, 0x608d1ce2999c04c6, 0x41646afcbcba256a,
+    0x0607c9c913391b1f, 0x27eebfd7361f3ab3, 0x45d525f559755847,
+    0x643c53eb7c5379eb, 0x81a211b187a19daf, 0xa04b67afa287bc03,
+    0xc270fd8dcdeddef7, 0xe3998b93e8cbff5b, 0x3d955f6b629f8514,
+    0x1c7c297547b9a4b8, 0x7e47b35728d3c64c, 0x5faec5490df5e7e0,
+    0xba308713f60703a4, 0x9bd9f10dd3212208, 0xf9e26b2fbc4b40fc,
+    0xd80b1d31996d6150, 0x7122e48df0742709, 0x50cb9293d55206a5,
+    0x32f008b1ba386451, 0x13197eaf9f1e45fd, 0xf6873cf564eca1b9,
+    0xd76e4aeb41ca8015, 0xb555d0c92ea0e2e1, 0x94bca6d70b86c34d,
+    0x4ab0722f81d2b902, 0x6b590431a4f498ae, 0x09629e13cb9efa5a,
+    0x288be80deeb8dbf6, 0xcd15aa57154a3fb2, 0xecfcdc49306c1e1e,
+    0x8ec7466b5f067cea, 0xaf2e30757a205d46, 0xe44200d2f3d1550d,
+    0xc5ab76ccd6f774a1, 0xa790eceeb99d1655, 0x86799af09cbb37f9,
+    0x63e7d8aa6749d3bd, 0x420eaeb4426ff211, 0x203534962d0590e5,
+    0x01dc42880823b149, 0xdfd096708277cb06, 0xfe39e06ea751eaaa,
+    0x9c027a4cc83b885e, 0xbdeb0c52ed1da9f2, 0x58754e0816ef4db6,
+    0x799c381633c96c1a, 0x1ba7a2345ca30eee, 0x3a4ed42a79852f42,
+    0x93672d96109c691b, 0xb28e5b8835ba48b7, 0xd0b5c1aa5ad02a43,
+    0xf15cb7b47ff60bef, 0x14c2f5ee8404efab, 0x352b83f0a122ce07,
+    0x571019d2ce48acf3, 0x76f96fcceb6e8d5f, 0xa8f5bb34613af710,
+    0x891ccd2a441cd6bc, 0xeb2757082b76b448, 0xcace21160e5095e4,
+    0x2f50634cf5a271a0, 0x0eb91552d084500c, 0x6c828f70bfee32f8,
+    0x4d6bf96e9ac81354, 0x0a085a5b354b2d21, 0x2be12c45106d0c8d,
+    0x49dab6677f076e79, 0x6833c0795a214fd5, 0x8dad8223a1d3ab91,
+    0xac44f43d84f58a3d, 0xce7f6e1feb9fe8c9, 0xef961801ceb9c965,
+    0x319accf944edb32a, 0x1073bae761cb9286, 0x724820c50ea1f072,
+    0x53a156db2b87d1de, 0xb63f1481d075359a, 0x97d6629ff5531436,
+    0xf5edf8bd9a3976c2, 0xd4048ea3bf1f576e, 0x7d2d771fd6061137,
+    0x5cc40101f320309b, 0x3eff9b239c4a526f, 0x1f16ed3db96c73c3,
+    0xfa88af67429e9787, 0xdb61d97967b8b62b, 0xb95a435b08d2d4df,
+    0x98b335452df4f573, 0x46bfe1bda7a08f3c, 0x675697a38286ae90,
+    0x056d0d81edeccc64, 0x24847b9fc8caedc8, 0xc11a39c53338098c,
+    0xe0f34fdb161e2820, 0x82c8d5f979744ad4, 0xa321a3e75c526b78,
+    0x0c0f93922672363e, 0x2de6e58c03541792, 0x4fdd7fae6c3e7566,
+    0x6e3409b0491854ca, 0x8baa4beab2eab08e, 0xaa433df497cc9122,
+    0xc878a7d6f8a6f3d6, 0xe991d1c8dd80d27a, 0x379d053057d4a835,
+    0x1674732e72f28999, 0x744fe90c1d98eb6d, 0x55a69f1238becac1,
+    0xb038dd48c34c2e85, 0x91d1ab56e66a0f29, 0xf3ea317489006ddd,
+    0xd203476aac264c71, 0x7b2abed6c53f0a28, 0x5ac3c8c8e0192b84,
+    0x38f852ea8f734970, 0x191124f4aa5568dc, 0xfc8f66ae51a78c98,
+    0xdd6610b07481ad34, 0xbf5d8a921bebcfc0, 0x9eb4fc8c3ecdee6c,
+    0x40b82874b4999423, 0x61515e6a91bfb58f, 0x036ac448fed5d77b,
+    0x2283b256dbf3f6d7, 0xc71df00c20011293, 0xe6f486120527333f,
+    0x84cf1c306a4d51cb, 0xa5266a2e4f6b7067, 0xe245c91be0e84e12,
+    0xc3acbf05c5ce6fbe, 0xa1972527aaa40d4a, 0x807e53398f822ce6,
+    0x65e011637470c8a2, 0x4409677d5156e90e, 0x2632fd5f3e3c8bfa,
+    0x07db8b411b1aaa56, 0xd9d75fb9914ed019, 0xf83e29a7b468f1b5,
+    0x9a05b385db029341, 0xbbecc59bfe24b2ed, 0x5e7287c105d656a9,
+    0x7f9bf1df20f07705, 0x1da06bfd4f9a15f1, 0x3c491de36abc345d,
+    0x9560e45f03a57204, 0xb4899241268353a8, 0xd6b2086349e9315c,
+    0xf75b7e7d6ccf10f0, 0x12c53c27973df4b4, 0x332c4a39b21bd518,
+    0x5117d01bdd71b7ec, 0x70fea605f8579640, 0xaef272fd7203ec0f,
+    0x8f1b04e35725cda3, 0xed209ec1384faf57, 0xccc9e8df1d698efb,
+    0x2957aa85e69b6abf, 0x08bedc9bc3bd4b13, 0x6a8546b9acd729e7,
+    0x4b6c30a789f1084b}};
+
+static const uint64_t crc64_nvme_x2n_table[] = {
+    0x4000000000000000, 0x2000000000000000, 0x0800000000000000,
+    0x0080000000000000, 0x0000800000000000, 0x0000000080000000,
+    0x9a6c9329ac4bc9b5, 0x10f4bb0f129310d6, 0x70f05dcea2ebd226,
+    0x311211205672822d, 0x2fc297db0f46c96e, 0xca4d536fabf7da84,
+    0xfb4cdc3b379ee6ed, 0xea261148df25140a, 0x59ccb2c07aa6c9b4,
+    0x20b3674a839af27a, 0x2d8e1986da94d583, 0x42cdf4c20337635d,
+    0x1d78724bf0f26839, 0xb96c84e0afb34bd5, 0x5d2e1fcd2df0a3ea,
+    0xcd9506572332be42, 0x23bda2427f7d690f, 0x347a953232374f07,
+    0x1c2a807ac2a8ceea, 0x9b92ad0e14fe1460, 0x2574114889f670b2,
+    0x4a84a6c45e3bf520, 0x915bbac21cd1c7ff, 0xb0290ec579f291f5,
+    0xcf2548505c624e6e, 0xb154f27bf08a8207, 0xce4e92344baf7d35,
+    0x51da8d7e057c5eb3, 0x9fb10823f5be15df, 0x73b825b3ff1f71cf,
+    0x5db436c5406ebb74, 0xfa7ed8f3ec3f2bca, 0xc4d58efdc61b9ef6,
+    0xa7e39e61e855bd45, 0x97ad46f9dd1bf2f1, 0x1a0abb01f853ee6b,
+    0x3f0827c3348f8215, 0x4eb68c4506134607, 0x4a46f6de5df34e0a,
+    0x2d855d6a1c57a8dd, 0x8688da58e1115812, 0x5232f417fc7c7300,
+    0xa4080fb2e767d8da, 0xd515a7e17693e562, 0x1181f7c862e94226,
+    0x9e23cd058204ca91, 0x9b8992c57a0aed82, 0xb2c0afb84609b6ff,
+    0x2f7160553a5ea018, 0x3cd378b5c99f2722, 0x814054ad61a3b058,
+    0xbf766189fce806d8, 0x85a5e898ac49f86f, 0x34830d11bc84f346,
+    0x9644d95b173c8c1c, 0x150401ac9ac759b1, 0xebe1f7f46fb00eba,
+    0x8ee4ce0c2e2bd662, 0x4000000000000000, 0x2000000000000000};
+
+#endif /* CRC64_TBL_H_ */
@@ -119,6 +119,7 @@ Z_INTERNAL block_state deflate_slow  (deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_rle   (deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_huff  (deflate_state *s, int flush);
 static void lm_set_level         (deflate_state *s, int level);
+static void lm_set_hash_funcs    (deflate_state *s);
 static void lm_init              (deflate_state *s);
 Z_INTERNAL unsigned read_buf  (PREFIX3(stream) *strm, unsigned char *buf, unsigned size);
 
@@ -180,9 +181,49 @@ static const config configuration_table[10] = {
  * Initialize the hash table. prev[] will be initialized on the fly.
  */
 #define CLEAR_HASH(s) do { \
-    memset((unsigned char *)s->head, 0, HASH_SIZE * sizeof(*s->head)); \
+    if (s->head != NULL) \
+        memset((unsigned char *)s->head, 0, HASH_SIZE * sizeof(*s->head)); \
   } while (0)
 
+/* ===========================================================================
+ * Hash tables used by the compression function of a level and strategy.
+ * Streams are allocated without the tables they do not need, and grow them in
+ * deflateParams() when switching to a level or strategy that needs more.
+ */
+#define HASH_TABLES_NONE 0  /* deflate_stored, deflate_huff and deflate_rle */
+#define HASH_TABLES_HEAD 1  /* deflate_quick only looks up the most recent match in head[] */
+#define HASH_TABLES_ALL  2  /* head[] and prev[] for walking the hash chains */
+
+static int deflate_hash_tables(int level, int strategy) {
+#ifdef S390_DFLTCC_DEFLATE
+    /* DFLTCC falls back to the software compression functions */
+    Z_UNUSED(level);
+    Z_UNUSED(strategy);
+    return HASH_TABLES_ALL;
+#else
+    if (level == 0 || strategy == Z_HUFFMAN_ONLY || strategy == Z_RLE)
+        return HASH_TABLES_NONE;
+#  ifndef NO_QUICK_STRATEGY
+    if (configuration_table[level].func == deflate_quick)
+        return HASH_TABLES_HEAD;
+#  endif
+    return HASH_TABLES_ALL;
+#endif
+}
+
+/* Hash tables the stream currently has allocated */
+static int deflate_allocated_tables(deflate_state *s) {
+    return s->prev != NULL ? HASH_TABLES_ALL : (s->head != NULL ? HASH_TABLES_HEAD : HASH_TABLES_NONE);
+}
+
+/* Slide whichever hash tables the stream has */
+static void deflate_slide_hash(deflate_state *s) {
+    if (s->prev != NULL)
+        FUNCTABLE_CALL(slide_hash)(s);
+    else if (s->head != NULL)
+        slide_hash_c(s);
+}
+
 
 #ifdef DEF_ALLOC_DEBUG
 #  include <stdio.h>
@@ -199,14 +240,15 @@ static const config configuration_table[10] = {
  * Allocate a big buffer and divide it up into the various buffers deflate needs.
  * Handles alignment of allocated buffer and alignment of individual buffers.
  */
-Z_INTERNAL deflate_allocs* alloc_deflate(PREFIX3(stream) *strm, int windowBits, int lit_bufsize) {
+Z_INTERNAL deflate_allocs* alloc_deflate(PREFIX3(stream) *strm, int windowBits, int lit_bufsize, int lit_mem,
+                                         int tables) {
     int curr_size = 0;
 
     /* Define sizes */
-    int window_size = DEFLATE_ADJUST_WINDOW_SIZE((1 << windowBits) * 2);
-    int prev_size = (1 << windowBits) * (int)sizeof(Pos);
-    int head_size = HASH_SIZE * sizeof(Pos);
-    int pending_size = lit_bufsize * LIT_BUFS;
+    int window_size = DEFLATE_ADJUST_WINDOW_SIZE((1 << windowBits) * WINDOW_FACTOR);
+    int prev_size = tables == HASH_TABLES_ALL ? (1 << windowBits) * (int)sizeof(Pos) : 0;
+    int head_size = tables != HASH_TABLES_NONE ? HASH_SIZE * (int)sizeof(Pos) : 0;
+    int pending_size = lit_bufsize * LIT_BUFS(lit_mem);
     int state_size = sizeof(deflate_state);
     int alloc_size = sizeof(deflate_allocs);
 
@@ -235,15 +277,15 @@ Z_INTERNAL deflate_allocs* alloc_deflate(PREFIX3(stream) *strm, int windowBits,
     int alloc_pos = PAD_16(curr_size);
     curr_size = alloc_pos + alloc_size;
 
-    /* Add 64-1 or 4096-1 to allow window alignment, and round size of buffer up to multiple of 64 */
-    int total_size = PAD_64(curr_size + (WINDOW_PAD_SIZE - 1));
+    /* Round size of buffer up to multiple of 64 */
+    int total_size = PAD_64(curr_size);
 
-    /* Allocate buffer, align to 64-byte cacheline, and zerofill the resulting buffer */
-    char *original_buf = (char *)strm->zalloc(strm->opaque, 1, total_size);
-    if (original_buf == NULL)
+    /* Allocate buffer aligned to 64 bytes or 4096 bytes for the window */
+    char *original_buf;
+    char *buff = (char *)PREFIX(zalloc_aligned)(strm, total_size, WINDOW_PAD_SIZE, &original_buf);
+    if (buff == NULL)
         return NULL;
-
-    char *buff = (char *)HINT_ALIGNED_WINDOW((char *)PAD_WINDOW(original_buf));
+    buff = (char *)HINT_ALIGNED_WINDOW(buff);
     LOGSZPL("Buffer alloc", total_size, PADSZ((uintptr_t)original_buf,WINDOW_PAD_SIZE), PADSZ(curr_size,WINDOW_PAD_SIZE));
 
     /* Initialize alloc_bufs */
@@ -253,16 +295,59 @@ Z_INTERNAL deflate_allocs* alloc_deflate(PREFIX3(stream) *strm, int windowBits,
 
     /* Assign buffers */
     alloc_bufs->window = (unsigned char *)HINT_ALIGNED_WINDOW(buff + window_pos);
-    alloc_bufs->prev = (Pos *)HINT_ALIGNED_64(buff + prev_pos);
-    alloc_bufs->head = (Pos *)HINT_ALIGNED_64(buff + head_pos);
+    alloc_bufs->prev = prev_size ? (Pos *)HINT_ALIGNED_64(buff + prev_pos) : NULL;
+    alloc_bufs->head = head_size ? (Pos *)HINT_ALIGNED_64(buff + head_pos) : NULL;
     alloc_bufs->pending_buf = (unsigned char *)HINT_ALIGNED_64(buff + pending_pos);
     alloc_bufs->state = (deflate_state *)HINT_ALIGNED_16(buff + state_pos);
 
-    memset((char *)alloc_bufs->prev, 0, prev_size);
+    if (prev_size)
+        memset((char *)alloc_bufs->prev, 0, prev_size);
 
     return alloc_bufs;
 }
 
+/* ===========================================================================
+ * Lay out the symbol buffers in pending_buf for the lit_mem and lit_bufsize of
+ * the stream. See the analysis in deflateInit2() for why they can share it.
+ */
+static void deflate_set_sym_bufs(deflate_state *s) {
+    /* We avoid equality with lit_bufsize*3 because of wraparound at 64K
+     * on 16 bit machines and because stored blocks are restricted to
+     * 64K-1 bytes.
+     */
+    if (s->lit_mem) {
+        s->d_buf = (uint16_t *)(s->pending_buf + (s->lit_bufsize << 1));
+        s->l_buf = s->pending_buf + (s->lit_bufsize << 2);
+        s->sym_buf = NULL;
+        s->sym_end = s->lit_bufsize - 1;
+        s->tr_tally_lit = &zng_tr_tally_lit_split;
+        s->tr_tally_dist = &zng_tr_tally_dist_split;
+    } else {
+        s->d_buf = NULL;
+        s->l_buf = NULL;
+        s->sym_buf = s->pending_buf + s->lit_bufsize;
+        s->sym_end = (s->lit_bufsize - 1) * 3;
+        s->tr_tally_lit = &zng_tr_tally_lit_sym;
+        s->tr_tally_dist = &zng_tr_tally_dist_sym;
+    }
+}
+
+/* ===========================================================================
+ * Point a deflate state that was copied into a new allocation at the buffers
+ * of that allocation. lit_mem and lit_bufsize must already be set.
+ */
+static void deflate_move_state(deflate_state *s, deflate_allocs *alloc_bufs) {
+    s->alloc_bufs = alloc_bufs;
+    s->window = alloc_bufs->window;
+    s->prev = alloc_bufs->prev;
+    s->head = alloc_bufs->head;
+    s->pending_buf = s->pending_out = alloc_bufs->pending_buf;
+    deflate_set_sym_bufs(s);
+    s->l_desc.dyn_tree = s->dyn_ltree;
+    s->d_desc.dyn_tree = s->dyn_dtree;
+    s->bl_desc.dyn_tree = s->bl_tree;
+}
+
 /* ===========================================================================
  * Free all allocated deflate buffers
  */
@@ -276,6 +361,39 @@ static inline void free_deflate(PREFIX3(stream) *strm) {
     }
 }
 
+/* ===========================================================================
+ * Move a stream to a new allocation that also has the hash tables that level
+ * and strategy need. The window and pending output are carried over. Strings
+ * already in the window are inserted into fresh tables by the next
+ * fill_window().
+ */
+static int32_t deflate_grow_tables(PREFIX3(stream) *strm, int tables) {
+    deflate_state *s = (deflate_state *)strm->state, *ns;
+    deflate_allocs *alloc_bufs = alloc_deflate(strm, s->w_bits, s->lit_bufsize, s->lit_mem, tables);
+    if (alloc_bufs == NULL)
+        return Z_MEM_ERROR;
+
+    ns = alloc_bufs->state;
+    memcpy(ns, s, sizeof(deflate_state));
+    deflate_move_state(ns, alloc_bufs);
+    memcpy(ns->window, s->window, DEFLATE_ADJUST_WINDOW_SIZE(s->w_size * WINDOW_FACTOR));
+    memcpy(ns->pending_buf, s->pending_buf, s->lit_bufsize * LIT_BUFS(s->lit_mem));
+    ns->pending_out = ns->pending_buf + (s->pending_out - s->pending_buf);
+
+    if (s->head != NULL) {
+        memcpy((void *)ns->head, (void *)s->head, HASH_SIZE * sizeof(Pos));
+    } else {
+        CLEAR_HASH(ns);
+        ns->matches = 0;
+        ns->insert = MIN(ns->strstart, ns->w_size);
+    }
+    lm_set_hash_funcs(ns);
+
+    free_deflate(strm);
+    strm->state = (struct internal_state *)ns;
+    return Z_OK;
+}
+
 /* ===========================================================================
  * Initialize deflate state and buffers.
  * This function is hidden in ZLIB_COMPAT builds.
@@ -293,12 +411,7 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
         return Z_STREAM_ERROR;
 
     strm->msg = NULL;
-    if (strm->zalloc == NULL) {
-        strm->zalloc = PREFIX(zcalloc);
-        strm->opaque = NULL;
-    }
-    if (strm->zfree == NULL)
-        strm->zfree = PREFIX(zcfree);
+    PREFIX(zdefault_alloc)(strm);
 
     if (level == Z_DEFAULT_COMPRESSION)
         level = 6;
@@ -324,7 +437,8 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
 
     /* Allocate buffers */
     int lit_bufsize = 1 << (memLevel + 6);
-    deflate_allocs *alloc_bufs = alloc_deflate(strm, windowBits, lit_bufsize);
+    deflate_allocs *alloc_bufs = alloc_deflate(strm, windowBits, lit_bufsize, LIT_MEM_DEFAULT,
+                                               deflate_hash_tables(level, strategy));
     if (alloc_bufs == NULL)
         return Z_MEM_ERROR;
 
@@ -348,6 +462,7 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
     s->high_water = 0;      /* nothing written to s->window yet */
 
     s->lit_bufsize = lit_bufsize; /* 16K elements by default */
+    s->lit_mem = LIT_MEM_DEFAULT;
 
     /* We overlay pending_buf and sym_buf. This works since the average size
      * for length/distance pairs over any compressed block is assured to be 31
@@ -390,30 +505,21 @@ int32_t ZNG_CONDEXPORT PREFIX(deflateInit2)(PREFIX3(stream) *strm, int32_t level
 
     s->pending_buf_size = s->lit_bufsize * 4;
 
-    if (s->window == NULL || s->prev == NULL || s->head == NULL || s->pending_buf == NULL) {
+    if (s->window == NULL || s->pending_buf == NULL) {
         s->status = FINISH_STATE;
         strm->msg = ERR_MSG(Z_MEM_ERROR);
         PREFIX(deflateEnd)(strm);
         return Z_MEM_ERROR;
     }
 
-#ifdef LIT_MEM
-    s->d_buf = (uint16_t *)(s->pending_buf + (s->lit_bufsize << 1));
-    s->l_buf = s->pending_buf + (s->lit_bufsize << 2);
-    s->sym_end = s->lit_bufsize - 1;
-#else
-    s->sym_buf = s->pending_buf + s->lit_bufsize;
-    s->sym_end = (s->lit_bufsize - 1) * 3;
-#endif
-    /* We avoid equality with lit_bufsize*3 because of wraparound at 64K
-     * on 16 bit machines and because stored blocks are restricted to
-     * 64K-1 bytes.
-     */
+    deflate_set_sym_bufs(s);
 
     s->level = level;
     s->strategy = strategy;
     s->block_open = 0;
     s->reproducible = 0;
+    s->source_size = SIZE_MAX;
+    s->rsyncable = 0;
 
     return PREFIX(deflateReset)(strm);
 }
@@ -452,6 +558,34 @@ static int deflateStateCheck(PREFIX3(stream) *strm) {
     return 0;
 }
 
+#ifndef ZLIB_COMPAT
+/* Compact form of a stream between zng_deflateHibernate() and zng_deflateWake(). The state is kept with
+ * status set to HIBERNATE_STATE and alloc_bufs pointing to allocs, whose window holds the retained history
+ * and whose other buffers are NULL. */
+typedef struct deflate_hibernated_s {
+    deflate_allocs  allocs;
+    int             status;         /* status before hibernation */
+    uint32_t        raw_len;        /* bytes of history before strstart */
+    uint32_t        packed_len;     /* compressed size of the history, or 0 if stored as is */
+} deflate_hibernated;
+
+/* The part of deflate_state kept by a hibernated stream, which leaves out the per-block tree data */
+#define HIBERNATE_STATE_SIZE offsetof(deflate_state, dyn_ltree)
+
+/* =========================================================================
+ * Return the compact form of a hibernated deflate stream, or NULL if it is not hibernated.
+ */
+static deflate_hibernated *deflateHibernatedState(PREFIX3(stream) *strm) {
+    deflate_state *s;
+    if (strm == NULL || strm->zalloc == (alloc_func)0 || strm->zfree == (free_func)0)
+        return NULL;
+    s = strm->state;
+    if (s == NULL || s->alloc_bufs == NULL || s->strm != strm || s->status != HIBERNATE_STATE)
+        return NULL;
+    return (deflate_hibernated *)s->alloc_bufs;
+}
+#endif
+
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflateSetDictionary)(PREFIX3(stream) *strm, const uint8_t *dictionary, uint32_t dictLength) {
     deflate_state *s;
@@ -494,7 +628,8 @@ int32_t Z_EXPORT PREFIX(deflateSetDictionary)(PREFIX3(stream) *strm, const uint8
     while (s->lookahead >= STD_MIN_MATCH) {
         str = s->strstart;
         n = s->lookahead - (STD_MIN_MATCH - 1);
-        s->insert_string(s, str, n);
+        if (s->head != NULL)
+            s->insert_string(s, str, n);
         s->strstart = str + n;
         s->lookahead = STD_MIN_MATCH - 1;
         PREFIX(fill_window)(s);
@@ -561,6 +696,9 @@ int32_t Z_EXPORT PREFIX(deflateResetKeep)(PREFIX3(stream) *strm) {
 #endif
         strm->adler = ADLER32_INITIAL_VALUE;
     s->last_flush = -2;
+    s->block_open = 0;  /* a stream reset before it finished can leave a deflate_quick() block open */
+    s->rsync_hash = s->rsync_run = s->rsync_seen = s->rsync_cut = 0;
+    s->rsync_pending = 0;
 
     zng_tr_init(s);
 
@@ -606,15 +744,15 @@ int32_t Z_EXPORT PREFIX(deflatePrime)(PREFIX3(stream) *strm, int32_t bits, int32
         return Z_STREAM_ERROR;
     s = strm->state;
 
-#ifdef LIT_MEM
-    if (bits < 0 || bits > BIT_BUF_SIZE ||
-        (unsigned char *)s->d_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
-        return Z_BUF_ERROR;
-#else
-    if (bits < 0 || bits > BIT_BUF_SIZE || bits > (int32_t)(sizeof(value) << 3) ||
-        s->sym_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
-        return Z_BUF_ERROR;
-#endif
+    if (s->lit_mem) {
+        if (bits < 0 || bits > BIT_BUF_SIZE ||
+            (unsigned char *)s->d_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
+            return Z_BUF_ERROR;
+    } else {
+        if (bits < 0 || bits > BIT_BUF_SIZE || bits > (int32_t)(sizeof(value) << 3) ||
+            s->sym_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
+            return Z_BUF_ERROR;
+    }
 
     do {
         put = BIT_BUF_SIZE - s->bi_valid;
@@ -659,10 +797,16 @@ int32_t Z_EXPORT PREFIX(deflateParams)(PREFIX3(stream) *strm, int32_t level, int
         if (strm->avail_in || ((int)s->strstart - s->block_start) + s->lookahead || !DEFLATE_DONE(strm, flush))
             return Z_BUF_ERROR;
     }
+    if (deflate_hash_tables(level, strategy) > deflate_allocated_tables(s)) {
+        int err = deflate_grow_tables(strm, deflate_hash_tables(level, strategy));
+        if (err != Z_OK)
+            return err;
+        s = strm->state;
+    }
     if (s->level != level) {
         if (s->level == 0 && s->matches != 0) {
             if (s->matches == 1) {
-                FUNCTABLE_CALL(slide_hash)(s);
+                deflate_slide_hash(s);
             } else {
                 CLEAR_HASH(s);
             }
@@ -758,7 +902,7 @@ unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long
 
     /* if not default parameters, return conservative bound */
     if (DEFLATE_NEED_CONSERVATIVE_BOUND(strm) ||  /* hook for IBM Z DFLTCC */
-            s->w_bits != MAX_WBITS || HASH_BITS < 15) {
+            s->w_bits != MAX_WBITS || HASH_BITS < 15 || s->rsyncable) {
         if (s->level == 0) {
             /* upper bound for stored blocks with length 127 (memLevel == 1) --
                ~4% overhead plus a small constant */
@@ -780,6 +924,39 @@ unsigned long Z_EXPORT PREFIX(deflateBound)(PREFIX3(stream) *strm, unsigned long
 #endif
 }
 
+/* =========================================================================
+ * While the caller's output buffer has room for a full pending_buf worth of
+ * output, point pending_buf at strm->next_out so that the bit writer emits
+ * straight into it and flush_pending() only has to advance the stream. Since
+ * pending never exceeds pending_buf_size, writes stay within avail_out.
+ */
+static inline int direct_output(deflate_state *s) {
+    return s->pending_buf != s->alloc_bufs->pending_buf;
+}
+
+static void direct_output_begin(PREFIX3(stream) *strm) {
+    deflate_state *s = strm->state;
+
+    if (!direct_output(s) && s->pending == 0 && strm->avail_out >= s->pending_buf_size) {
+        s->pending_buf = strm->next_out;
+        s->pending_out = s->pending_buf;
+    }
+}
+
+/* Account for the bytes written to next_out and switch back to pending_buf */
+static void direct_output_end(PREFIX3(stream) *strm) {
+    deflate_state *s = strm->state;
+
+    if (!direct_output(s))
+        return;
+    strm->next_out  += s->pending;
+    strm->total_out += s->pending;
+    strm->avail_out -= s->pending;
+    s->pending = 0;
+    s->pending_buf = s->alloc_bufs->pending_buf;
+    s->pending_out = s->pending_buf;
+}
+
 /* =========================================================================
  * Flush as much pending output as possible. All deflate() output, except for
  * some deflate_stored() output, goes through this function so some
@@ -791,6 +968,12 @@ Z_INTERNAL void PREFIX(flush_pending)(PREFIX3(stream) *strm) {
     deflate_state *s = strm->state;
 
     zng_tr_flush_bits(s);
+    if (direct_output(s)) {
+        /* Output is already in place, keep writing directly if there is still room */
+        direct_output_end(strm);
+        direct_output_begin(strm);
+        return;
+    }
     len = MIN(s->pending, strm->avail_out);
     if (len == 0)
         return;
@@ -815,6 +998,92 @@ Z_INTERNAL void PREFIX(flush_pending)(PREFIX3(stream) *strm) {
             strm->adler = PREFIX(crc32)(strm->adler, s->pending_buf + (beg), s->pending - (beg)); \
     } while (0)
 
+/* ===========================================================================
+ * Compress with the block function for the level and strategy.
+ */
+static block_state deflate_compress(deflate_state *s, int flush) {
+    return s->level == 0 ? deflate_stored(s, flush) :
+           s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
+           s->strategy == Z_RLE ? deflate_rle(s, flush) :
+           (*(configuration_table[s->level].func))(s, flush);
+}
+
+/* ===========================================================================
+ * Look for the next rsyncable flush point in the input not hashed yet. If one
+ * is found, set rsync_cut to the number of bytes of next_in up to it.
+ */
+static void rsync_scan(deflate_state *s) {
+    const unsigned char *next = s->strm->next_in;
+    uint32_t seen = s->rsync_seen, avail = s->strm->avail_in;
+    uint32_t hash = s->rsync_hash, run = s->rsync_run;
+
+    while (seen < avail) {
+        hash = (hash << 1) + (next[seen++] + 1) * RSYNC_MULT;
+        if (++run >= RSYNC_MIN && (hash & RSYNC_MASK) == 0) {
+            s->rsync_cut = seen;
+            s->rsync_pending = 1;
+            run = 0;
+            break;
+        }
+    }
+    s->rsync_hash = hash;
+    s->rsync_run = run;
+    s->rsync_seen = seen;
+}
+
+/* ===========================================================================
+ * Compress as deflate_compress() does, but end the block and byte-align the
+ * output with an empty stored block at each rsyncable flush point, as for
+ * Z_SYNC_FLUSH. The window is kept, so that matches still reach back past
+ * the flush points.
+ */
+static block_state deflate_rsync(deflate_state *s, int flush) {
+    PREFIX3(stream) *strm = s->strm;
+    block_state bstate;
+    uint32_t avail, used;
+
+    for (;;) {
+        if (!s->rsync_pending)
+            rsync_scan(s);
+        avail = strm->avail_in;
+        if (!s->rsync_pending || (s->rsync_cut == avail &&
+                                  (flush == Z_SYNC_FLUSH || flush == Z_FULL_FLUSH || flush == Z_FINISH))) {
+            /* No flush point, or the caller's flush ends the block there anyway */
+            s->rsync_pending = 0;
+            bstate = deflate_compress(s, flush);
+            s->rsync_seen -= avail - strm->avail_in;
+            return bstate;
+        }
+
+        /* Compress up to the flush point, and then put the marker there */
+        used = s->rsync_cut;
+        strm->avail_in = used;
+        bstate = deflate_compress(s, Z_SYNC_FLUSH);
+        used -= strm->avail_in;
+        strm->avail_in = avail - used;
+        s->rsync_cut -= used;
+        s->rsync_seen -= used;
+        if (bstate != block_done)
+            return bstate;
+        s->rsync_pending = 0;
+        zng_tr_stored_block(s, NULL, 0, 0);
+        PREFIX(flush_pending)(strm);
+        if (strm->avail_out == 0 || (strm->avail_in == 0 && flush == Z_NO_FLUSH))
+            return need_more;
+    }
+}
+
+/* ===========================================================================
+ * Turn rsyncable flush points on or off, starting from the next input byte.
+ */
+void Z_INTERNAL deflate_set_rsyncable(PREFIX3(stream) *strm, int rsyncable) {
+    deflate_state *s = strm->state;
+
+    s->rsyncable = rsyncable != 0;
+    s->rsync_hash = s->rsync_run = s->rsync_seen = s->rsync_cut = 0;
+    s->rsync_pending = 0;
+}
+
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     int32_t old_flush; /* value of flush param for previous deflate call */
@@ -1036,11 +1305,15 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     if (strm->avail_in != 0 || s->lookahead != 0 || (flush != Z_NO_FLUSH && s->status != FINISH_STATE)) {
         block_state bstate;
 
+#ifndef S390_DFLTCC_DEFLATE
+        /* deflate_stored() copies into next_out itself */
+        if (s->level != 0)
+            direct_output_begin(strm);
+#endif
         bstate = DEFLATE_HOOK(strm, flush, &bstate) ? bstate :  /* hook for IBM Z DFLTCC */
-                 s->level == 0 ? deflate_stored(s, flush) :
-                 s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
-                 s->strategy == Z_RLE ? deflate_rle(s, flush) :
-                 (*(configuration_table[s->level].func))(s, flush);
+                 s->rsyncable && s->level != 0 ? deflate_rsync(s, flush) :
+                 deflate_compress(s, flush);
+        direct_output_end(strm);
 
         if (bstate == finish_started || bstate == finish_done) {
             s->status = FINISH_STATE;
@@ -1114,10 +1387,18 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
 
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflateEnd)(PREFIX3(stream) *strm) {
-    if (deflateStateCheck(strm))
-        return Z_STREAM_ERROR;
-
-    int32_t status = strm->state->status;
+    int32_t status;
+#ifndef ZLIB_COMPAT
+    deflate_hibernated *h = deflateHibernatedState(strm);
+    if (h != NULL) {
+        status = h->status;
+    } else
+#endif
+    {
+        if (deflateStateCheck(strm))
+            return Z_STREAM_ERROR;
+        status = strm->state->status;
+    }
 
     /* Free allocated buffers */
     free_deflate(strm);
@@ -1139,7 +1420,8 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
 
     memcpy((void *)dest, (void *)source, sizeof(PREFIX3(stream)));
 
-    deflate_allocs *alloc_bufs = alloc_deflate(dest, ss->w_bits, ss->lit_bufsize);
+    deflate_allocs *alloc_bufs = alloc_deflate(dest, ss->w_bits, ss->lit_bufsize, ss->lit_mem,
+                                               deflate_allocated_tables(ss));
     if (alloc_bufs == NULL)
         return Z_MEM_ERROR;
 
@@ -1155,23 +1437,20 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     ds->head = alloc_bufs->head;
     ds->pending_buf = alloc_bufs->pending_buf;
 
-    if (ds->window == NULL || ds->prev == NULL || ds->head == NULL || ds->pending_buf == NULL) {
+    if (ds->window == NULL || ds->pending_buf == NULL) {
         PREFIX(deflateEnd)(dest);
         return Z_MEM_ERROR;
     }
 
-    memcpy(ds->window, ss->window, DEFLATE_ADJUST_WINDOW_SIZE(ds->w_size * 2 * sizeof(unsigned char)));
-    memcpy((void *)ds->prev, (void *)ss->prev, ds->w_size * sizeof(Pos));
-    memcpy((void *)ds->head, (void *)ss->head, HASH_SIZE * sizeof(Pos));
-    memcpy(ds->pending_buf, ss->pending_buf, ds->lit_bufsize * LIT_BUFS);
+    memcpy(ds->window, ss->window, DEFLATE_ADJUST_WINDOW_SIZE(ds->w_size * WINDOW_FACTOR * sizeof(unsigned char)));
+    if (ds->prev != NULL)
+        memcpy((void *)ds->prev, (void *)ss->prev, ds->w_size * sizeof(Pos));
+    if (ds->head != NULL)
+        memcpy((void *)ds->head, (void *)ss->head, HASH_SIZE * sizeof(Pos));
+    memcpy(ds->pending_buf, ss->pending_buf, ds->lit_bufsize * LIT_BUFS(ds->lit_mem));
 
     ds->pending_out = ds->pending_buf + (ss->pending_out - ss->pending_buf);
-#ifdef LIT_MEM
-    ds->d_buf = (uint16_t *)(ds->pending_buf + (ds->lit_bufsize << 1));
-    ds->l_buf = ds->pending_buf + (ds->lit_bufsize << 2);
-#else
-    ds->sym_buf = ds->pending_buf + ds->lit_bufsize;
-#endif
+    deflate_set_sym_bufs(ds);
 
     ds->l_desc.dyn_tree = ds->dyn_ltree;
     ds->d_desc.dyn_tree = ds->dyn_dtree;
@@ -1220,29 +1499,44 @@ static void lm_set_level(deflate_state *s, int level) {
     s->nice_match       = configuration_table[level].nice_length;
     s->max_chain_length = configuration_table[level].max_chain;
 
+    s->level = level;
+    lm_set_hash_funcs(s);
+}
+
+/* ===========================================================================
+ * Select the hash functions for the level and the allocated hash tables
+ */
+static void lm_set_hash_funcs(deflate_state *s) {
     /* Use rolling hash for deflate_slow algorithm with level 9. It allows us to
      * properly lookup different hash chains to speed up longest_match search. Since hashing
-     * method changes depending on the level we cannot put this into functable. */
-    if (s->max_chain_length > 1024) {
+     * method changes depending on the level only the integer hash insert_string, which
+     * can be computed for many positions in parallel, is put into functable. */
+    if (configuration_table[s->level].max_chain > 1024) {
         s->update_hash = &update_hash_roll;
         s->insert_string = &insert_string_roll;
         s->quick_insert_string = &quick_insert_string_roll;
+    } else if (s->prev == NULL) {
+        /* Levels that do not walk the hash chains, see deflate_hash_tables() */
+        s->update_hash = update_hash;
+        s->insert_string = insert_string_head;
+        s->quick_insert_string = quick_insert_head;
     } else {
         s->update_hash = update_hash;
-        s->insert_string = insert_string;
+        s->insert_string = FUNCTABLE_FPTR(insert_string);
         s->quick_insert_string = quick_insert_string;
     }
-
-    s->level = level;
 }
 
 /* ===========================================================================
  * Initialize the "longest match" routines for a new zlib stream
  */
 static void lm_init(deflate_state *s) {
-    s->window_size = 2 * s->w_size;
+    s->window_size = WINDOW_FACTOR * s->w_size;
 
-    CLEAR_HASH(s);
+    /* Nothing is inserted before the first fill_window(), so leave clearing the
+     * hash table to it. A stream resized right after deflateInit() then only
+     * clears its final table. */
+    s->clear_hash = 1;
 
     /* Set the default configuration parameters:
      */
@@ -1273,29 +1567,35 @@ void Z_INTERNAL PREFIX(fill_window)(deflate_state *s) {
     unsigned n;
     unsigned int more;    /* Amount of free space at the end of the window. */
     unsigned int wsize = s->w_size;
+    unsigned int slide = WINDOW_SLIDE(s);
 
     Assert(s->lookahead < MIN_LOOKAHEAD, "already enough lookahead");
 
+    if (UNLIKELY(s->clear_hash)) {
+        CLEAR_HASH(s);
+        s->clear_hash = 0;
+    }
+
     do {
         more = s->window_size - s->lookahead - s->strstart;
 
         /* If the window is almost full and there is insufficient lookahead,
-         * move the upper half to the lower one to make room in the upper half.
+         * move the upper wsize bytes to the start to make room above them.
          */
-        if (s->strstart >= wsize+MAX_DIST(s)) {
-            memcpy(s->window, s->window+wsize, (unsigned)wsize);
-            if (s->match_start >= wsize) {
-                s->match_start -= wsize;
+        if (s->strstart >= slide+MAX_DIST(s)) {
+            memcpy(s->window, s->window+slide, (unsigned)wsize);
+            if (s->match_start >= slide) {
+                s->match_start -= slide;
             } else {
                 s->match_start = 0;
                 s->prev_length = 0;
             }
-            s->strstart    -= wsize; /* we now have strstart >= MAX_DIST */
-            s->block_start -= (int)wsize;
+            s->strstart    -= slide; /* we now have strstart >= MAX_DIST */
+            s->block_start -= (int)slide;
             if (s->insert > s->strstart)
                 s->insert = s->strstart;
-            FUNCTABLE_CALL(slide_hash)(s);
-            more += wsize;
+            deflate_slide_hash(s);
+            more += slide;
         }
         if (s->strm->avail_in == 0)
             break;
@@ -1308,7 +1608,7 @@ void Z_INTERNAL PREFIX(fill_window)(deflate_state *s) {
          * In the BIG_MEM or MMAP case (not yet supported),
          *   window_size == input_size + MIN_LOOKAHEAD  &&
          *   strstart + s->lookahead <= input_size => more >= MIN_LOOKAHEAD.
-         * Otherwise, window_size == 2*WSIZE so more >= 2.
+         * Otherwise, window_size >= 2*WSIZE so more >= 2.
          * If there was sliding, more >= WSIZE. So in all cases, more >= 2.
          */
         Assert(more >= 2, "more < 2");
@@ -1317,7 +1617,7 @@ void Z_INTERNAL PREFIX(fill_window)(deflate_state *s) {
         s->lookahead += n;
 
         /* Initialize the hash value now that we have some input: */
-        if (s->lookahead + s->insert >= STD_MIN_MATCH) {
+        if (s->head != NULL && s->lookahead + s->insert >= STD_MIN_MATCH) {
             unsigned int str = s->strstart - s->insert;
             if (UNLIKELY(s->max_chain_length > 1024)) {
                 s->ins_h = s->update_hash(s->window[str], s->window[str+1]);
@@ -1390,6 +1690,92 @@ static int32_t deflateSetParamPre(zng_deflate_param_value **out, size_t min_size
     return buf_error;
 }
 
+/* ===========================================================================
+ * Shrink windowBits and memLevel to the smallest values that still hold
+ * source_size bytes of input in a single window and a single block.
+ */
+void Z_INTERNAL deflate_size_params(size_t source_size, int32_t *windowBits, int32_t *memLevel) {
+    int32_t wbits = 9, mem = 1;
+
+    while (wbits < *windowBits && ((size_t)1 << wbits) - MIN_LOOKAHEAD < source_size)
+        wbits++;
+    while (mem < *memLevel && ((size_t)1 << (mem + 6)) <= source_size)
+        mem++;
+    *windowBits = MIN(*windowBits, wbits);
+    *memLevel = MIN(*memLevel, mem);
+}
+
+/* ===========================================================================
+ * Whether the stream has not been given any data or dictionary yet, so that
+ * its buffers can still be laid out differently.
+ */
+static int deflateStateEmpty(zng_stream *strm) {
+    deflate_state *s = strm->state;
+    return (s->status == INIT_STATE || s->status == GZIP_STATE) && strm->total_in == 0 && s->strstart == 0 &&
+        s->lookahead == 0 && s->pending == 0;
+}
+
+/* ===========================================================================
+ * Move an empty stream to buffers for a different window size, literal buffer
+ * size or symbol buffer layout.
+ */
+static int32_t deflateResize(zng_stream *strm, int32_t windowBits, int32_t lit_bufsize, int lit_mem) {
+    deflate_state *s = strm->state, *ns;
+
+    if (windowBits == (int32_t)s->w_bits && lit_bufsize == (int32_t)s->lit_bufsize && lit_mem == s->lit_mem)
+        return Z_OK;
+#ifdef S390_DFLTCC_DEFLATE
+    return Z_STREAM_ERROR;
+#endif
+
+    deflate_allocs *alloc_bufs = alloc_deflate(strm, windowBits, lit_bufsize, lit_mem, deflate_allocated_tables(s));
+    if (alloc_bufs == NULL)
+        return Z_MEM_ERROR;
+    ns = alloc_bufs->state;
+    memcpy(ns, s, sizeof(deflate_state));
+
+    ns->lit_bufsize = lit_bufsize;
+    ns->lit_mem = lit_mem;
+    ns->pending_buf_size = ns->lit_bufsize * 4;
+    deflate_move_state(ns, alloc_bufs);
+    ns->w_bits = (unsigned int)windowBits;
+    ns->w_size = 1 << ns->w_bits;
+    ns->w_mask = ns->w_size - 1;
+    ns->high_water = 0;
+
+    free_deflate(strm);
+    strm->state = (struct internal_state *)ns;
+    lm_init(ns);
+    return Z_OK;
+}
+
+/* ===========================================================================
+ * Apply the Z_DEFLATE_SOURCE_SIZE hint by moving a stream that has not seen
+ * any data yet to smaller buffers.
+ */
+static int32_t deflateSetSourceSize(zng_stream *strm, size_t source_size) {
+    deflate_state *s = strm->state;
+
+    if (!deflateStateEmpty(strm))
+        return Z_STREAM_ERROR;
+
+#ifndef S390_DFLTCC_DEFLATE
+    int32_t windowBits = (int32_t)s->w_bits;
+    int32_t memLevel = 1;
+    int32_t ret;
+
+    while ((1 << (memLevel + 6)) < (int)s->lit_bufsize)
+        memLevel++;
+    deflate_size_params(source_size, &windowBits, &memLevel);
+    ret = deflateResize(strm, windowBits, 1 << (memLevel + 6), s->lit_mem);
+    if (ret != Z_OK)
+        return ret;
+    s = strm->state;
+#endif
+    s->source_size = source_size;
+    return Z_OK;
+}
+
 /* ========================================================================= */
 int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value *params, size_t count) {
     size_t i;
@@ -1397,6 +1783,9 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
     zng_deflate_param_value *new_level = NULL;
     zng_deflate_param_value *new_strategy = NULL;
     zng_deflate_param_value *new_reproducible = NULL;
+    zng_deflate_param_value *new_source_size = NULL;
+    zng_deflate_param_value *new_lit_mem = NULL;
+    zng_deflate_param_value *new_rsyncable = NULL;
     int param_buf_error;
     int version_error = 0;
     int buf_error = 0;
@@ -1423,6 +1812,15 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             case Z_DEFLATE_REPRODUCIBLE:
                 param_buf_error = deflateSetParamPre(&new_reproducible, sizeof(int), &params[i]);
                 break;
+            case Z_DEFLATE_SOURCE_SIZE:
+                param_buf_error = deflateSetParamPre(&new_source_size, sizeof(size_t), &params[i]);
+                break;
+            case Z_DEFLATE_LIT_MEM:
+                param_buf_error = deflateSetParamPre(&new_lit_mem, sizeof(int), &params[i]);
+                break;
+            case Z_DEFLATE_RSYNCABLE:
+                param_buf_error = deflateSetParamPre(&new_rsyncable, sizeof(int), &params[i]);
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -1459,6 +1857,26 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             stream_error = 1;
         }
     }
+    if (new_lit_mem != NULL) {
+        int lit_mem = *(int *)new_lit_mem->buf != 0;
+        int32_t ret = Z_STREAM_ERROR;
+        if (lit_mem == s->lit_mem || deflateStateEmpty(strm))
+            ret = deflateResize(strm, (int32_t)s->w_bits, (int32_t)s->lit_bufsize, lit_mem);
+        if (ret != Z_OK) {
+            new_lit_mem->status = ret;
+            stream_error = 1;
+        }
+        s = strm->state;
+    }
+    if (new_rsyncable != NULL)
+        deflate_set_rsyncable(strm, *(int *)new_rsyncable->buf);
+    if (new_source_size != NULL) {
+        int32_t ret = deflateSetSourceSize(strm, *(size_t *)new_source_size->buf);
+        if (ret != Z_OK) {
+            new_source_size->status = ret;
+            stream_error = 1;
+        }
+    }
 
     /* Report version errors only if there are no real errors. */
     return stream_error ? Z_STREAM_ERROR : (version_error ? Z_VERSION_ERROR : Z_OK);
@@ -1500,6 +1918,24 @@ int32_t Z_EXPORT zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value
                 else
                     *(int *)params[i].buf = s->reproducible;
                 break;
+            case Z_DEFLATE_SOURCE_SIZE:
+                if (params[i].size < sizeof(size_t))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(size_t *)params[i].buf = s->source_size;
+                break;
+            case Z_DEFLATE_LIT_MEM:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = s->lit_mem;
+                break;
+            case Z_DEFLATE_RSYNCABLE:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = s->rsyncable;
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -1510,4 +1946,154 @@ int32_t Z_EXPORT zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value
     }
     return buf_error ? Z_BUF_ERROR : (version_error ? Z_VERSION_ERROR : Z_OK);
 }
+
+/* ===========================================================================
+ * Compress the window history of a hibernating stream, given as up to two
+ * segments, into dst. Returns the compressed length, or 0 if the history does
+ * not compress to less than dst_len bytes or memory could not be allocated.
+ */
+uint32_t Z_INTERNAL zng_hibernate_pack(zng_stream *strm, uint8_t *dst, uint32_t dst_len,
+                                       const uint8_t *src1, uint32_t len1, const uint8_t *src2, uint32_t len2) {
+    zng_stream tmp;
+    uint32_t packed = 0;
+    int32_t ret = Z_OK;
+
+    memset(&tmp, 0, sizeof(tmp));
+    tmp.zalloc = strm->zalloc;
+    tmp.zfree = strm->zfree;
+    tmp.opaque = strm->opaque;
+    if (zng_deflateInit2(&tmp, 1, Z_DEFLATED, -MAX_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+        return 0;
+
+    tmp.next_out = dst;
+    tmp.avail_out = dst_len;
+    if (len1 != 0) {
+        tmp.next_in = src1;
+        tmp.avail_in = len1;
+        ret = zng_deflate(&tmp, Z_NO_FLUSH);
+    }
+    if (ret == Z_OK && tmp.avail_in == 0) {
+        tmp.next_in = src2;
+        tmp.avail_in = len2;
+        ret = zng_deflate(&tmp, Z_FINISH);
+    }
+    if (ret == Z_STREAM_END)
+        packed = (uint32_t)tmp.total_out;
+    zng_deflateEnd(&tmp);
+    return packed;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_deflateHibernate(zng_stream *strm, int32_t flags) {
+    deflate_state *s, *hs;
+    deflate_hibernated *h;
+    uint8_t *packed = NULL;
+    uint32_t raw_len, packed_len = 0;
+
+    if (deflateStateCheck(strm) || (flags & ~Z_HIBERNATE_COMPRESS) != 0)
+        return Z_STREAM_ERROR;
+#ifdef S390_DFLTCC_DEFLATE
+    return Z_STREAM_ERROR;
+#endif
+    s = strm->state;
+
+    /* Only a stream that has been flushed up to strstart can be compacted to its history */
+    if (s->pending != 0 || s->lookahead != 0 || s->sym_next != 0 || s->match_available ||
+        s->block_open || s->block_start != (int)s->strstart)
+        return Z_BUF_ERROR;
+
+    raw_len = MIN(s->strstart, s->w_size);
+    if ((flags & Z_HIBERNATE_COMPRESS) && raw_len > 0) {
+        packed = (uint8_t *)strm->zalloc(strm->opaque, 1, raw_len);
+        if (packed != NULL)
+            packed_len = zng_hibernate_pack(strm, packed, raw_len - 1, s->window + s->strstart - raw_len, raw_len, NULL, 0);
+    }
+
+    /* Allocate the state, followed by the hibernation record and the history */
+    size_t data_size = packed_len ? packed_len : raw_len;
+    int hib_pos = PAD_16((int)HIBERNATE_STATE_SIZE);
+    int data_pos = hib_pos + (int)sizeof(deflate_hibernated);
+    char *original_buf;
+    char *buff = (char *)PREFIX(zalloc_aligned)(strm, PAD_64(data_pos + data_size), 64, &original_buf);
+    if (buff == NULL) {
+        if (packed != NULL)
+            strm->zfree(strm->opaque, packed);
+        return Z_MEM_ERROR;
+    }
+    buff = (char *)HINT_ALIGNED_64(buff);
+
+    hs = (deflate_state *)buff;
+    h = (deflate_hibernated *)(buff + hib_pos);
+    memset(h, 0, sizeof(deflate_hibernated));
+    h->allocs.buf_start = original_buf;
+    h->allocs.zfree = strm->zfree;
+    h->allocs.state = hs;
+    h->allocs.window = (unsigned char *)buff + data_pos;
+    h->status = s->status;
+    h->raw_len = raw_len;
+    h->packed_len = packed_len;
+    if (packed_len)
+        memcpy(h->allocs.window, packed, packed_len);
+    else if (raw_len)
+        memcpy(h->allocs.window, s->window + s->strstart - raw_len, raw_len);
+    if (packed != NULL)
+        strm->zfree(strm->opaque, packed);
+
+    memcpy(hs, s, HIBERNATE_STATE_SIZE);
+    hs->alloc_bufs = &h->allocs;
+    hs->window = h->allocs.window;
+    hs->prev = hs->head = NULL;
+    hs->pending_buf = hs->pending_out = NULL;
+    hs->status = HIBERNATE_STATE;
+
+    free_deflate(strm);
+    strm->state = (struct internal_state *)hs;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_deflateWake(zng_stream *strm) {
+    deflate_hibernated *h = deflateHibernatedState(strm);
+    deflate_state *s, *hs;
+
+    if (h == NULL)
+        return Z_STREAM_ERROR;
+    hs = strm->state;
+
+    deflate_allocs *alloc_bufs = alloc_deflate(strm, hs->w_bits, hs->lit_bufsize, hs->lit_mem,
+                                               deflate_hash_tables(hs->level, hs->strategy));
+    if (alloc_bufs == NULL)
+        return Z_MEM_ERROR;
+    s = alloc_bufs->state;
+
+    /* Restore the history to the start of the window */
+    if (h->packed_len) {
+        int32_t ret = zng_hibernate_unpack(strm, alloc_bufs->window, h->raw_len, h->allocs.window, h->packed_len);
+        if (ret != Z_OK) {
+            alloc_bufs->zfree(strm->opaque, alloc_bufs->buf_start);
+            return ret;
+        }
+    } else if (h->raw_len) {
+        memcpy(alloc_bufs->window, h->allocs.window, h->raw_len);
+    }
+
+    /* No block is open, so the tree data only needs to be set up for the next one */
+    zng_tr_init(s);
+    memcpy(s, hs, HIBERNATE_STATE_SIZE);
+    deflate_move_state(s, alloc_bufs);
+    lm_set_hash_funcs(s);
+    s->status = h->status;
+
+    /* The hash chains are rebuilt by fill_window() once new input arrives */
+    s->clear_hash = 1;
+    s->strstart = h->raw_len;
+    s->block_start = (int)s->strstart;
+    s->insert = s->strstart;
+    s->match_start = 0;
+    s->high_water = s->strstart;
+
+    h->allocs.zfree(strm->opaque, h->allocs.buf_start);
+    strm->state = (struct internal_state *)s;
+    return Z_OK;
+}
 #endif
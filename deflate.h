@@ -27,10 +27,15 @@
 #  define GZIP
 #endif
 
-/* define LIT_MEM to slightly increase the speed of deflate (order 1% to 2%) at
-   the cost of a larger memory footprint */
+/* define LIT_MEM to make separate distance and literal/length buffers the
+   default symbol buffer layout. It slightly increases the speed of deflate
+   (order 1% to 2%) at the cost of a larger memory footprint. Both layouts are
+   always compiled in, and zng_deflateSetParams() can pick one per stream. */
 #ifndef NO_LIT_MEM
 #  define LIT_MEM
+#  define LIT_MEM_DEFAULT 1
+#else
+#  define LIT_MEM_DEFAULT 0
 #endif
 
 /* ===========================================================================
@@ -76,6 +81,7 @@
 #else
 #  define MAX_STATE     FINISH_STATE
 #endif
+#define HIBERNATE_STATE 9    /* compacted by zng_deflateHibernate() -> previous status */
 /* Stream status */
 
 #define HASH_BITS    16u           /* log2(HASH_SIZE) */
@@ -110,10 +116,21 @@ typedef struct tree_desc_s {
     const static_tree_desc *stat_desc; /* the corresponding static tree */
 } tree_desc;
 
+#ifdef POS32
+typedef uint32_t Pos;
+#  define POS_MAX UINT32_MAX
+#  define WINDOW_FACTOR 16
+#else
 typedef uint16_t Pos;
+#  define POS_MAX UINT16_MAX
+#  define WINDOW_FACTOR 2
+#endif
 
 /* A Pos is an index in the character window. We use short instead of int to
- * save space in the various tables.
+ * save space in the various tables. With POS32 the window buffer holds
+ * WINDOW_FACTOR times w_size bytes, so the window and hash tables only need
+ * to be slid once every WINDOW_FACTOR-1 windows worth of input instead of
+ * every w_size bytes, at the expense of memory usage.
  */
 /* Type definitions for hash callbacks */
 typedef struct internal_state deflate_state;
@@ -121,10 +138,14 @@ typedef struct internal_state deflate_state;
 typedef uint32_t (* update_hash_cb)        (uint32_t h, uint32_t val);
 typedef void     (* insert_string_cb)      (deflate_state *const s, uint32_t str, uint32_t count);
 typedef Pos      (* quick_insert_string_cb)(deflate_state *const s, uint32_t str);
+typedef int      (* tr_tally_lit_cb)       (deflate_state *const s, unsigned char c);
+typedef int      (* tr_tally_dist_cb)      (deflate_state *const s, uint32_t dist, uint32_t len);
 
 uint32_t update_hash             (uint32_t h, uint32_t val);
 void     insert_string           (deflate_state *const s, uint32_t str, uint32_t count);
 Pos      quick_insert_string     (deflate_state *const s, uint32_t str);
+void     insert_string_head      (deflate_state *const s, uint32_t str, uint32_t count);
+Pos      quick_insert_head       (deflate_state *const s, uint32_t str);
 
 uint32_t update_hash_roll        (uint32_t h, uint32_t val);
 void     insert_string_roll      (deflate_state *const s, uint32_t str, uint32_t count);
@@ -153,6 +174,14 @@ struct ALIGNED_(64) internal_state {
     int                  status;           /* as the name implies */
     int                  last_flush;       /* value of flush param for previous deflate call */
     int                  reproducible;     /* Whether reproducible compression results are required. */
+    size_t               source_size;      /* Expected total input size, or SIZE_MAX if unknown. */
+
+    int      rsyncable;      /* whether to end blocks at content-defined flush points */
+    uint32_t rsync_hash;     /* rolling hash of the input up to next_in + rsync_seen */
+    uint32_t rsync_run;      /* bytes hashed since the last flush point */
+    uint32_t rsync_seen;     /* bytes of next_in already hashed */
+    uint32_t rsync_cut;      /* bytes of next_in up to the pending flush point */
+    int      rsync_pending;  /* true if rsync_cut is a flush point not yet reached */
 
     int block_open;
     /* Whether or not a block is currently open for the QUICK deflation scheme.
@@ -196,6 +225,8 @@ struct ALIGNED_(64) internal_state {
 
     Pos *head; /* Heads of the hash chains or 0. */
 
+    int clear_hash; /* head[] is to be cleared by the next fill_window() */
+
     uint32_t ins_h; /* hash index of string to be inserted */
 
     int block_start;
@@ -249,30 +280,6 @@ struct ALIGNED_(64) internal_state {
 
     struct crc32_fold_s ALIGNED_(16) crc_fold;
 
-                /* used by trees.c: */
-    /* Didn't use ct_data typedef below to suppress compiler warning */
-    struct ct_data_s dyn_ltree[HEAP_SIZE];   /* literal and length tree */
-    struct ct_data_s dyn_dtree[2*D_CODES+1]; /* distance tree */
-    struct ct_data_s bl_tree[2*BL_CODES+1];  /* Huffman tree for bit lengths */
-
-    struct tree_desc_s l_desc;               /* desc. for literal tree */
-    struct tree_desc_s d_desc;               /* desc. for distance tree */
-    struct tree_desc_s bl_desc;              /* desc. for bit length tree */
-
-    uint16_t bl_count[MAX_BITS+1];
-    /* number of codes at each bit length for an optimal tree */
-
-    int heap[2*L_CODES+1];      /* heap used to build the Huffman trees */
-    int heap_len;               /* number of elements in the heap */
-    int heap_max;               /* element of largest frequency */
-    /* The sons of heap[n] are heap[2*n] and heap[2*n+1]. heap[0] is not used.
-     * The same heap array is used to build all trees.
-     */
-
-    unsigned char depth[2*L_CODES+1];
-    /* Depth of each subtree used as tie breaker for trees of equal frequency
-     */
-
     unsigned int  lit_bufsize;
     /* Size of match buffer for literals/lengths.  There are 4 reasons for
      * limiting lit_bufsize to 64K:
@@ -293,14 +300,15 @@ struct ALIGNED_(64) internal_state {
      *   - I can't count above 4
      */
 
-#ifdef LIT_MEM
-#   define LIT_BUFS 5
-    uint16_t *d_buf;              /* buffer for distances */
-    unsigned char *l_buf;         /* buffer for literals/lengths */
-#else
-#   define LIT_BUFS 4
-    unsigned char *sym_buf;       /* buffer for distances and literals/lengths */
-#endif
+#define LIT_BUFS(lit_mem) ((lit_mem) ? 5 : 4)
+    int lit_mem;                  /* use d_buf and l_buf rather than sym_buf */
+    uint16_t *d_buf;              /* buffer for distances, if lit_mem */
+    unsigned char *l_buf;         /* buffer for literals/lengths, if lit_mem */
+    unsigned char *sym_buf;       /* buffer for distances and literals/lengths, if not lit_mem */
+
+    tr_tally_lit_cb  tr_tally_lit;
+    tr_tally_dist_cb tr_tally_dist;
+    /* Symbol tally callbacks for the buffer layout chosen by lit_mem */
 
     unsigned int sym_next;        /* running index in symbol buffer */
     unsigned int sym_end;         /* symbol table full when sym_next reaches this */
@@ -326,6 +334,30 @@ struct ALIGNED_(64) internal_state {
     int32_t bi_valid;
     /* Number of valid bits in bi_buf.  All bits above the last valid bit are always zero. */
 
+                /* used by trees.c while a block is open, kept last for zng_deflateHibernate() to drop: */
+    /* Didn't use ct_data typedef below to suppress compiler warning */
+    struct ct_data_s dyn_ltree[HEAP_SIZE];   /* literal and length tree */
+    struct ct_data_s dyn_dtree[2*D_CODES+1]; /* distance tree */
+    struct ct_data_s bl_tree[2*BL_CODES+1];  /* Huffman tree for bit lengths */
+
+    struct tree_desc_s l_desc;               /* desc. for literal tree */
+    struct tree_desc_s d_desc;               /* desc. for distance tree */
+    struct tree_desc_s bl_desc;              /* desc. for bit length tree */
+
+    uint16_t bl_count[MAX_BITS+1];
+    /* number of codes at each bit length for an optimal tree */
+
+    int heap[2*L_CODES+1];      /* heap used to build the Huffman trees */
+    int heap_len;               /* number of elements in the heap */
+    int heap_max;               /* element of largest frequency */
+    /* The sons of heap[n] are heap[2*n] and heap[2*n+1]. heap[0] is not used.
+     * The same heap array is used to build all trees.
+     */
+
+    unsigned char depth[2*L_CODES+1];
+    /* Depth of each subtree used as tie breaker for trees of equal frequency
+     */
+
     /* Reserved for future use and alignment purposes */
     int32_t reserved[19];
 #if defined(_M_IX86) || defined(_M_ARM)
@@ -417,6 +449,22 @@ static inline void put_uint64(deflate_state *s, uint64_t lld) {
  * distances are limited to MAX_DIST instead of WSIZE.
  */
 
+#define WINDOW_SLIDE(s)  ((s)->window_size - (s)->w_size)
+/* Distance the window contents and hash chain positions are moved down by
+ * when the window is full. Equals w_size unless built with POS32.
+ */
+
+#define RSYNC_MULT 0x9e3779b1U
+#define RSYNC_MASK 0xfff00000U
+#define RSYNC_MIN 512
+/* Rsyncable flush points. Each input byte is shifted into a 32-bit gear hash,
+ * so that the top bits depend only on the last 32 bytes. A flush point is put
+ * after any byte where the bits in RSYNC_MASK are all zero, once at least
+ * RSYNC_MIN bytes have gone by since the last one. That is one every 4.5K on
+ * average, placed by the content alone, so that the compressed data between
+ * flush points away from an edit stays the same.
+ */
+
 #define WIN_INIT STD_MAX_MATCH
 /* Number of bytes after end of data in window to initialize in order to avoid
    memory checker errors from longest match routines */
@@ -424,6 +472,10 @@ static inline void put_uint64(deflate_state *s, uint64_t lld) {
 
 void Z_INTERNAL PREFIX(fill_window)(deflate_state *s);
 void Z_INTERNAL slide_hash_c(deflate_state *s);
+void Z_INTERNAL deflate_set_rsyncable(PREFIX3(stream) *strm, int rsyncable);
+#ifndef ZLIB_COMPAT
+void Z_INTERNAL deflate_size_params(size_t source_size, int32_t *windowBits, int32_t *memLevel);
+#endif
 
         /* in trees.c */
 void Z_INTERNAL zng_tr_init(deflate_state *s);
@@ -431,6 +483,10 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
 void Z_INTERNAL zng_tr_flush_bits(deflate_state *s);
 void Z_INTERNAL zng_tr_align(deflate_state *s);
 void Z_INTERNAL zng_tr_stored_block(deflate_state *s, char *buf, uint32_t stored_len, int last);
+int Z_INTERNAL zng_tr_tally_lit_split(deflate_state *const s, unsigned char c);
+int Z_INTERNAL zng_tr_tally_dist_split(deflate_state *const s, uint32_t dist, uint32_t len);
+int Z_INTERNAL zng_tr_tally_lit_sym(deflate_state *const s, unsigned char c);
+int Z_INTERNAL zng_tr_tally_dist_sym(deflate_state *const s, uint32_t dist, uint32_t len);
 uint16_t Z_INTERNAL PREFIX(bi_reverse)(unsigned code, int len);
 void Z_INTERNAL PREFIX(flush_pending)(PREFIX3(streamp) strm);
 #define d_code(dist) ((dist) < 256 ? zng_dist_code[dist] : zng_dist_code[256+((dist)>>7)])
@@ -13,10 +13,10 @@
 #include "functable.h"
 
 struct match {
-    uint16_t match_start;
+    Pos      match_start;
     uint16_t match_length;
-    uint16_t strstart;
-    uint16_t orgstart;
+    Pos      strstart;
+    Pos      orgstart;
 };
 
 static int emit_match(deflate_state *s, struct match match) {
@@ -54,9 +54,9 @@ static void insert_match(deflate_state *s, struct match match) {
         if (UNLIKELY(match.match_length > 0)) {
             if (match.strstart >= match.orgstart) {
                 if (match.strstart + match.match_length - 1 >= match.orgstart) {
-                    insert_string(s, match.strstart, match.match_length);
+                    FUNCTABLE_CALL(insert_string)(s, match.strstart, match.match_length);
                 } else {
-                    insert_string(s, match.strstart, match.orgstart - match.strstart + 1);
+                    FUNCTABLE_CALL(insert_string)(s, match.strstart, match.orgstart - match.strstart + 1);
                 }
                 match.strstart += match.match_length;
                 match.match_length = 0;
@@ -68,12 +68,12 @@ static void insert_match(deflate_state *s, struct match match) {
     /* Insert into hash table. */
     if (LIKELY(match.strstart >= match.orgstart)) {
         if (LIKELY(match.strstart + match.match_length - 1 >= match.orgstart)) {
-            insert_string(s, match.strstart, match.match_length);
+            FUNCTABLE_CALL(insert_string)(s, match.strstart, match.match_length);
         } else {
-            insert_string(s, match.strstart, match.orgstart - match.strstart + 1);
+            FUNCTABLE_CALL(insert_string)(s, match.strstart, match.orgstart - match.strstart + 1);
         }
     } else if (match.orgstart < match.strstart + match.match_length) {
-        insert_string(s, match.orgstart, match.strstart + match.match_length - match.orgstart);
+        FUNCTABLE_CALL(insert_string)(s, match.orgstart, match.strstart + match.match_length - match.orgstart);
     }
     match.strstart += match.match_length;
     match.match_length = 0;
@@ -187,7 +187,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
                 hash_head = quick_insert_string(s, s->strstart);
             }
 
-            current_match.strstart = (uint16_t)s->strstart;
+            current_match.strstart = (Pos)s->strstart;
             current_match.orgstart = current_match.strstart;
 
             /* Find the longest match, discarding those <= prev_length.
@@ -201,7 +201,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
                  * of the string with itself at the start of the input file).
                  */
                 current_match.match_length = (uint16_t)FUNCTABLE_CALL(longest_match)(s, hash_head);
-                current_match.match_start = (uint16_t)s->match_start;
+                current_match.match_start = (Pos)s->match_start;
                 if (UNLIKELY(current_match.match_length < WANT_MIN_MATCH))
                     current_match.match_length = 1;
                 if (UNLIKELY(current_match.match_start >= current_match.strstart)) {
@@ -222,7 +222,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
             s->strstart = current_match.strstart + current_match.match_length;
             hash_head = quick_insert_string(s, s->strstart);
 
-            next_match.strstart = (uint16_t)s->strstart;
+            next_match.strstart = (Pos)s->strstart;
             next_match.orgstart = next_match.strstart;
 
             /* Find the longest match, discarding those <= prev_length.
@@ -236,7 +236,7 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush) {
                  * of the string with itself at the start of the input file).
                  */
                 next_match.match_length = (uint16_t)FUNCTABLE_CALL(longest_match)(s, hash_head);
-                next_match.match_start = (uint16_t)s->match_start;
+                next_match.match_start = (Pos)s->match_start;
                 if (UNLIKELY(next_match.match_start >= next_match.strstart)) {
                     /* this can happen due to some restarts */
                     next_match.match_length = 1;
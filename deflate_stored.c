@@ -120,8 +120,8 @@ Z_INTERNAL block_state deflate_stored(deflate_state *s, int flush) {
         } else {
             if (s->window_size - s->strstart <= used) {
                 /* Slide the window down. */
-                s->strstart -= s->w_size;
-                memcpy(s->window, s->window + s->w_size, s->strstart);
+                s->strstart -= WINDOW_SLIDE(s);
+                memcpy(s->window, s->window + WINDOW_SLIDE(s), s->strstart);
                 if (s->matches < 2)
                     s->matches++;   /* add a pending slide_hash() */
                 s->insert = MIN(s->insert, s->strstart);
@@ -144,14 +144,14 @@ Z_INTERNAL block_state deflate_stored(deflate_state *s, int flush) {
 
     /* Fill the window with any remaining input. */
     have = s->window_size - s->strstart;
-    if (s->strm->avail_in > have && s->block_start >= (int)s->w_size) {
+    if (s->strm->avail_in > have && s->block_start >= (int)WINDOW_SLIDE(s)) {
         /* Slide the window down. */
-        s->block_start -= (int)s->w_size;
-        s->strstart -= s->w_size;
-        memcpy(s->window, s->window + s->w_size, s->strstart);
+        s->block_start -= (int)WINDOW_SLIDE(s);
+        s->strstart -= WINDOW_SLIDE(s);
+        memcpy(s->window, s->window + WINDOW_SLIDE(s), s->strstart);
         if (s->matches < 2)
             s->matches++;           /* add a pending slide_hash() */
-        have += s->w_size;          /* more space now */
+        have += WINDOW_SLIDE(s);    /* more space now */
         s->insert = MIN(s->insert, s->strstart);
     }
 
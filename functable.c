@@ -59,7 +59,15 @@ static void init_functable(void) {
     ft.crc32_fold_copy = &crc32_fold_copy_c;
     ft.crc32_fold_final = &crc32_fold_final_c;
     ft.crc32_fold_reset = &crc32_fold_reset_c;
+    ft.crc32_multi = &crc32_multi_c;
+    ft.crc32c = &crc32c_braid;
+    ft.crc32c_fold_copy = &crc32c_fold_copy_c;
+    ft.crc64 = &crc64_c;
+    ft.crc64_fold_copy = &crc64_fold_copy_c;
+    ft.crc64_nvme = &crc64_nvme_c;
+    ft.crc64_nvme_fold_copy = &crc64_nvme_fold_copy_c;
     ft.inflate_fast = &inflate_fast_c;
+    ft.insert_string = &insert_string;
     ft.slide_hash = &slide_hash_c;
     ft.longest_match = &longest_match_generic;
     ft.longest_match_slow = &longest_match_slow_generic;
@@ -106,6 +114,17 @@ static void init_functable(void) {
         ft.crc32_fold_copy = &crc32_fold_pclmulqdq_copy;
         ft.crc32_fold_final = &crc32_fold_pclmulqdq_final;
         ft.crc32_fold_reset = &crc32_fold_pclmulqdq_reset;
+        ft.crc32_multi = &crc32_multi_pclmulqdq;
+    }
+    if (cf.x86.has_sse42 && cf.x86.has_pclmulqdq) {
+        ft.crc32c = &crc32c_sse42;
+        ft.crc32c_fold_copy = &crc32c_fold_copy_sse42;
+    }
+    if (cf.x86.has_pclmulqdq) {
+        ft.crc64 = &crc64_pclmulqdq;
+        ft.crc64_fold_copy = &crc64_fold_copy_pclmulqdq;
+        ft.crc64_nvme = &crc64_nvme_pclmulqdq;
+        ft.crc64_nvme_fold_copy = &crc64_nvme_fold_copy_pclmulqdq;
     }
 #endif
     // X86 - AVX
@@ -116,6 +135,7 @@ static void init_functable(void) {
         ft.chunkmemset_safe = &chunkmemset_safe_avx2;
         ft.chunksize = &chunksize_avx2;
         ft.inflate_fast = &inflate_fast_avx2;
+        ft.insert_string = &insert_string_avx2;
         ft.slide_hash = &slide_hash_avx2;
 #  ifdef HAVE_BUILTIN_CTZ
         ft.compare256 = &compare256_avx2;
@@ -123,6 +143,16 @@ static void init_functable(void) {
         ft.longest_match_slow = &longest_match_slow_avx2;
 #  endif
     }
+#endif
+    // X86 - VPCLMULQDQ (AVX2)
+#ifdef X86_VPCLMULQDQ_AVX2_CRC
+    if (cf.x86.has_pclmulqdq && cf.x86.has_avx2 && cf.x86.has_vpclmulqdq) {
+        ft.crc32 = &crc32_vpclmulqdq_avx2;
+        ft.crc32_fold = &crc32_fold_vpclmulqdq_avx2;
+        ft.crc32_fold_copy = &crc32_fold_vpclmulqdq_avx2_copy;
+        ft.crc32_fold_final = &crc32_fold_vpclmulqdq_avx2_final;
+        ft.crc32_fold_reset = &crc32_fold_vpclmulqdq_avx2_reset;
+    }
 #endif
     // X86 - AVX512 (F,DQ,BW,Vl)
 #ifdef X86_AVX512
@@ -145,6 +175,11 @@ static void init_functable(void) {
         ft.crc32_fold_copy = &crc32_fold_vpclmulqdq_copy;
         ft.crc32_fold_final = &crc32_fold_vpclmulqdq_final;
         ft.crc32_fold_reset = &crc32_fold_vpclmulqdq_reset;
+        ft.crc32_multi = &crc32_multi_vpclmulqdq;
+        ft.crc64 = &crc64_vpclmulqdq;
+        ft.crc64_fold_copy = &crc64_fold_copy_vpclmulqdq;
+        ft.crc64_nvme = &crc64_nvme_vpclmulqdq;
+        ft.crc64_nvme_fold_copy = &crc64_nvme_fold_copy_vpclmulqdq;
     }
 #endif
 
@@ -168,6 +203,7 @@ static void init_functable(void) {
         ft.chunkmemset_safe = &chunkmemset_safe_neon;
         ft.chunksize = &chunksize_neon;
         ft.inflate_fast = &inflate_fast_neon;
+        ft.insert_string = &insert_string_neon;
         ft.slide_hash = &slide_hash_neon;
 #  ifdef HAVE_BUILTIN_CTZLL
         ft.compare256 = &compare256_neon;
@@ -180,6 +216,7 @@ static void init_functable(void) {
 #ifdef ARM_ACLE
     if (cf.arm.has_crc32) {
         ft.crc32 = &crc32_acle;
+        ft.crc32c = &crc32c_acle;
     }
 #endif
 
@@ -237,6 +274,11 @@ static void init_functable(void) {
         ft.crc32 = crc32_s390_vx;
 #endif
 
+#ifdef POS32
+    // Arch-optimized slide_hash variants operate on 16-bit positions
+    ft.slide_hash = &slide_hash_c;
+#endif
+
     // Assign function pointers individually for atomic operation
     FUNCTABLE_ASSIGN(ft, force_init);
     FUNCTABLE_ASSIGN(ft, adler32);
@@ -249,7 +291,15 @@ static void init_functable(void) {
     FUNCTABLE_ASSIGN(ft, crc32_fold_copy);
     FUNCTABLE_ASSIGN(ft, crc32_fold_final);
     FUNCTABLE_ASSIGN(ft, crc32_fold_reset);
+    FUNCTABLE_ASSIGN(ft, crc32_multi);
+    FUNCTABLE_ASSIGN(ft, crc32c);
+    FUNCTABLE_ASSIGN(ft, crc32c_fold_copy);
+    FUNCTABLE_ASSIGN(ft, crc64);
+    FUNCTABLE_ASSIGN(ft, crc64_fold_copy);
+    FUNCTABLE_ASSIGN(ft, crc64_nvme);
+    FUNCTABLE_ASSIGN(ft, crc64_nvme_fold_copy);
     FUNCTABLE_ASSIGN(ft, inflate_fast);
+    FUNCTABLE_ASSIGN(ft, insert_string);
     FUNCTABLE_ASSIGN(ft, longest_match);
     FUNCTABLE_ASSIGN(ft, longest_match_slow);
     FUNCTABLE_ASSIGN(ft, slide_hash);
@@ -313,11 +363,51 @@ static uint32_t crc32_fold_reset_stub(crc32_fold* crc) {
     return functable.crc32_fold_reset(crc);
 }
 
+static void crc32_multi_stub(uint32_t* crc, const uint8_t* const* buf, const size_t* len) {
+    init_functable();
+    functable.crc32_multi(crc, buf, len);
+}
+
+static uint32_t crc32c_stub(uint32_t crc, const uint8_t* buf, size_t len) {
+    init_functable();
+    return functable.crc32c(crc, buf, len);
+}
+
+static uint32_t crc32c_fold_copy_stub(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t len) {
+    init_functable();
+    return functable.crc32c_fold_copy(crc, dst, src, len);
+}
+
+static uint64_t crc64_stub(uint64_t crc, const uint8_t* buf, size_t len) {
+    init_functable();
+    return functable.crc64(crc, buf, len);
+}
+
+static uint64_t crc64_fold_copy_stub(uint64_t crc, uint8_t* dst, const uint8_t* src, size_t len) {
+    init_functable();
+    return functable.crc64_fold_copy(crc, dst, src, len);
+}
+
+static uint64_t crc64_nvme_stub(uint64_t crc, const uint8_t* buf, size_t len) {
+    init_functable();
+    return functable.crc64_nvme(crc, buf, len);
+}
+
+static uint64_t crc64_nvme_fold_copy_stub(uint64_t crc, uint8_t* dst, const uint8_t* src, size_t len) {
+    init_functable();
+    return functable.crc64_nvme_fold_copy(crc, dst, src, len);
+}
+
 static void inflate_fast_stub(PREFIX3(stream) *strm, uint32_t start) {
     init_functable();
     functable.inflate_fast(strm, start);
 }
 
+static void insert_string_stub(deflate_state* const s, uint32_t str, uint32_t count) {
+    init_functable();
+    functable.insert_string(s, str, count);
+}
+
 static uint32_t longest_match_stub(deflate_state* const s, Pos cur_match) {
     init_functable();
     return functable.longest_match(s, cur_match);
@@ -346,7 +436,15 @@ Z_INTERNAL struct functable_s functable = {
     crc32_fold_copy_stub,
     crc32_fold_final_stub,
     crc32_fold_reset_stub,
+    crc32_multi_stub,
+    crc32c_stub,
+    crc32c_fold_copy_stub,
+    crc64_stub,
+    crc64_fold_copy_stub,
+    crc64_nvme_stub,
+    crc64_nvme_fold_copy_stub,
     inflate_fast_stub,
+    insert_string_stub,
     longest_match_stub,
     longest_match_slow_stub,
     slide_hash_stub,
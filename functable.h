@@ -35,7 +35,15 @@ struct functable_s {
     void     (* crc32_fold_copy)    (struct crc32_fold_s *crc, uint8_t *dst, const uint8_t *src, size_t len);
     uint32_t (* crc32_fold_final)   (struct crc32_fold_s *crc);
     uint32_t (* crc32_fold_reset)   (struct crc32_fold_s *crc);
+    void     (* crc32_multi)        (uint32_t *crc, const uint8_t *const *buf, const size_t *len);
+    uint32_t (* crc32c)             (uint32_t crc, const uint8_t *buf, size_t len);
+    uint32_t (* crc32c_fold_copy)   (uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+    uint64_t (* crc64)              (uint64_t crc, const uint8_t *buf, size_t len);
+    uint64_t (* crc64_fold_copy)    (uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+    uint64_t (* crc64_nvme)         (uint64_t crc, const uint8_t *buf, size_t len);
+    uint64_t (* crc64_nvme_fold_copy) (uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
     void     (* inflate_fast)       (PREFIX3(stream) *strm, uint32_t start);
+    void     (* insert_string)      (deflate_state *const s, uint32_t str, uint32_t count);
     uint32_t (* longest_match)      (deflate_state *const s, Pos cur_match);
     uint32_t (* longest_match_slow) (deflate_state *const s, Pos cur_match);
     void     (* slide_hash)         (deflate_state *s);
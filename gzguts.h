@@ -32,6 +32,7 @@
 #else
 #  include "zlib-ng.h"
 #endif
+#include "zthread.h"
 
 #ifdef _WIN32
 #  include <stddef.h>
@@ -42,6 +43,19 @@
 #  define WIDECHAR
 #endif
 
+#if defined(_WIN32)
+#  define LSEEK _lseeki64
+#  define FTRUNCATE _chsize_s
+#else
+#if defined(_LARGEFILE64_SOURCE) && _LFS64_LARGEFILE-0
+#  define LSEEK lseek64
+#  define FTRUNCATE ftruncate64
+#else
+#  define LSEEK lseek
+#  define FTRUNCATE ftruncate
+#endif
+#endif
+
 #ifdef WINAPI_FAMILY
 #  define open _open
 #  define read _read
@@ -96,6 +110,121 @@
 #define LOOK 0      /* look for a gzip header */
 #define COPY 1      /* copy input directly */
 #define GZIP 2      /* decompress a gzip stream */
+#define BGZF 3      /* decompress BGZF members, or any gzip members with "P", in parallel */
+#define AHEAD 4     /* take data decompressed ahead by another thread ("A") */
+
+/* BGZF (blocked gzip, opened with "B") is a series of gzip members of at most
+   64K each, with the size of each member in a "BC" extra subfield so that
+   members can be found without decompressing, ended by an empty member */
+#define BGZF_HEADER 18          /* size of a BGZF member header */
+#define BGZF_TRAILER 8          /* size of a gzip trailer */
+#define BGZF_MAX_SIZE 65536     /* largest member, and largest uncompressed data of a member */
+#define BGZF_BLOCK 0xff00       /* uncompressed data per member when writing */
+#define BGZF_BATCH 4            /* members decoded per thread at a time when reading */
+#define BGZF_MAX_THREADS 64     /* most threads decoding one file */
+
+/* With "P", other gzip members are found by looking for the header of the next
+   one, and take the size of their data from the trailer just before it.  Those
+   that do not fit in a batch are decoded one at a time as usual. */
+#define PGZIP_IN 1048576        /* compressed data per thread read at a time */
+#define PGZIP_OUT 4194304       /* most uncompressed data per thread in a batch */
+#define PGZIP_BATCH 64          /* most members per thread in a batch */
+
+/* start of a BGZF member, as in a .gzi index, or of a gzip stream in the index
+   of a seekable file */
+typedef struct {
+    uint64_t coff;          /* offset of the member in the file */
+    uint64_t uoff;          /* offset of its data in the uncompressed data */
+} gz_bgzf_entry;
+
+/* member of the batch being decoded */
+typedef struct {
+    const unsigned char *next;  /* compressed member */
+    unsigned len;           /* size of the compressed member */
+    unsigned size;          /* size of its uncompressed data */
+    unsigned out;           /* offset of the uncompressed data in the output buffer */
+    z_off64_t coff;         /* offset of the member in the file, -1 if not known */
+} gz_bgzf_member;
+
+struct gz_bgzf_s;
+
+/* decoding thread */
+typedef struct {
+    PREFIX3(stream) strm;   /* inflate stream of this thread */
+    struct gz_bgzf_s *bgzf; /* BGZF state the thread works for */
+    zthread thread;         /* the thread, unused for the first worker, which is the caller */
+} gz_bgzf_worker;
+
+/* BGZF state, also used for reading with "P" */
+typedef struct gz_bgzf_s {
+        /* used for both reading and writing */
+    gz_bgzf_entry *index;   /* start of each member but the first, NULL if none */
+    size_t index_have;      /* number of entries in index */
+    size_t index_size;      /* number of entries allocated */
+        /* just for writing */
+    char *index_path;       /* where gzclose() saves the index, NULL if not requested */
+    unsigned char *block;   /* uncompressed data of the next member */
+    unsigned have;          /* amount of data in block */
+    z_off64_t coff;         /* offset of the next member in the file */
+    z_off64_t uoff;         /* uncompressed data in the members written so far */
+        /* just for reading */
+    int scan;               /* true to also decode other gzip members in parallel ("P") */
+    unsigned char *in;      /* compressed members */
+    unsigned in_size;       /* size of in */
+    unsigned out_size;      /* size of the output buffer of the gz_state */
+    unsigned char *dest;    /* where the batch is decoded to */
+    gz_bgzf_member *member; /* members of the current batch */
+    unsigned max_count;     /* most members in a batch */
+    unsigned count;         /* members in the current batch */
+    unsigned total;         /* uncompressed data in the current batch */
+    gz_bgzf_worker *worker; /* one per thread, zero if not set up yet */
+    unsigned workers;       /* number of workers with an inflate stream */
+    unsigned started;       /* number of worker threads running */
+        /* shared with the worker threads, protected by lock */
+    zthread_mutex lock;
+    zthread_cond work;      /* signaled when a batch is ready or when stopping */
+    zthread_cond done;      /* signaled when the last member of the batch is decoded */
+    unsigned claim;         /* next member of the batch to decode */
+    unsigned finished;      /* members of the batch decoded */
+    unsigned fail;          /* first member of the batch that did not decode, or count */
+    int stop;               /* true to end the worker threads */
+} gz_bgzf;
+
+/* With "S", the gzip stream is ended every GZ_SPAN bytes of uncompressed data
+   unless gzseekable() says otherwise, and gzclose() appends an index of where
+   the next ones start, as empty gzip streams with up to GZ_INDEX_MAX entries
+   each in the extra field.  The last one ends with a locator of GZ_INDEX_TAIL
+   bytes, so that a reader can find the index from the end of the file. */
+#define GZ_SPAN 1048576
+#define GZ_INDEX_MAX 4094
+#define GZ_INDEX_TAIL 30
+
+/* input file mapped into memory ("m"), or the application's memory to read
+   from with gzopen_mem(), shared with the read-ahead state like the file
+   descriptor */
+typedef struct {
+    const unsigned char *data;  /* the whole file */
+    z_off64_t size;         /* size of the file */
+    z_off64_t pos;          /* offset of the next input, as the file offset would be */
+    int mapped;             /* true if data is to be unmapped, false if the application's */
+} gz_map;
+
+/* memory written to instead of a file with gzopen_memstream(), grown as
+   needed, and handed to the application at gzclose() */
+typedef struct {
+    unsigned char *data;    /* the output so far, allocated with malloc() */
+    size_t len;             /* bytes of output */
+    size_t size;            /* bytes allocated at data */
+    void **buf;             /* where to tell the application about data */
+    size_t *buf_len;        /* and about len */
+} gz_mem;
+
+/* With "A", another thread reads and decompresses into a ring of this many
+   buffers ahead of the application */
+#define GZ_AHEAD_SLOTS 4
+
+struct gz_ahead_s;
+struct gz_uring_s;
 
 /* internal gzip file state data structure */
 typedef struct {
@@ -106,22 +235,42 @@ typedef struct {
                             /* x.pos: current position in uncompressed data */
         /* used for both reading and writing */
     int mode;               /* see gzip modes above */
-    int fd;                 /* file descriptor */
+    int fd;                 /* file descriptor, -1 for memory */
     char *path;             /* path or fd for error messages */
     unsigned size;          /* buffer size, zero if not allocated yet */
     unsigned want;          /* requested buffer size, default is GZBUFSIZE */
     unsigned char *in;      /* input buffer (double-sized when writing) */
     unsigned char *out;     /* output buffer (double-sized when reading) */
     int direct;             /* 0 if processing gzip, 1 if transparent */
+    gz_bgzf *bgzf;          /* BGZF state, NULL if not opened with "B" or "P" */
+    struct gz_uring_s *uring; /* io_uring state, NULL if not opened with "u" or not available */
+    gz_bgzf_entry *index;   /* start of each gzip stream but the first of a seekable file, NULL if none */
+    size_t index_have;      /* number of entries in index */
+    size_t index_size;      /* number of entries allocated */
         /* just for reading */
-    int how;                /* 0: get header, 1: copy, 2: decompress */
-    z_off64_t start;        /* where the gzip data started, for rewinding */
+    int how;                /* 0: get header, 1: copy, 2: decompress, 3: BGZF */
+    z_off64_t start;        /* where the gzip data started, for rewinding (and for the index with "S") */
     int eof;                /* true if end of input file reached */
     int past;               /* true if read requested past end */
+    unsigned threads;       /* threads to decode with, 0 for one per processor */
+    struct gz_ahead_s *ahead; /* read-ahead state, NULL if not opened with "A" */
+    gz_map *map;            /* mapped input file or memory, NULL if neither */
+    unsigned char *line;    /* gzgetline_view() line split across output buffers */
+    size_t line_size;       /* allocated size of line */
+    int index_look;         /* true to look for the index of a seekable file at the next seek */
         /* just for writing */
     int level;              /* compression level */
     int strategy;           /* compression strategy */
     int reset;              /* true if a reset is pending after a Z_FINISH */
+    int rsyncable;          /* true for content-defined flush points with "y" */
+    int cont;               /* true to continue the last gzip stream with "c", which then writes raw
+                               deflate data with the gzip header and trailer written here */
+    uint32_t check;         /* CRC-32 of the data of the current gzip stream, with "c" */
+    uint32_t isize;         /* length of that data modulo 2^32, with "c" */
+    z_off64_t span;         /* uncompressed data per gzip stream with "S", 0 if not seekable */
+    z_off64_t span_left;    /* uncompressed data left to the end of the current stream */
+    z_off64_t coff;         /* file offset of the next compressed data */
+    gz_mem *mem;            /* memory written to, NULL if writing to a file */
         /* seek request */
     z_off64_t skip;         /* amount to skip (already rewound if backwards) */
     int seek;               /* true if seek request pending */
@@ -133,8 +282,50 @@ typedef struct {
 } gz_state;
 typedef gz_state *gz_statep;
 
+/* read-ahead state -- the thread reads with its own gz_state, which shares the
+   file descriptor, and the data it returns is handed to the application in
+   place from the buffers */
+typedef struct gz_ahead_s {
+    gz_state *inner;        /* state that reads the file, NULL if not set up yet */
+    unsigned char *buf[GZ_AHEAD_SLOTS]; /* ring of buffers of data */
+    unsigned size;          /* size of each buffer */
+    zthread thread;         /* the read-ahead thread */
+    int started;            /* true if the thread is running */
+    int alone;              /* true if the thread could not be started */
+    int held;               /* true if state->x.next is in buffer next */
+    int seen;               /* true if the end of the data was returned */
+        /* shared with the thread, protected by lock */
+    zthread_mutex lock;
+    zthread_cond ready;     /* signaled when a buffer is filled or the end is reached */
+    zthread_cond room;      /* signaled when a buffer is freed, to go on after the end, or to stop */
+    unsigned have[GZ_AHEAD_SLOTS]; /* amount of data in each buffer */
+    unsigned next;          /* next buffer to hand out */
+    unsigned count;         /* buffers filled, including a held one */
+    int end;                /* true if the end of the data or an error was reached */
+    int stop;               /* true to end the thread */
+} gz_ahead;
+
 /* shared functions */
 void Z_INTERNAL gz_error(gz_state *, int, const char *);
+void Z_INTERNAL gz_bgzf_free(gz_state *);
+z_off64_t Z_INTERNAL gz_bgzf_tell_r(gz_state *);
+z_off64_t Z_INTERNAL gz_bgzf_tell_w(gz_state *);
+void Z_INTERNAL gz_ahead_stop(gz_state *);
+z_off64_t Z_INTERNAL gz_lseek(gz_state *, z_off64_t, int);
+void Z_INTERNAL gz_map_free(gz_state *);
+uint64_t Z_INTERNAL gz_get64(const unsigned char *);
+int Z_INTERNAL gz_read_at(gz_state *, unsigned char *, size_t, z_off64_t);
+int Z_INTERNAL gz_index_find(gz_state *);
+#ifdef HAVE_IO_URING
+void Z_INTERNAL gz_uring_open(gz_state *);
+void Z_INTERNAL gz_uring_start(gz_state *);
+int Z_INTERNAL gz_uring_read(gz_state *, unsigned char *, unsigned, unsigned *);
+int Z_INTERNAL gz_uring_write(gz_state *, const unsigned char *, unsigned);
+int Z_INTERNAL gz_uring_next(gz_state *);
+int Z_INTERNAL gz_uring_drain(gz_state *);
+void Z_INTERNAL gz_uring_free(gz_state *);
+z_off64_t Z_INTERNAL gz_uring_seek(gz_state *, z_off64_t, int);
+#endif
 #ifdef ZLIB_COMPAT
 unsigned Z_INTERNAL gz_intmax(void);
 #endif
@@ -7,20 +7,20 @@
 #include "zutil_p.h"
 #include "gzguts.h"
 
-#if defined(_WIN32)
-#  define LSEEK _lseeki64
-#else
-#if defined(_LARGEFILE64_SOURCE) && _LFS64_LARGEFILE-0
-#  define LSEEK lseek64
-#else
-#  define LSEEK lseek
-#endif
+#ifdef HAVE_MMAP
+#  include <sys/mman.h>
+#  include <sys/stat.h>
 #endif
 
 /* Local functions */
 static void gz_reset(gz_state *);
+static void gz_map_open(gz_state *);
 static gzFile gz_open(const void *, int, const char *);
 
+/* gz_open() fd values to read from or write to memory instead of a file */
+#define GZ_MEM_READ -3
+#define GZ_MEM_WRITE -4
+
 /* Reset gzip file state */
 static void gz_reset(gz_state *state) {
     state->x.have = 0;              /* no output data available */
@@ -28,6 +28,8 @@ static void gz_reset(gz_state *state) {
         state->eof = 0;             /* not at end of file */
         state->past = 0;            /* have not read past end yet */
         state->how = LOOK;          /* look for gzip header */
+        if (state->ahead != NULL && state->ahead->inner != NULL)
+            gz_reset(state->ahead->inner);  /* and the same for the read-ahead */
     }
     else                            /* for writing ... */
         state->reset = 0;           /* no deflateReset pending */
@@ -37,11 +39,52 @@ static void gz_reset(gz_state *state) {
     state->strm.avail_in = 0;       /* no input data yet */
 }
 
+/* Map the input file into memory, if it is a regular file that can be mapped,
+   so that reading takes the input straight from the mapping instead. */
+static void gz_map_open(gz_state *state) {
+#ifdef HAVE_MMAP
+    struct stat st;
+    gz_map *map;
+    void *data;
+
+    if (fstat(state->fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (uint64_t)st.st_size > SIZE_MAX)
+        return;
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, state->fd, 0);
+    if (data == MAP_FAILED)
+        return;
+#  if defined(POSIX_MADV_SEQUENTIAL)
+    posix_madvise(data, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+#  elif defined(MADV_SEQUENTIAL)
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+#  endif
+    map = (gz_map *)zng_alloc(sizeof(gz_map));
+    if (map == NULL) {
+        munmap(data, (size_t)st.st_size);
+        return;
+    }
+    map->data = (const unsigned char *)data;
+    map->size = (z_off64_t)st.st_size;
+    map->pos = state->start;
+    map->mapped = 1;
+    state->map = map;
+#else
+    Z_UNUSED(state);
+#endif
+}
+
 /* Open a gzip file either by name or file descriptor. */
 static gzFile gz_open(const void *path, int fd, const char *mode) {
     gz_state *state;
     size_t len;
     int oflag;
+    int bgzf = 0;
+    int scan = 0;
+    int ahead = 0;
+    int mapped = 0;
+    int uring = 0;
+    int seekable = 0;
+    int cont = 0;
 #ifdef O_CLOEXEC
     int cloexec = 0;
 #endif
@@ -65,6 +108,7 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
     state->mode = GZ_NONE;
     state->level = Z_DEFAULT_COMPRESSION;
     state->strategy = Z_DEFAULT_STRATEGY;
+    state->rsyncable = 0;
     state->direct = 0;
     while (*mode) {
         if (*mode >= '0' && *mode <= '9') {
@@ -112,6 +156,30 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
             case 'T':
                 state->direct = 1;
                 break;
+            case 'B':
+                bgzf = 1;
+                break;
+            case 'P':
+                scan = 1;
+                break;
+            case 'A':
+                ahead = 1;
+                break;
+            case 'm':
+                mapped = 1;
+                break;
+            case 'u':
+                uring = 1;
+                break;
+            case 'S':
+                seekable = 1;
+                break;
+            case 'y':
+                state->rsyncable = 1;
+                break;
+            case 'c':
+                cont = 1;
+                break;
             default:        /* could consider as an error, but just ignore */
                 {}
             }
@@ -119,8 +187,9 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
         mode++;
     }
 
-    /* must provide an "r", "w", or "a" */
-    if (state->mode == GZ_NONE) {
+    /* must provide an "r", "w", or "a", and the one that goes with memory */
+    if (state->mode == GZ_NONE || (fd == GZ_MEM_READ && state->mode != GZ_READ) ||
+        (fd == GZ_MEM_WRITE && state->mode == GZ_READ)) {
         zng_free(state);
         return NULL;
     }
@@ -134,6 +203,50 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
         state->direct = 1;      /* for empty file */
     }
 
+    /* allocate BGZF and read-ahead state if requested (BGZF is not used when
+       writing transparently, and "P" and "A" only apply to reading) */
+    state->bgzf = NULL;
+    state->ahead = NULL;
+    state->map = NULL;
+    state->uring = NULL;
+    state->line = NULL;
+    state->line_size = 0;
+    state->threads = 0;
+    state->index = NULL;
+    state->index_have = state->index_size = 0;
+    state->mem = NULL;
+    if (state->mode != GZ_READ)
+        scan = ahead = 0;
+    if ((bgzf && (state->mode == GZ_READ || !state->direct)) || scan) {
+        state->bgzf = (gz_bgzf *)zng_alloc(sizeof(gz_bgzf));
+        if (state->bgzf == NULL) {
+            zng_free(state);
+            return NULL;
+        }
+        memset(state->bgzf, 0, sizeof(gz_bgzf));
+        state->bgzf->scan = scan;
+    }
+    if (ahead) {
+        state->ahead = (gz_ahead *)zng_alloc(sizeof(gz_ahead));
+        if (state->ahead == NULL) {
+            zng_free(state->bgzf);
+            zng_free(state);
+            return NULL;
+        }
+        memset(state->ahead, 0, sizeof(gz_ahead));
+    }
+
+    /* a seekable file is written as gzip streams of span bytes each (not with
+       "T" or "B"), and when reading, an index at the end is looked for at the
+       first seek (not with "A", where another thread reads the file) */
+    state->span = seekable && state->mode != GZ_READ && !state->direct && state->bgzf == NULL ? GZ_SPAN : 0;
+    state->span_left = state->span;
+    state->index_look = state->mode == GZ_READ && state->ahead == NULL;
+
+    /* the last gzip stream is continued when appending with "c", but not with
+       "T", "B", or "S", which end the file in their own ways */
+    state->cont = cont && state->mode == GZ_APPEND && !state->direct && state->bgzf == NULL && !state->span;
+
     /* save the path name for error messages */
 #ifdef WIDECHAR
     if (fd == -2) {
@@ -145,6 +258,8 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
         len = strlen((const char *)path);
     state->path = (char *)malloc(len + 1);
     if (state->path == NULL) {
+        zng_free(state->ahead);
+        zng_free(state->bgzf);
         zng_free(state);
         return NULL;
     }
@@ -172,38 +287,56 @@ static gzFile gz_open(const void *path, int fd, const char *mode) {
 #endif
         (state->mode == GZ_READ ?
          O_RDONLY :
-         (O_WRONLY | O_CREAT |
+         ((state->cont ? O_RDWR : O_WRONLY) | O_CREAT |
 #ifdef O_EXCL
           (exclusive ? O_EXCL : 0) |
 #endif
           (state->mode == GZ_WRITE ?
            O_TRUNC :
-           O_APPEND)));
+           state->cont ? 0 : O_APPEND)));
 
-    /* open the file with the appropriate flags (or just use fd) */
-    state->fd = fd > -1 ? fd : (
+    /* open the file with the appropriate flags (or just use fd, or no file at
+       all for memory) */
+    state->fd = fd > -1 ? fd : fd < -2 ? -1 : (
 #if defined(_WIN32)
         fd == -2 ? _wopen((const wchar_t *)path, oflag, 0666) :
 #elif __CYGWIN__
         fd == -2 ? open(state->path, oflag, 0666) :
 #endif
         open((const char *)path, oflag, 0666));
-    if (state->fd == -1) {
+    if (state->fd == -1 && fd > -3) {
         free(state->path);
+        zng_free(state->ahead);
+        zng_free(state->bgzf);
         zng_free(state);
         return NULL;
     }
     if (state->mode == GZ_APPEND) {
-        LSEEK(state->fd, 0, SEEK_END);  /* so gzoffset() is correct */
+        if (state->fd != -1)
+            LSEEK(state->fd, 0, SEEK_END);  /* so gzoffset() is correct */
         state->mode = GZ_WRITE;         /* simplify later checks */
     }
 
-    /* save the current position for rewinding (only if reading) */
+    /* save the current position for rewinding (only if reading), and map the
+       file if requested */
     if (state->mode == GZ_READ) {
-        state->start = LSEEK(state->fd, 0, SEEK_CUR);
+        state->start = state->fd == -1 ? 0 : LSEEK(state->fd, 0, SEEK_CUR);
         if (state->start == -1) state->start = 0;
+        if (mapped && state->fd != -1)
+            gz_map_open(state);
     }
 
+    /* queue reads or writes with io_uring if requested, unless the file is
+       mapped or memory, or is written without compressing, as BGZF, or by
+       continuing the last gzip stream */
+#ifdef HAVE_IO_URING
+    if (uring && state->fd != -1 && state->map == NULL &&
+        (state->mode == GZ_READ || (!state->direct && state->bgzf == NULL && !state->cont)))
+        gz_uring_open(state);
+#else
+    Z_UNUSED(uring);
+#endif
+
     /* initialize stream */
     gz_reset(state);
 
@@ -242,6 +375,62 @@ gzFile Z_EXPORT PREFIX(gzopen_w)(const wchar_t *path, const char *mode) {
 }
 #endif
 
+#ifndef ZLIB_COMPAT
+/* -- see zlib-ng.h -- */
+gzFile Z_EXPORT PREFIX(gzopen_mem)(const void *buf, size_t len, const char *mode) {
+    gz_state *state;
+    gz_map *map;
+
+    /* read from buf in place, as from a mapped file */
+    if (buf == NULL && len != 0)
+        return NULL;
+    map = (gz_map *)zng_alloc(sizeof(gz_map));
+    if (map == NULL)
+        return NULL;
+    state = (gz_state *)gz_open("<mem>", GZ_MEM_READ, mode);
+    if (state == NULL) {
+        zng_free(map);
+        return NULL;
+    }
+    map->data = (const unsigned char *)buf;
+    map->size = (z_off64_t)len;
+    map->pos = 0;
+    map->mapped = 0;
+    state->map = map;
+    return (gzFile)state;
+}
+
+/* -- see zlib-ng.h -- */
+gzFile Z_EXPORT PREFIX(gzopen_memstream)(void **buf, size_t *len, const char *mode) {
+    gz_state *state;
+    gz_mem *mem;
+
+    /* append to what is at *buf with "a", or start over */
+    if (buf == NULL || len == NULL)
+        return NULL;
+    mem = (gz_mem *)zng_alloc(sizeof(gz_mem));
+    if (mem == NULL)
+        return NULL;
+    state = (gz_state *)gz_open("<mem>", GZ_MEM_WRITE, mode);
+    if (state == NULL) {
+        zng_free(mem);
+        return NULL;
+    }
+    mem->data = NULL;
+    mem->len = mem->size = 0;
+    if (strchr(mode, 'a') != NULL && *buf != NULL) {
+        mem->data = (unsigned char *)*buf;
+        mem->len = mem->size = *len;
+    }
+    mem->buf = buf;
+    mem->buf_len = len;
+    *buf = mem->data;
+    *len = mem->len;
+    state->mem = mem;
+    return (gzFile)state;
+}
+#endif
+
 int Z_EXPORT PREFIX(gzclose)(gzFile file) {
 #ifndef NO_GZCOMPRESS
     gz_state *state;
@@ -293,8 +482,10 @@ int Z_EXPORT PREFIX(gzrewind)(gzFile file) {
     if (state->mode != GZ_READ || (state->err != Z_OK && state->err != Z_BUF_ERROR))
         return -1;
 
-    /* back up and start over */
-    if (LSEEK(state->fd, state->start, SEEK_SET) == -1)
+    /* back up and start over, after stopping any read-ahead */
+    if (state->ahead != NULL)
+        gz_ahead_stop(state);
+    if (gz_lseek(state, state->start, SEEK_SET) == -1)
         return -1;
     gz_reset(state);
     return 0;
@@ -330,7 +521,7 @@ z_off64_t Z_EXPORT PREFIX4(gzseek)(gzFile file, z_off64_t offset, int whence) {
 
     /* if within raw area while reading, just go there */
     if (state->mode == GZ_READ && state->how == COPY && state->x.pos + offset >= 0) {
-        ret = LSEEK(state->fd, offset - (z_off64_t)state->x.have, SEEK_CUR);
+        ret = gz_lseek(state, offset - (z_off64_t)state->x.have, SEEK_CUR);
         if (ret == -1)
             return -1;
         state->x.have = 0;
@@ -420,7 +611,7 @@ z_off64_t Z_EXPORT PREFIX4(gzoffset)(gzFile file) {
         return -1;
 
     /* compute and return effective offset in file */
-    offset = LSEEK(state->fd, 0, SEEK_CUR);
+    offset = gz_lseek(state, 0, SEEK_CUR);
     if (offset == -1)
         return -1;
     if (state->mode == GZ_READ)             /* reading */
@@ -489,6 +680,414 @@ void Z_EXPORT PREFIX(gzclearerr)(gzFile file) {
     gz_error(state, Z_OK, NULL);
 }
 
+/* Read len bytes from fd to buf. Return 0 on success, -1 on error or if the
+   end of the file was reached first. */
+static int gz_read_all(int fd, unsigned char *buf, unsigned len) {
+    ssize_t ret;
+
+    while (len) {
+        ret = read(fd, buf, len);
+        if (ret <= 0)
+            return -1;
+        buf += ret;
+        len -= (unsigned)ret;
+    }
+    return 0;
+}
+
+/* Get a little-endian 64-bit integer from buf */
+uint64_t Z_INTERNAL gz_get64(const unsigned char *buf) {
+    uint64_t val = 0;
+    int n;
+
+    for (n = 7; n >= 0; n--)
+        val = (val << 8) | buf[n];
+    return val;
+}
+
+#ifndef ZLIB_COMPAT
+/* -- see zlib-ng.h -- */
+int32_t Z_EXPORT PREFIX(gzthreads)(gzFile file, uint32_t threads) {
+    gz_state *state;
+
+    /* get internal structure and check integrity */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+    if (state->mode != GZ_READ && state->mode != GZ_WRITE)
+        return -1;
+
+    /* make sure the threads have not been started yet */
+    if ((state->bgzf != NULL && state->bgzf->workers != 0) ||
+        (state->ahead != NULL && state->ahead->inner != NULL))
+        return -1;
+    state->threads = threads;
+    return 0;
+}
+
+/* Load a .gzi index from path: the number of entries as a little-endian 64-bit
+   integer, followed by the compressed and uncompressed offsets of each member
+   but the first, in the same format. Return 0 on success, -1 on failure. */
+static int gz_bgzf_load(gz_state *state, const char *path) {
+    gz_bgzf *bgzf = state->bgzf;
+    gz_bgzf_entry *index;
+    unsigned char buf[256 * 16];
+    uint64_t count, have, n, i;
+    int fd;
+
+    fd = open(path,
+#ifdef O_BINARY
+              O_BINARY |
+#endif
+              O_RDONLY);
+    if (fd == -1)
+        return -1;
+
+    /* get the number of entries and allocate space for them */
+    index = NULL;
+    if (gz_read_all(fd, buf, 8) == -1)
+        goto bad;
+    count = gz_get64(buf);
+    if (count > SIZE_MAX / sizeof(gz_bgzf_entry) - 1)
+        goto bad;
+    index = (gz_bgzf_entry *)zng_alloc((size_t)(count + 1) * sizeof(gz_bgzf_entry));
+    if (index == NULL)
+        goto bad;
+
+    /* read the entries, which must be in order */
+    for (have = 0; have < count; have += n) {
+        n = count - have < 256 ? count - have : 256;
+        if (gz_read_all(fd, buf, (unsigned)n * 16) == -1)
+            goto bad;
+        for (i = 0; i < n; i++) {
+            index[have + i].coff = gz_get64(buf + i * 16);
+            index[have + i].uoff = gz_get64(buf + i * 16 + 8);
+            if (have + i != 0 && (index[have + i].coff <= index[have + i - 1].coff ||
+                                  index[have + i].uoff < index[have + i - 1].uoff))
+                goto bad;
+        }
+    }
+    close(fd);
+
+    /* replace any previous index */
+    zng_free(bgzf->index);
+    bgzf->index = index;
+    bgzf->index_have = bgzf->index_size = (size_t)count;
+    return 0;
+
+  bad:
+    zng_free(index);
+    close(fd);
+    return -1;
+}
+
+/* -- see zlib-ng.h -- */
+int32_t Z_EXPORT PREFIX(gzbgzf_index)(gzFile file, const char *path) {
+    gz_state *state;
+    gz_bgzf *bgzf;
+    size_t len;
+
+    /* get internal structure and check integrity */
+    if (file == NULL || path == NULL)
+        return -1;
+    state = (gz_state *)file;
+    if (state->mode != GZ_READ && state->mode != GZ_WRITE)
+        return -1;
+    bgzf = state->bgzf;
+    if (bgzf == NULL)
+        return -1;
+
+    /* when reading, load the index now */
+    if (state->mode == GZ_READ)
+        return gz_bgzf_load(state, path);
+
+    /* when writing, the index has to cover every member, so nothing can have
+       been written yet -- save the path for gzclose() */
+    if (state->x.pos != 0 || state->seek || bgzf->index_path != NULL)
+        return -1;
+    len = strlen(path);
+    bgzf->index_path = (char *)malloc(len + 1);
+    if (bgzf->index_path == NULL)
+        return -1;
+    memcpy(bgzf->index_path, path, len + 1);
+    return 0;
+}
+
+/* -- see zlib-ng.h -- */
+z_off64_t Z_EXPORT PREFIX(gzbgzf_tell)(gzFile file) {
+    gz_state *state;
+
+    /* get internal structure and check integrity */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+    if ((state->mode != GZ_READ && state->mode != GZ_WRITE) || state->bgzf == NULL)
+        return -1;
+
+#ifndef NO_GZCOMPRESS
+    return state->mode == GZ_READ ? gz_bgzf_tell_r(state) : gz_bgzf_tell_w(state);
+#else
+    return gz_bgzf_tell_r(state);
+#endif
+}
+
+/* -- see zlib-ng.h -- */
+int32_t Z_EXPORT PREFIX(gzbgzf_seek)(gzFile file, z_off64_t voffset) {
+    gz_state *state;
+    gz_bgzf *bgzf;
+    uint64_t coff;
+    z_off64_t pos;
+    size_t lo, hi, mid;
+
+    /* get internal structure and check integrity */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+    bgzf = state->bgzf;
+    if (state->mode != GZ_READ || bgzf == NULL || voffset < 0)
+        return -1;
+
+    /* check that there's no error */
+    if (state->err != Z_OK && state->err != Z_BUF_ERROR)
+        return -1;
+
+    /* the position in the uncompressed data is only known with an index -- it
+       has to start a member there, or be before the first member it lists */
+    coff = (uint64_t)voffset >> 16;
+    pos = 0;
+    if (bgzf->index_have && coff >= bgzf->index[0].coff) {
+        lo = 0;
+        hi = bgzf->index_have;
+        while (lo < hi) {
+            mid = lo + ((hi - lo) >> 1);
+            if (bgzf->index[mid].coff < coff)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == bgzf->index_have || bgzf->index[lo].coff != coff)
+            return -1;
+        pos = (z_off64_t)bgzf->index[lo].uoff;
+    }
+
+    /* go to the member, then skip to the offset within it */
+    if (gz_lseek(state, (z_off64_t)coff, SEEK_SET) == -1)
+        return -1;
+    gz_reset(state);
+    state->x.pos = pos;
+    if (voffset & 0xffff) {
+        state->seek = 1;
+        state->skip = voffset & 0xffff;
+    }
+    return 0;
+}
+#endif
+
+#ifndef ZLIB_COMPAT
+/* -- see zlib-ng.h -- */
+int32_t Z_EXPORT PREFIX(gzseekable)(gzFile file, uint32_t span) {
+    gz_state *state;
+
+    /* get internal structure and check integrity */
+    if (file == NULL)
+        return -1;
+    state = (gz_state *)file;
+    if (state->mode != GZ_WRITE || state->direct || state->bgzf != NULL)
+        return -1;
+
+    /* the index has to cover the file from the start, so nothing can have
+       been written yet */
+    if (state->x.pos != 0 || state->seek)
+        return -1;
+    state->span = span;
+    state->span_left = span;
+    return 0;
+}
+#endif
+
+/* Read len bytes at offset off in the file to buf, and go back to where the
+   file was.  Return 0 on success, 1 if there aren't len bytes there, or -1 if
+   the file position could not be restored. */
+int Z_INTERNAL gz_read_at(gz_state *state, unsigned char *buf, size_t len, z_off64_t off) {
+    gz_map *map = state->map;
+    z_off64_t here;
+    unsigned n;
+    int ret = 0;
+
+    /* a mapped file is just there */
+    if (map != NULL) {
+        if (off < 0 || off > map->size || (uint64_t)(map->size - off) < len)
+            return 1;
+        memcpy(buf, map->data + off, len);
+        return 0;
+    }
+
+    here = LSEEK(state->fd, 0, SEEK_CUR);
+    if (here == -1)
+        return 1;
+    if (LSEEK(state->fd, off, SEEK_SET) == -1)
+        ret = 1;
+    while (ret == 0 && len) {
+        n = len > (1U << 30) ? 1U << 30 : (unsigned)len;
+        ret = gz_read_all(state->fd, buf, n) == -1;
+        buf += n;
+        len -= n;
+    }
+    if (LSEEK(state->fd, here, SEEK_SET) == -1) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    return ret;
+}
+
+/* Look for the index that "S" appends to the end of a seekable file, and use
+   it to seek from now on if it is there and was written starting where the
+   data is read from.  Anything that doesn't look like a valid index is
+   ignored.  Return -1 on error, otherwise 0. */
+int Z_INTERNAL gz_index_find(gz_state *state) {
+    unsigned char tail[GZ_INDEX_TAIL], *buf, *next, *end, *field;
+    gz_bgzf_entry *index;
+    z_off64_t here, size;
+    uint64_t total;
+    size_t have, i;
+    unsigned xlen, len;
+    int ret;
+
+    /* only look once */
+    state->index_look = 0;
+
+    /* find the end of the file, and get the locator there */
+    if (state->map != NULL)
+        size = state->map->size;
+    else {
+        here = LSEEK(state->fd, 0, SEEK_CUR);
+        if (here == -1)
+            return 0;
+        size = LSEEK(state->fd, 0, SEEK_END);
+        if (LSEEK(state->fd, here, SEEK_SET) == -1) {
+            gz_error(state, Z_ERRNO, zstrerror());
+            return -1;
+        }
+    }
+    if (size - state->start < GZ_INDEX_TAIL)
+        return 0;
+    ret = gz_read_at(state, tail, GZ_INDEX_TAIL, size - GZ_INDEX_TAIL);
+    if (ret)
+        return ret == -1 ? -1 : 0;
+    if (tail[0] != 'Z' || tail[1] != 'X' || tail[2] != 16 || tail[3] != 0 || tail[20] != 3 || tail[21] != 0 ||
+        gz_get64(tail + 22) != 0)
+        return 0;
+    total = gz_get64(tail + 4);
+    if (gz_get64(tail + 12) != (uint64_t)state->start || total < 12 + GZ_INDEX_TAIL ||
+        total > (uint64_t)(size - state->start) || total > SIZE_MAX)
+        return 0;
+
+    /* get all of the index streams, with room for as many entries as there
+       could be */
+    buf = (unsigned char *)zng_alloc((size_t)total);
+    index = (gz_bgzf_entry *)zng_alloc((size_t)(total >> 4) * sizeof(gz_bgzf_entry));
+    if (buf == NULL || index == NULL ||
+        (ret = gz_read_at(state, buf, (size_t)total, size - (z_off64_t)total)) != 0) {
+        zng_free(index);
+        zng_free(buf);
+        return ret == -1 ? -1 : 0;
+    }
+
+    /* each is an empty gzip stream with the entries in "ZI" subfields of the
+       extra field, and the entries have to go up, and be in the data before
+       the index */
+    have = 0;
+    next = buf;
+    end = buf + total;
+    while (next < end) {
+        if (end - next < 12 || next[0] != 31 || next[1] != 139 || next[2] != 8 || next[3] != 4)
+            break;
+        xlen = next[10] | ((unsigned)next[11] << 8);
+        if ((size_t)(end - next) < 12 + (size_t)xlen + 10)
+            break;
+        field = next + 12;
+        next = field + xlen;
+        while (next - field >= 4) {
+            len = field[2] | ((unsigned)field[3] << 8);
+            if ((size_t)(next - field) - 4 < len)
+                break;
+            if (field[0] == 'Z' && field[1] == 'I' && (len & 15) == 0)
+                for (i = 0; i < len; i += 16, have++) {
+                    index[have].coff = gz_get64(field + 4 + i);
+                    index[have].uoff = gz_get64(field + 4 + i + 8);
+                }
+            field += 4 + len;
+        }
+        if (field != next || next[0] != 3 || next[1] != 0 || gz_get64(next + 2) != 0)
+            break;
+        next += 10;
+    }
+    zng_free(buf);
+    for (i = 0; next == end && i < have; i++)
+        if (index[i].coff <= (uint64_t)state->start || index[i].coff >= (uint64_t)size - total ||
+            index[i].uoff == 0 || (i && (index[i].coff <= index[i - 1].coff || index[i].uoff <= index[i - 1].uoff)))
+            break;
+    if (next != end || i != have || have == 0) {
+        zng_free(index);
+        return 0;
+    }
+    zng_free(state->index);
+    state->index = index;
+    state->index_have = state->index_size = have;
+    return 0;
+}
+
+/* Free the BGZF state that is common to reading and writing */
+void Z_INTERNAL gz_bgzf_free(gz_state *state) {
+    gz_bgzf *bgzf = state->bgzf;
+
+    if (bgzf == NULL)
+        return;
+    zng_free(bgzf->index);
+    free(bgzf->index_path);
+    zng_free(bgzf->block);
+    zng_free(bgzf);
+    state->bgzf = NULL;
+}
+
+/* Like LSEEK() on the file descriptor of state, but on the position in the
+   mapping instead when the input file is mapped, or on the position that
+   io_uring has read or written to */
+z_off64_t Z_INTERNAL gz_lseek(gz_state *state, z_off64_t offset, int whence) {
+    gz_map *map = state->map;
+
+#ifdef HAVE_IO_URING
+    if (state->uring != NULL)
+        return gz_uring_seek(state, offset, whence);
+#endif
+    if (state->mem != NULL)
+        return offset == 0 && whence != SEEK_SET ? (z_off64_t)state->mem->len : -1;
+    if (map == NULL)
+        return LSEEK(state->fd, offset, whence);
+    if (whence == SEEK_CUR)
+        offset += map->pos;
+    else if (whence == SEEK_END)
+        offset += map->size;
+    if (offset < 0)
+        return -1;
+    map->pos = offset;
+    return offset;
+}
+
+/* Unmap the input file, or let go of the memory read from */
+void Z_INTERNAL gz_map_free(gz_state *state) {
+    gz_map *map = state->map;
+
+    if (map == NULL)
+        return;
+#ifdef HAVE_MMAP
+    if (map->mapped)
+        munmap((void *)map->data, (size_t)map->size);
+#endif
+    zng_free(map);
+    state->map = NULL;
+}
+
 /* Create an error message in allocated memory and set state->err and
    state->msg accordingly.  Free any previous error message already there.  Do
    not try to free or allocate space if the error is Z_MEM_ERROR (out of
@@ -0,0 +1,377 @@
+/* gzuring.c -- io_uring reads and writes for gzip files opened with "u"
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifdef HAVE_IO_URING
+#  define _DEFAULT_SOURCE 1 /* syscall, MAP_POPULATE */
+#endif
+#include "zbuild.h"
+#include "zutil_p.h"
+#include "gzguts.h"
+
+#ifdef HAVE_IO_URING
+#  include <errno.h>
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+
+/* With "u", reads or writes are queued with io_uring to a ring of this many
+   buffers, so that some are in flight while the data of the others is being
+   compressed or decompressed */
+#define GZ_URING_SLOTS 3
+#define GZ_URING_ENTRIES 8      /* submission queue size, the most in flight */
+
+/* io_uring state -- when writing, the buffers take turns as the output buffer,
+   and a filled one is written while deflate goes on in the next. When
+   reading, the empty buffers are kept queued to be read in order, and
+   gz_load() copies from the filled ones. */
+typedef struct gz_uring_s {
+    int fd;                 /* io_uring file descriptor */
+    void *ring;             /* submission and completion queue rings */
+    size_t ring_size;
+    struct io_uring_sqe *sqes;  /* submission queue entries */
+    size_t sqes_size;
+    unsigned *sq_tail, *sq_array, sq_mask;
+    unsigned *cq_head, *cq_tail, cq_mask;
+    struct io_uring_cqe *cqes;
+    int fixed;              /* true if the buffers are registered with the kernel */
+    int stream;             /* true to go in order at the file position, one at a time */
+    z_off64_t off;          /* file offset of the next read or write to queue */
+    z_off64_t pos;          /* file offset as read() or write() would have left it */
+    unsigned size;          /* size of each buffer, zero if not allocated yet */
+    unsigned char *buf[GZ_URING_SLOTS];
+    unsigned pending[GZ_URING_SLOTS];   /* reads or writes in flight from each buffer */
+    int full[GZ_URING_SLOTS];           /* reading: true if got has the result of a read */
+    int got[GZ_URING_SLOTS];            /* reading: bytes read, or minus errno */
+    unsigned used[GZ_URING_SLOTS];      /* reading: bytes of got already copied out */
+    unsigned next;          /* buffer to copy from next, or being written to */
+    unsigned busy;          /* reads or writes in flight */
+    int err;                /* writing: errno of the first write that failed, or zero */
+} gz_uring;
+
+/* Set up io_uring for the file of state if possible, otherwise leave it to
+   read() or write(). Kernels before 5.6 don't have the reads and writes at the
+   file position needed for pipes, and aren't used. */
+void Z_INTERNAL gz_uring_open(gz_state *state) {
+    struct io_uring_params p;
+    size_t sq_size, cq_size;
+    gz_uring *u;
+    int fd;
+
+    memset(&p, 0, sizeof(p));
+    fd = (int)syscall(__NR_io_uring_setup, GZ_URING_ENTRIES, &p);
+    if (fd < 0)
+        return;
+    u = (gz_uring *)zng_alloc(sizeof(gz_uring));
+    if (u == NULL || (p.features & IORING_FEAT_SINGLE_MMAP) == 0 || (p.features & IORING_FEAT_RW_CUR_POS) == 0) {
+        zng_free(u);
+        close(fd);
+        return;
+    }
+    memset(u, 0, sizeof(gz_uring));
+    sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    u->ring_size = sq_size > cq_size ? sq_size : cq_size;
+    u->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    u->ring = mmap(NULL, u->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    u->sqes = (struct io_uring_sqe *)mmap(NULL, u->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                          fd, IORING_OFF_SQES);
+    if (u->ring == MAP_FAILED || u->sqes == MAP_FAILED) {
+        if (u->ring != MAP_FAILED)
+            munmap(u->ring, u->ring_size);
+        if (u->sqes != MAP_FAILED)
+            munmap(u->sqes, u->sqes_size);
+        zng_free(u);
+        close(fd);
+        return;
+    }
+    u->fd = fd;
+    u->sq_tail = (unsigned *)((char *)u->ring + p.sq_off.tail);
+    u->sq_array = (unsigned *)((char *)u->ring + p.sq_off.array);
+    u->sq_mask = *(unsigned *)((char *)u->ring + p.sq_off.ring_mask);
+    u->cq_head = (unsigned *)((char *)u->ring + p.cq_off.head);
+    u->cq_tail = (unsigned *)((char *)u->ring + p.cq_off.tail);
+    u->cq_mask = *(unsigned *)((char *)u->ring + p.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe *)((char *)u->ring + p.cq_off.cqes);
+
+    /* pipes, and appending, can only go in order at the file position */
+    u->pos = u->off = LSEEK(state->fd, 0, SEEK_CUR);
+    u->stream = u->off == -1 || (state->mode == GZ_WRITE && (fcntl(state->fd, F_GETFL) & O_APPEND) != 0);
+    state->uring = u;
+}
+
+/* Allocate the buffers now that the buffer size is known, taking the output
+   buffer as the first one when writing, and register them with the kernel if
+   allowed. If they can't be allocated, go back to read() or write(). */
+void Z_INTERNAL gz_uring_start(gz_state *state) {
+    gz_uring *u = state->uring;
+    struct iovec iov[GZ_URING_SLOTS];
+    unsigned i;
+
+    for (i = 0; i < GZ_URING_SLOTS; i++) {
+        u->buf[i] = i == 0 && state->mode == GZ_WRITE ? state->out : (unsigned char *)zng_alloc(state->size);
+        if (u->buf[i] == NULL) {
+            gz_uring_free(state);
+            return;
+        }
+        iov[i].iov_base = u->buf[i];
+        iov[i].iov_len = state->size;
+    }
+    u->size = state->size;
+    u->fixed = syscall(__NR_io_uring_register, u->fd, IORING_REGISTER_BUFFERS, iov, GZ_URING_SLOTS) == 0;
+}
+
+/* Queue a read or write of len bytes at buf, which is in buffer slot, at file
+   offset off. Return -1 with errno set if it couldn't be queued. */
+static int gz_uring_queue(gz_state *state, unsigned slot, const unsigned char *buf, unsigned len, z_off64_t off) {
+    gz_uring *u = state->uring;
+    unsigned tail = *u->sq_tail;
+    struct io_uring_sqe *sqe = &u->sqes[tail & u->sq_mask];
+    int writing = state->mode == GZ_WRITE;
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    if (u->fixed) {
+        sqe->opcode = writing ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+        sqe->buf_index = (uint16_t)slot;
+    } else
+        sqe->opcode = writing ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = state->fd;
+    sqe->off = u->stream ? (uint64_t)-1 : (uint64_t)off;
+    sqe->addr = (uint64_t)(uintptr_t)buf;
+    sqe->len = len;
+    sqe->user_data = slot | (uint64_t)len << 32;
+    u->sq_array[tail & u->sq_mask] = tail & u->sq_mask;
+    __atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    if (syscall(__NR_io_uring_enter, u->fd, 1, 0, 0, NULL, 0) != 1) {
+        /* not taken by the kernel, so take it back */
+        __atomic_store_n(u->sq_tail, tail, __ATOMIC_RELEASE);
+        return -1;
+    }
+    u->pending[slot]++;
+    u->busy++;
+    return 0;
+}
+
+/* Wait for at least one read or write in flight to be done, and take the
+   results of all that are. Return -1 with errno set on error. */
+static int gz_uring_wait(gz_state *state) {
+    gz_uring *u = state->uring;
+    struct io_uring_cqe *cqe;
+    unsigned head, slot;
+
+    if (syscall(__NR_io_uring_enter, u->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR)
+        return -1;
+    head = *u->cq_head;
+    while (head != __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE)) {
+        cqe = &u->cqes[head & u->cq_mask];
+        slot = (unsigned)(cqe->user_data & 0xff);
+        if (state->mode == GZ_WRITE) {
+            if (u->err == 0 && cqe->res != (int)(cqe->user_data >> 32))
+                u->err = cqe->res < 0 ? -cqe->res : EIO;
+        } else {
+            u->got[slot] = cqe->res;
+            u->full[slot] = 1;
+        }
+        u->pending[slot]--;
+        u->busy--;
+        head++;
+    }
+    __atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/* Set the error for state from err, an errno value, and return -1 */
+static int gz_uring_error(gz_state *state, int err) {
+    errno = err;
+    gz_error(state, Z_ERRNO, zstrerror());
+    return -1;
+}
+
+/* Wait for the reads or writes in flight. When reading at file offsets, also
+   drop the data read ahead, so that reading goes on from the file position.
+   Return -1 with errno set on error. */
+static int gz_uring_idle(gz_state *state) {
+    gz_uring *u = state->uring;
+    unsigned i;
+
+    while (u->busy)
+        if (gz_uring_wait(state) == -1)
+            return -1;
+    if (state->mode == GZ_READ && !u->stream) {
+        for (i = 0; i < GZ_URING_SLOTS; i++) {
+            u->full[i] = 0;
+            u->used[i] = 0;
+        }
+        u->off = u->pos;
+    }
+    return 0;
+}
+
+/* Copy up to len bytes to buf from the buffers read ahead, queueing them to
+   be read again as they are emptied. Like gz_load() with read(), *have is set
+   to the number of bytes copied, which is only less than len at the end of
+   the input, where state->eof is set. Return -1 on error, otherwise 0. */
+int Z_INTERNAL gz_uring_read(gz_state *state, unsigned char *buf, unsigned len, unsigned *have) {
+    gz_uring *u = state->uring;
+    unsigned slot, i, n;
+    int got;
+
+    *have = 0;
+    while (*have < len) {
+        /* keep the empty buffers queued to be read, in order */
+        for (i = 0; i < GZ_URING_SLOTS; i++) {
+            slot = (u->next + i) % GZ_URING_SLOTS;
+            if (u->pending[slot] || u->full[slot])
+                continue;
+            if (u->stream && u->busy)
+                break;
+            if (gz_uring_queue(state, slot, u->buf[slot], u->size, u->off) == -1) {
+                u->got[slot] = -errno;
+                u->full[slot] = 1;
+                break;
+            }
+            u->off += u->size;
+        }
+
+        /* wait for the next one to be read */
+        slot = u->next;
+        while (u->pending[slot])
+            if (gz_uring_wait(state) == -1)
+                return gz_uring_error(state, errno);
+        got = u->got[slot];
+        if (got < 0) {
+            u->full[slot] = 0;
+            if (gz_uring_idle(state) == -1)
+                return gz_uring_error(state, errno);
+            return gz_uring_error(state, -got);
+        }
+
+        /* copy from it, and when it's emptied, move on */
+        n = (unsigned)got - u->used[slot];
+        if (n > len - *have)
+            n = len - *have;
+        if (n)
+            memcpy(buf + *have, u->buf[slot] + u->used[slot], n);
+        *have += n;
+        u->used[slot] += n;
+        u->pos += n;
+        if (u->used[slot] == (unsigned)got) {
+            u->full[slot] = 0;
+            u->used[slot] = 0;
+            u->next = (slot + 1) % GZ_URING_SLOTS;
+            if (got == 0) {
+                state->eof = 1;
+                break;
+            }
+
+            /* a short read at an offset is at the end of the file as it was
+               then, so the reads after it may have missed data written since */
+            if ((unsigned)got < u->size && !u->stream && gz_uring_idle(state) == -1)
+                return gz_uring_error(state, errno);
+        }
+    }
+
+    /* what's read ahead past the end doesn't count */
+    if (state->eof && gz_uring_idle(state) == -1)
+        return gz_uring_error(state, errno);
+    return 0;
+}
+
+/* Queue a write of len bytes at buf, which is in the output buffer. Return -1
+   on error, which may be from an earlier write. */
+int Z_INTERNAL gz_uring_write(gz_state *state, const unsigned char *buf, unsigned len) {
+    gz_uring *u = state->uring;
+
+    while (u->err == 0 && (u->busy == GZ_URING_ENTRIES || (u->stream && u->busy)))
+        if (gz_uring_wait(state) == -1)
+            return gz_uring_error(state, errno);
+    if (u->err)
+        return gz_uring_error(state, u->err);
+    if (gz_uring_queue(state, u->next, buf, len, u->off) == -1)
+        return gz_uring_error(state, errno);
+    u->off += len;
+    u->pos = u->off;
+    return 0;
+}
+
+/* Make the next buffer the output buffer, once the writes from it are done.
+   Return -1 on error. */
+int Z_INTERNAL gz_uring_next(gz_state *state) {
+    gz_uring *u = state->uring;
+    unsigned slot = (u->next + 1) % GZ_URING_SLOTS;
+
+    while (u->err == 0 && u->pending[slot])
+        if (gz_uring_wait(state) == -1)
+            return gz_uring_error(state, errno);
+    if (u->err)
+        return gz_uring_error(state, u->err);
+    u->next = slot;
+    state->out = u->buf[slot];
+    return 0;
+}
+
+/* Wait for all of the writes to be done. Return -1 on error. */
+int Z_INTERNAL gz_uring_drain(gz_state *state) {
+    gz_uring *u = state->uring;
+
+    if (gz_uring_idle(state) == -1)
+        return gz_uring_error(state, errno);
+    if (u->err)
+        return gz_uring_error(state, u->err);
+    return 0;
+}
+
+/* gz_lseek() with io_uring, on the file position as read() or write() would
+   have left it. Getting the position doesn't wait, but anything else waits for
+   what's in flight, and drops the data read ahead. */
+z_off64_t Z_INTERNAL gz_uring_seek(gz_state *state, z_off64_t offset, int whence) {
+    gz_uring *u = state->uring;
+    z_off64_t ret;
+
+    if (u->stream) {
+        if (state->mode == GZ_WRITE && gz_uring_idle(state) == -1)
+            return -1;
+        return LSEEK(state->fd, offset, whence);
+    }
+    if (whence == SEEK_CUR) {
+        if (offset == 0)
+            return u->pos;
+        offset += u->pos;
+        whence = SEEK_SET;
+    }
+    if (gz_uring_idle(state) == -1)
+        return -1;
+    ret = LSEEK(state->fd, offset, whence);
+    if (ret != -1)
+        u->pos = u->off = ret;
+    return ret;
+}
+
+/* Wait for what's in flight, leave the file position where read() or write()
+   would have, and free the io_uring state. When writing, the first buffer is
+   given back as the output buffer. */
+void Z_INTERNAL gz_uring_free(gz_state *state) {
+    gz_uring *u = state->uring;
+    unsigned i;
+
+    if (u == NULL)
+        return;
+    while (u->busy && gz_uring_wait(state) != -1)
+        ;
+    if (!u->stream)
+        LSEEK(state->fd, u->pos, SEEK_SET);
+    close(u->fd);
+    munmap(u->sqes, u->sqes_size);
+    munmap(u->ring, u->ring_size);
+    for (i = 0; i < GZ_URING_SLOTS; i++) {
+        if (i == 0 && state->mode == GZ_WRITE) {
+            if (u->buf[0] != NULL)
+                state->out = u->buf[0];
+        } else
+            zng_free(u->buf[i]);
+    }
+    zng_free(u);
+    state->uring = NULL;
+}
+#endif
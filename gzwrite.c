@@ -5,11 +5,22 @@
 
 #include "zbuild.h"
 #include "zutil_p.h"
+#include "deflate.h"
 #include <stdarg.h>
+/* deflate.h's switch for gzip wrapping, gzguts.h uses the name for a read mode */
+#undef GZIP
 #include "gzguts.h"
 
 /* Local functions */
 static int gz_init(gz_state *);
+static int gz_continue(gz_state *);
+static int gz_put(gz_state *, const unsigned char *, unsigned);
+static int gz_write_out(gz_state *, const unsigned char *, unsigned);
+static z_off64_t gz_where(gz_state *);
+static int gz_bgzf_comp(gz_state *, int);
+static int gz_out(gz_state *);
+static int gz_deflate(gz_state *, int);
+static int gz_span_comp(gz_state *, int);
 static int gz_comp(gz_state *, int);
 static int gz_zero(gz_state *, z_off64_t);
 static size_t gz_write(gz_state *, void const *, size_t);
@@ -31,30 +42,76 @@ static int gz_init(gz_state *state) {
 
     /* only need output buffer and deflate state if compressing */
     if (!state->direct) {
-        /* allocate output buffer */
-        state->out = (unsigned char *)zng_alloc(state->want);
-        if (state->out == NULL) {
+        /* allocate output buffer, which for BGZF has to hold a whole member,
+           and BGZF data for the next member */
+        state->out = (unsigned char *)zng_alloc(state->bgzf != NULL && state->want < BGZF_MAX_SIZE ?
+                                                BGZF_MAX_SIZE : state->want);
+        if (state->bgzf != NULL)
+            state->bgzf->block = (unsigned char *)zng_alloc(BGZF_BLOCK);
+        if (state->out == NULL || (state->bgzf != NULL && state->bgzf->block == NULL)) {
+            if (state->bgzf != NULL) {
+                zng_free(state->bgzf->block);
+                state->bgzf->block = NULL;
+            }
+            zng_free(state->out);
             zng_free(state->in);
             gz_error(state, Z_MEM_ERROR, "out of memory");
             return -1;
         }
 
-        /* allocate deflate memory, set up for gzip compression */
+        /* allocate deflate memory, set up for gzip compression, or raw
+           deflate for BGZF, which writes its own headers and trailers */
         strm->zalloc = NULL;
         strm->zfree = NULL;
         strm->opaque = NULL;
-        ret = PREFIX(deflateInit2)(strm, state->level, Z_DEFLATED, MAX_WBITS + 16, DEF_MEM_LEVEL, state->strategy);
+        ret = PREFIX(deflateInit2)(strm, state->level, Z_DEFLATED,
+                                   state->bgzf != NULL || state->cont ? -MAX_WBITS : MAX_WBITS + 16,
+                                   DEF_MEM_LEVEL, state->strategy);
         if (ret != Z_OK) {
+            if (state->bgzf != NULL) {
+                zng_free(state->bgzf->block);
+                state->bgzf->block = NULL;
+            }
             zng_free(state->out);
             zng_free(state->in);
             gz_error(state, Z_MEM_ERROR, "out of memory");
             return -1;
         }
         strm->next_in = NULL;
+        if (state->rsyncable)
+            deflate_set_rsyncable(strm, 1);
+
+        /* with "c", pick up the last gzip stream of the file where it ends */
+        if (state->cont && gz_continue(state) == -1) {
+            PREFIX(deflateEnd)(strm);
+            zng_free(state->out);
+            zng_free(state->in);
+            return -1;
+        }
+
+        /* BGZF offsets are file offsets, so start where the file is */
+        if (state->bgzf != NULL) {
+            state->bgzf->coff = gz_where(state);
+            if (state->bgzf->coff == -1)
+                state->bgzf->coff = 0;
+        }
+
+        /* and so are those in the index of a seekable file, which also notes
+           where it started */
+        if (state->span) {
+            state->coff = gz_where(state);
+            if (state->coff == -1)
+                state->coff = 0;
+            state->start = state->coff;
+        }
     }
 
     /* mark state as initialized */
     state->size = state->want;
+#ifdef HAVE_IO_URING
+    if (state->uring != NULL)
+        gz_uring_start(state);
+#endif
 
     /* initialize write buffer if compressing */
     if (!state->direct) {
@@ -65,32 +122,471 @@ static int gz_init(gz_state *state) {
     return 0;
 }
 
-/* Compress whatever is at avail_in and next_in and write to the output file.
-   Return -1 if there is an error writing to the output file or if gz_init()
-   fails to allocate memory, otherwise 0.  flush is assumed to be a valid
-   deflate() flush value.  If flush is Z_FINISH, then the deflate() state is
-   reset to start a new gzip stream.  If gz->direct is true, then simply write
-   to the output file without compressing, and ignore flush. */
-static int gz_comp(gz_state *state, int flush) {
+/* Where and how the last gzip stream of a file ends, for continuing it */
+typedef struct {
+    z_off64_t mark;         /* offset of the byte with the last-block bit of the last deflate block */
+    unsigned mask;          /* that bit */
+    z_off64_t end;          /* offset of the byte with the last bits of the deflate data, if any */
+    unsigned bits;          /* number of bits of deflate data in that byte, 0..7 */
+    unsigned last;          /* those bits */
+    uint32_t check;         /* CRC-32 of the data of the stream */
+    uint32_t isize;         /* length of the data modulo 2^32 */
+    unsigned char *window;  /* the last 32K of the data */
+    uint32_t wlen;          /* amount of data at window */
+} gz_tail;
+
+/* Decompress the gzip streams from off up to end in the file, using the first
+   half of the input buffer and the output buffer, and if they are all valid
+   and end right at end, fill in tail for the last one.  Return 1 if so, 0 if
+   not, or -1 on error. */
+static int gz_tail_scan(gz_state *state, gz_tail *tail, z_off64_t off, z_off64_t end) {
+    PREFIX3(stream) strm;
+    PREFIX(gz_header) head;
+    unsigned char *in = state->in, prev = 0;
+    z_off64_t at;
+    unsigned n = 0, left;
     int ret;
-    ssize_t got;
-    unsigned have;
+
+    strm.zalloc = NULL;
+    strm.zfree = NULL;
+    strm.opaque = NULL;
+    strm.next_in = NULL;
+    strm.avail_in = 0;
+    if (PREFIX(inflateInit2)(&strm, MAX_WBITS + 16) != Z_OK) {
+        gz_error(state, Z_MEM_ERROR, "out of memory");
+        return -1;
+    }
+    memset(&head, 0, sizeof(head));
+    PREFIX(inflateGetHeader)(&strm, &head);
+    for (;;) {
+        /* get more input, keeping the last byte of the previous input in case
+           some of its bits are the last ones of a block */
+        if (strm.avail_in == 0) {
+            if (off == end) {
+                ret = 0;
+                break;
+            }
+            if (n)
+                prev = in[n - 1];
+            n = end - off < state->want ? (unsigned)(end - off) : state->want;
+            ret = gz_read_at(state, in, n, off);
+            if (ret) {
+                ret = ret == -1 ? -1 : 0;
+                break;
+            }
+            off += n;
+            strm.next_in = in;
+            strm.avail_in = n;
+        }
+
+        /* decompress up to the end of the next deflate block */
+        strm.next_out = state->out;
+        strm.avail_out = state->want;
+        ret = PREFIX(inflate)(&strm, Z_BLOCK);
+        if (ret == Z_MEM_ERROR) {
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            ret = -1;
+            break;
+        }
+        if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+            ret = 0;                /* not gzip, or damaged */
+            break;
+        }
+        at = off - strm.avail_in;
+
+        /* at the end of a gzip stream, done if it is the last one and its
+           header has no extra field, which could have to do with its size as
+           in BGZF, or else go on to the next one */
+        if (ret == Z_STREAM_END) {
+            if (at == end) {
+                tail->check = (uint32_t)strm.adler;
+                tail->isize = (uint32_t)strm.total_out;
+                PREFIX(inflateGetDictionary)(&strm, tail->window, &tail->wlen);
+                ret = head.extra_len == 0;
+                break;
+            }
+            PREFIX(inflateReset)(&strm);
+            memset(&head, 0, sizeof(head));
+            PREFIX(inflateGetHeader)(&strm, &head);
+            continue;
+        }
+
+        /* between blocks, data_type has the number of bits not used yet of the
+           last byte read, and whether the last block was just done -- note
+           where the next block starts, or where the last one ended */
+        if (strm.data_type & 128) {
+            left = (unsigned)strm.data_type & 7;
+            if (strm.data_type & 64) {
+                tail->end = left ? at - 1 : at;
+                tail->bits = left ? 8 - left : 0;
+                tail->last = left ? (strm.next_in > in ? strm.next_in[-1] : prev) & ((1U << tail->bits) - 1) : 0;
+            } else {
+                tail->mark = left ? at - 1 : at;
+                tail->mask = left ? 0x100 >> left : 1;
+            }
+        }
+    }
+    PREFIX(inflateEnd)(&strm);
+    return ret;
+}
+
+/* Look back from end in the file for the start of its last gzip stream, a
+   gzip header from which the rest of it decompresses, using the second half of
+   the input buffer.  Return 1 with tail filled in if found, 0 if not, or -1 on
+   error. */
+static int gz_tail_find(gz_state *state, gz_tail *tail, z_off64_t end) {
+    unsigned char *buf = state->in + state->want;
+    z_off64_t lo, hi;
+    unsigned i;
+    int ret;
+
+    /* a gzip stream is at least 20 bytes, and its header starts with the magic
+       bytes, the deflate method, and flags with the reserved bits clear */
+    hi = end - 19;
+    while (hi > 0) {
+        lo = hi > state->want - 3 ? hi - (state->want - 3) : 0;
+        ret = gz_read_at(state, buf, (size_t)(hi - lo) + 3, lo);
+        if (ret)
+            return ret == -1 ? -1 : 0;
+        for (i = (unsigned)(hi - lo); i--;)
+            if (buf[i] == 31 && buf[i + 1] == 139 && buf[i + 2] == 8 && (buf[i + 3] & 0xe0) == 0) {
+                ret = gz_tail_scan(state, tail, lo + i, end);
+                if (ret)
+                    return ret;
+            }
+        hi = lo;
+    }
+    return 0;
+}
+
+/* Find the last gzip stream of the file and set up to continue it: clear the
+   last-block bit of its last deflate block, cut the file at the end of its
+   deflate data, give the bits of the last byte of that to deflatePrime(), and
+   the last 32K of the stream's data to deflateSetDictionary().  The new data
+   is then compressed right after it, and its trailer is written with the check
+   value and length carried on from the old one.  Only the last gzip stream is
+   decompressed, starting from where the index says if the file was written
+   with "S", and the index is dropped.  If the file does not end with a gzip
+   stream that can be continued, leave it alone and start a new stream at the
+   first write, as without "c".  Return -1 on error, otherwise 0. */
+static int gz_continue(gz_state *state) {
     PREFIX3(stream) *strm = &(state->strm);
+    unsigned char tail_buf[GZ_INDEX_TAIL], byte = 0;
+    gz_mem *mem = state->mem;
+    gz_map map;
+    gz_tail tail;
+    z_off64_t end;
+    int ret;
 
-    /* allocate memory if this is the first time through */
-    if (state->size == 0 && gz_init(state) == -1)
+    /* start a new gzip stream unless the last one is found */
+    state->reset = 1;
+
+    /* read memory as if mapped, and the file where it is, but not if appending
+       is forced, since the last-block bit has to be written in place */
+    if (mem != NULL) {
+        map.data = mem->data;
+        map.size = (z_off64_t)mem->len;
+        map.pos = 0;
+        map.mapped = 0;
+        state->map = &map;
+        end = map.size;
+    } else {
+#ifdef F_GETFL
+        ret = fcntl(state->fd, F_GETFL);
+        if (ret == -1 || (ret & O_APPEND))
+            return 0;
+#endif
+        end = LSEEK(state->fd, 0, SEEK_END);
+    }
+    if (end <= 0) {
+        state->map = NULL;
+        return 0;
+    }
+    tail.window = (unsigned char *)zng_alloc(32768);
+    if (tail.window == NULL) {
+        state->map = NULL;
+        gz_error(state, Z_MEM_ERROR, "out of memory");
         return -1;
+    }
 
-    /* write directly if requested */
-    if (state->direct) {
-        got = write(state->fd, strm->next_in, strm->avail_in);
-        if (got < 0 || (unsigned)got != strm->avail_in) {
+    /* go from the last stream in the index of a seekable file, where the index
+       starts, or else look for the last stream */
+    state->start = 0;
+    ret = gz_index_find(state);
+    if (ret == 0 && state->index != NULL) {
+        ret = gz_read_at(state, tail_buf, GZ_INDEX_TAIL, end - GZ_INDEX_TAIL);
+        if (ret == 0) {
+            end -= (z_off64_t)gz_get64(tail_buf + 4);
+            ret = gz_tail_scan(state, &tail, (z_off64_t)state->index[state->index_have - 1].coff, end);
+        } else if (ret == 1)
+            ret = 0;
+        zng_free(state->index);
+        state->index = NULL;
+        state->index_have = state->index_size = 0;
+    } else if (ret == 0)
+        ret = gz_tail_find(state, &tail, end);
+    state->map = NULL;
+    if (ret != 1) {
+        zng_free(tail.window);
+        return ret;
+    }
+
+    /* make the last block not the last, and cut the stream after it */
+    if (tail.bits && tail.mark == tail.end)
+        tail.last &= ~tail.mask;
+    else if (mem != NULL)
+        mem->data[tail.mark] &= (unsigned char)~tail.mask;
+    else {
+        ret = gz_read_at(state, &byte, 1, tail.mark);
+        byte &= (unsigned char)~tail.mask;
+        if (ret != 0 || LSEEK(state->fd, tail.mark, SEEK_SET) == -1 || write(state->fd, &byte, 1) != 1) {
+            zng_free(tail.window);
             gz_error(state, Z_ERRNO, zstrerror());
             return -1;
         }
-        strm->avail_in = 0;
+    }
+    if (mem != NULL) {
+        mem->len = (size_t)tail.end;
+        *mem->buf_len = mem->len;
+    } else if (FTRUNCATE(state->fd, tail.end) != 0 || LSEEK(state->fd, tail.end, SEEK_SET) == -1) {
+        zng_free(tail.window);
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+
+    /* go on from there with the same history, check value, and length */
+    if (tail.wlen)
+        PREFIX(deflateSetDictionary)(strm, tail.window, tail.wlen);
+    if (tail.bits)
+        PREFIX(deflatePrime)(strm, (int)tail.bits, (int)tail.last);
+    zng_free(tail.window);
+    state->check = tail.check;
+    state->isize = tail.isize;
+    state->reset = 0;
+    return 0;
+}
+
+/* Write len bytes from buf to the output file, or append them to the memory
+   written to, growing it as needed.  Return -1 on error, 0 on success. */
+static int gz_write_out(gz_state *state, const unsigned char *buf, unsigned len) {
+    gz_mem *mem = state->mem;
+    unsigned char *data;
+    ssize_t got;
+    size_t size;
+
+    if (mem != NULL) {
+        if (len > mem->size - mem->len) {
+            size = mem->size < 4096 ? 4096 : mem->size;
+            while (size - mem->len < len && size << 1 > size)
+                size <<= 1;
+            data = size - mem->len < len ? NULL : (unsigned char *)realloc(mem->data, size);
+            if (data == NULL) {
+                gz_error(state, Z_MEM_ERROR, "out of memory");
+                return -1;
+            }
+            mem->data = data;
+            mem->size = size;
+        }
+        if (len)
+            memcpy(mem->data + mem->len, buf, len);
+        mem->len += len;
+        *mem->buf = mem->data;
+        *mem->buf_len = mem->len;
         return 0;
     }
+    got = len ? write(state->fd, buf, len) : 0;
+    if (got < 0 || (unsigned)got != len) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    return 0;
+}
+
+/* Return the offset in the output file or memory where the next write will
+   go, or -1 if it is not known. */
+static z_off64_t gz_where(gz_state *state) {
+    return state->mem != NULL ? (z_off64_t)state->mem->len : LSEEK(state->fd, 0, SEEK_CUR);
+}
+
+/* Put a little-endian 32-bit integer in buf */
+static void gz_put32(unsigned char *buf, uint32_t val) {
+    buf[0] = (unsigned char)val;
+    buf[1] = (unsigned char)(val >> 8);
+    buf[2] = (unsigned char)(val >> 16);
+    buf[3] = (unsigned char)(val >> 24);
+}
+
+/* Put a little-endian 64-bit integer in buf */
+static void gz_put64(unsigned char *buf, uint64_t val) {
+    gz_put32(buf, (uint32_t)val);
+    gz_put32(buf + 4, (uint32_t)(val >> 32));
+}
+
+/* Write len bytes from buf to the output file. Return -1 on error, 0 on
+   success. */
+static int gz_bgzf_write(gz_state *state, const unsigned char *buf, unsigned len) {
+    if (gz_write_out(state, buf, len) == -1)
+        return -1;
+    state->bgzf->coff += len;
+    return 0;
+}
+
+/* Compress len bytes at buf to a BGZF member and write it. The deflate stream
+   is left reset, ready for the next member. Return -1 on error, 0 on
+   success. */
+static int gz_bgzf_deflate(gz_state *state, const unsigned char *buf, unsigned len) {
+    static const unsigned char header[BGZF_HEADER - 2] = {
+        31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0
+    };
+    gz_bgzf *bgzf = state->bgzf;
+    PREFIX3(stream) *strm = &(state->strm);
+    unsigned char *out = state->out;
+    unsigned size;
+    int ret;
+
+    /* compress, which always fits for the amount of data in a member, unless
+       the data cannot be compressed -- then store it instead */
+    strm->next_in = (z_const unsigned char *)buf;
+    strm->avail_in = len;
+    strm->next_out = out + BGZF_HEADER;
+    strm->avail_out = BGZF_MAX_SIZE - BGZF_HEADER - BGZF_TRAILER;
+    ret = PREFIX(deflate)(strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        PREFIX(deflateReset)(strm);
+        PREFIX(deflateParams)(strm, 0, state->strategy);
+        strm->next_in = (z_const unsigned char *)buf;
+        strm->avail_in = len;
+        strm->next_out = out + BGZF_HEADER;
+        strm->avail_out = BGZF_MAX_SIZE - BGZF_HEADER - BGZF_TRAILER;
+        ret = PREFIX(deflate)(strm, Z_FINISH);
+        PREFIX(deflateReset)(strm);
+        PREFIX(deflateParams)(strm, state->level, state->strategy);
+        if (ret != Z_STREAM_END) {
+            gz_error(state, Z_STREAM_ERROR, "internal error: deflate stream corrupt");
+            return -1;
+        }
+    } else {
+        PREFIX(deflateReset)(strm);
+    }
+
+    /* add the header with the member size, and the trailer */
+    size = (unsigned)(strm->next_out - out) + BGZF_TRAILER;
+    memcpy(out, header, sizeof(header));
+    out[BGZF_HEADER - 2] = (unsigned char)(size - 1);
+    out[BGZF_HEADER - 1] = (unsigned char)((size - 1) >> 8);
+    gz_put32(strm->next_out, PREFIX(crc32)(0, buf, len));
+    gz_put32(strm->next_out + 4, len);
+
+    /* note where the member starts in the index, if one was asked for, unless
+       it is the first one */
+    if (bgzf->index_path != NULL && bgzf->uoff != 0) {
+        if (bgzf->index_have == bgzf->index_size) {
+            size_t want = bgzf->index_size ? bgzf->index_size << 1 : 64;
+            gz_bgzf_entry *index = (gz_bgzf_entry *)zng_alloc(want * sizeof(gz_bgzf_entry));
+            if (index == NULL) {
+                gz_error(state, Z_MEM_ERROR, "out of memory");
+                return -1;
+            }
+            if (bgzf->index_have)
+                memcpy(index, bgzf->index, bgzf->index_have * sizeof(gz_bgzf_entry));
+            zng_free(bgzf->index);
+            bgzf->index = index;
+            bgzf->index_size = want;
+        }
+        bgzf->index[bgzf->index_have].coff = (uint64_t)bgzf->coff;
+        bgzf->index[bgzf->index_have].uoff = (uint64_t)bgzf->uoff;
+        bgzf->index_have++;
+    }
+
+    /* write the member */
+    if (gz_bgzf_write(state, out, size) == -1)
+        return -1;
+    bgzf->uoff += len;
+    return 0;
+}
+
+/* Compress the data at avail_in and next_in to BGZF members of BGZF_BLOCK
+   bytes each, keeping what does not fill a member for later. If flush is not
+   Z_NO_FLUSH, then also write what was kept as a shorter member. Return -1 on
+   error, 0 on success. */
+static int gz_bgzf_comp(gz_state *state, int flush) {
+    gz_bgzf *bgzf = state->bgzf;
+    PREFIX3(stream) *strm = &(state->strm);
+    const unsigned char *next = strm->next_in;
+    unsigned left = strm->avail_in, n;
+
+    strm->avail_in = 0;
+    while (left) {
+        /* compress whole members directly */
+        if (bgzf->have == 0 && left >= BGZF_BLOCK) {
+            if (gz_bgzf_deflate(state, next, BGZF_BLOCK) == -1)
+                return -1;
+            next += BGZF_BLOCK;
+            left -= BGZF_BLOCK;
+            continue;
+        }
+
+        /* otherwise collect a member's worth of data */
+        n = BGZF_BLOCK - bgzf->have;
+        if (n > left)
+            n = left;
+        memcpy(bgzf->block + bgzf->have, next, n);
+        bgzf->have += n;
+        next += n;
+        left -= n;
+        if (bgzf->have == BGZF_BLOCK) {
+            bgzf->have = 0;
+            if (gz_bgzf_deflate(state, bgzf->block, BGZF_BLOCK) == -1)
+                return -1;
+        }
+    }
+
+    /* when flushing, write out any data collected */
+    if (flush != Z_NO_FLUSH && bgzf->have) {
+        n = bgzf->have;
+        bgzf->have = 0;
+        if (gz_bgzf_deflate(state, bgzf->block, n) == -1)
+            return -1;
+    }
+    return 0;
+}
+
+/* Write out the compressed data in the output buffer that is not written yet,
+   and start over at the beginning of the buffer if it is full.  Return -1 on
+   a write error, otherwise 0. */
+static int gz_out(gz_state *state) {
+    unsigned have;
+    PREFIX3(stream) *strm = &(state->strm);
+
+    have = (unsigned)(strm->next_out - state->x.next);
+#ifdef HAVE_IO_URING
+    if (state->uring != NULL) {
+        /* queue the write, and go on in the next buffer if full */
+        if (have && gz_uring_write(state, state->x.next, have) == -1)
+            return -1;
+        if (strm->avail_out == 0 && gz_uring_next(state) == -1)
+            return -1;
+    } else
+#endif
+    if (gz_write_out(state, state->x.next, have) == -1)
+        return -1;
+    state->coff += have;
+    if (strm->avail_out == 0) {
+        strm->avail_out = state->size;
+        strm->next_out = state->out;
+        state->x.next = state->out;
+    }
+    state->x.next = strm->next_out;
+    return 0;
+}
+
+/* Compress whatever is at avail_in and next_in with deflate() and write to the
+   output file.  Return -1 on error, otherwise 0.  If flush is Z_FINISH, then
+   the deflate() state is reset to start a new gzip stream. */
+static int gz_deflate(gz_state *state, int flush) {
+    int ret;
+    unsigned have;
+    PREFIX3(stream) *strm = &(state->strm);
 
     /* check for a pending reset */
     if (state->reset) {
@@ -99,6 +595,20 @@ static int gz_comp(gz_state *state, int flush) {
             return 0;
         PREFIX(deflateReset)(strm);
         state->reset = 0;
+
+        /* with "c", deflate is raw, and the gzip header is written here */
+        if (state->cont) {
+            static const unsigned char head[10] = { 31, 139, 8, 0, 0, 0, 0, 0, 0, 255 };
+
+            if (gz_put(state, head, sizeof(head)) == -1)
+                return -1;
+            state->check = (uint32_t)PREFIX(crc32)(0, NULL, 0);
+            state->isize = 0;
+        }
+    }
+    if (state->cont && strm->avail_in) {
+        state->check = (uint32_t)PREFIX(crc32)(state->check, strm->next_in, strm->avail_in);
+        state->isize += strm->avail_in;
     }
 
     /* run deflate() on provided input until it produces no more output */
@@ -106,19 +616,9 @@ static int gz_comp(gz_state *state, int flush) {
     do {
         /* write out current buffer contents if full, or if flushing, but if
            doing Z_FINISH then don't write until we get to Z_STREAM_END */
-        if (strm->avail_out == 0 || (flush != Z_NO_FLUSH && (flush != Z_FINISH || ret == Z_STREAM_END))) {
-            have = (unsigned)(strm->next_out - state->x.next);
-            if (have && ((got = write(state->fd, state->x.next, (unsigned long)have)) < 0 || (unsigned)got != have)) {
-                gz_error(state, Z_ERRNO, zstrerror());
-                return -1;
-            }
-            if (strm->avail_out == 0) {
-                strm->avail_out = state->size;
-                strm->next_out = state->out;
-                state->x.next = state->out;
-            }
-            state->x.next = strm->next_out;
-        }
+        if ((strm->avail_out == 0 || (flush != Z_NO_FLUSH && (flush != Z_FINISH || ret == Z_STREAM_END))) &&
+            gz_out(state) == -1)
+            return -1;
 
         /* compress */
         have = strm->avail_out;
@@ -130,13 +630,104 @@ static int gz_comp(gz_state *state, int flush) {
         have -= strm->avail_out;
     } while (have);
 
-    /* if that completed a deflate stream, allow another to start */
-    if (flush == Z_FINISH)
+#ifdef HAVE_IO_URING
+    /* when flushing, the data has to be written when done */
+    if (flush != Z_NO_FLUSH && state->uring != NULL && gz_uring_drain(state) == -1)
+        return -1;
+#endif
+
+    /* if that completed a deflate stream, allow another to start, after the
+       gzip trailer with "c" */
+    if (flush == Z_FINISH) {
+        if (state->cont) {
+            unsigned char trailer[8];
+
+            gz_put32(trailer, state->check);
+            gz_put32(trailer + 4, state->isize);
+            if (gz_put(state, trailer, sizeof(trailer)) == -1 || gz_out(state) == -1)
+                return -1;
+        }
         state->reset = 1;
+    }
     /* all done, no errors */
     return 0;
 }
 
+/* Add the start of the next gzip stream of a seekable file to the index.
+   Return -1 on a memory allocation failure, or 0 on success. */
+static int gz_index_add(gz_state *state, z_off64_t uoff) {
+    if (state->index_have == state->index_size) {
+        size_t want = state->index_size ? state->index_size << 1 : 64;
+        gz_bgzf_entry *index = (gz_bgzf_entry *)zng_alloc(want * sizeof(gz_bgzf_entry));
+        if (index == NULL) {
+            gz_error(state, Z_MEM_ERROR, "out of memory");
+            return -1;
+        }
+        if (state->index_have)
+            memcpy(index, state->index, state->index_have * sizeof(gz_bgzf_entry));
+        zng_free(state->index);
+        state->index = index;
+        state->index_size = want;
+    }
+    state->index[state->index_have].coff = (uint64_t)state->coff;
+    state->index[state->index_have].uoff = (uint64_t)uoff;
+    state->index_have++;
+    return 0;
+}
+
+/* Compress as gz_deflate() does, but for a seekable file, end the gzip stream
+   each time span bytes of input have gone into it, and note where the next
+   one starts.  A stream is only ended once there is more input for the next
+   one.  Return -1 on error, otherwise 0. */
+static int gz_span_comp(gz_state *state, int flush) {
+    PREFIX3(stream) *strm = &(state->strm);
+    unsigned left;
+
+    while (strm->avail_in > state->span_left) {
+        left = strm->avail_in - (unsigned)state->span_left;
+        strm->avail_in = (unsigned)state->span_left;
+        if (gz_deflate(state, Z_FINISH) == -1)
+            return -1;
+        strm->avail_in = left;
+        if (gz_index_add(state, state->x.pos - left) == -1)
+            return -1;
+        state->span_left = state->span;
+    }
+    state->span_left -= strm->avail_in;
+    return gz_deflate(state, flush);
+}
+
+/* Compress whatever is at avail_in and next_in and write to the output file.
+   Return -1 if there is an error writing to the output file or if gz_init()
+   fails to allocate memory, otherwise 0.  flush is assumed to be a valid
+   deflate() flush value.  If flush is Z_FINISH, then the deflate() state is
+   reset to start a new gzip stream.  If gz->direct is true, then simply write
+   to the output file without compressing, and ignore flush. */
+static int gz_comp(gz_state *state, int flush) {
+    PREFIX3(stream) *strm = &(state->strm);
+
+    /* allocate memory if this is the first time through */
+    if (state->size == 0 && gz_init(state) == -1)
+        return -1;
+
+    /* write directly if requested (next_in isn't set if there's nothing) */
+    if (state->direct) {
+        if (gz_write_out(state, strm->next_in, strm->avail_in) == -1)
+            return -1;
+        strm->avail_in = 0;
+        return 0;
+    }
+
+    /* BGZF members are compressed on their own */
+    if (state->bgzf != NULL)
+        return gz_bgzf_comp(state, flush);
+
+    /* seekable files are cut into gzip streams of span bytes */
+    if (state->span)
+        return gz_span_comp(state, flush);
+    return gz_deflate(state, flush);
+}
+
 /* Compress len zeros to output.  Return -1 on a write error or memory
    allocation failure by gz_comp(), or 0 on success. */
 static int gz_zero(gz_state *state, z_off64_t len) {
@@ -477,7 +1068,7 @@ int Z_EXPORT PREFIX(gzsetparams)(gzFile file, int level, int strategy) {
     /* change compression parameters for subsequent input */
     if (state->size) {
         /* flush previous input with previous parameters before changing */
-        if (strm->avail_in && gz_comp(state, Z_BLOCK) == -1)
+        if ((strm->avail_in || (state->bgzf != NULL && state->bgzf->have)) && gz_comp(state, Z_BLOCK) == -1)
             return state->err;
         PREFIX(deflateParams)(strm, level, strategy);
     }
@@ -486,6 +1077,139 @@ int Z_EXPORT PREFIX(gzsetparams)(gzFile file, int level, int strategy) {
     return Z_OK;
 }
 
+/* End a BGZF file with an empty member, and save the index if one was asked
+   for. Return -1 on error, 0 on success. */
+static int gz_bgzf_close(gz_state *state) {
+    static const unsigned char eof[28] = {
+        31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0, 27, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+    gz_bgzf *bgzf = state->bgzf;
+    unsigned char *buf = state->out;
+    size_t have, n;
+    int fd, ok;
+
+    if (gz_bgzf_write(state, eof, sizeof(eof)) == -1)
+        return -1;
+    if (bgzf->index_path == NULL)
+        return 0;
+
+    /* write the index, using the output buffer */
+    fd = open(bgzf->index_path,
+#ifdef O_BINARY
+              O_BINARY |
+#endif
+              O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    gz_put64(buf, bgzf->index_have);
+    n = 8;
+    for (have = 0; have < bgzf->index_have; have++) {
+        if (n > BGZF_MAX_SIZE - 16) {
+            if (write(fd, buf, (unsigned)n) != (ssize_t)n)
+                break;
+            n = 0;
+        }
+        gz_put64(buf + n, bgzf->index[have].coff);
+        gz_put64(buf + n + 8, bgzf->index[have].uoff);
+        n += 16;
+    }
+    ok = have == bgzf->index_have && write(fd, buf, (unsigned)n) == (ssize_t)n;
+    if (close(fd) == -1 || !ok) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    return 0;
+}
+
+/* Copy len bytes from buf to the output buffer after the compressed data, and
+   write them out as it fills up.  Return -1 on error, 0 on success. */
+static int gz_put(gz_state *state, const unsigned char *buf, unsigned len) {
+    PREFIX3(stream) *strm = &(state->strm);
+    unsigned n;
+
+    while (len) {
+        if (strm->avail_out == 0 && gz_out(state) == -1)
+            return -1;
+        n = strm->avail_out < len ? strm->avail_out : len;
+        memcpy(strm->next_out, buf, n);
+        strm->next_out += n;
+        strm->avail_out -= n;
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* End a seekable file with its index, as empty gzip streams with up to
+   GZ_INDEX_MAX entries each in "ZI" subfields of the extra field, the file and
+   uncompressed offsets of the start of each gzip stream but the first.  The
+   last one also has a "ZX" subfield with the size of all of the index streams
+   and the file offset where the seekable file started, so that it ends with
+   GZ_INDEX_TAIL bytes that locate the index.  Return -1 on error, 0 on
+   success. */
+static int gz_span_close(gz_state *state) {
+    static const unsigned char head[10] = { 31, 139, 8, 4, 0, 0, 0, 0, 0, 255 };
+    static const unsigned char end[10] = { 3, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    unsigned char buf[16];
+    uint64_t total;
+    size_t have, n, i;
+    unsigned xlen;
+
+    if (state->index_have == 0)
+        return 0;
+    n = (state->index_have + GZ_INDEX_MAX - 1) / GZ_INDEX_MAX;
+    total = (uint64_t)n * 26 + (uint64_t)state->index_have * 16 + GZ_INDEX_TAIL - 10;
+    for (have = 0; have < state->index_have; have += n) {
+        n = state->index_have - have < GZ_INDEX_MAX ? state->index_have - have : GZ_INDEX_MAX;
+
+        /* gzip header with an extra field of the entries, and the locator if
+           this is the last one */
+        xlen = 4 + (unsigned)n * 16 + (have + n == state->index_have ? GZ_INDEX_TAIL - 10 : 0);
+        memcpy(buf, head, 10);
+        buf[10] = (unsigned char)xlen;
+        buf[11] = (unsigned char)(xlen >> 8);
+        buf[12] = 'Z';
+        buf[13] = 'I';
+        buf[14] = (unsigned char)(n << 4);
+        buf[15] = (unsigned char)(n >> 4);
+        if (gz_put(state, buf, 16) == -1)
+            return -1;
+        for (i = have; i < have + n; i++) {
+            gz_put64(buf, state->index[i].coff);
+            gz_put64(buf + 8, state->index[i].uoff);
+            if (gz_put(state, buf, 16) == -1)
+                return -1;
+        }
+        if (have + n == state->index_have) {
+            buf[0] = 'Z';
+            buf[1] = 'X';
+            buf[2] = 16;
+            buf[3] = 0;
+            gz_put64(buf + 4, total);
+            if (gz_put(state, buf, 12) == -1)
+                return -1;
+            gz_put64(buf, (uint64_t)state->start);
+            if (gz_put(state, buf, 8) == -1)
+                return -1;
+        }
+
+        /* an empty fixed block, and the trailer of empty data */
+        if (gz_put(state, end, 10) == -1)
+            return -1;
+    }
+
+    /* write it all out */
+    if (gz_out(state) == -1)
+        return -1;
+#ifdef HAVE_IO_URING
+    if (state->uring != NULL && gz_uring_drain(state) == -1)
+        return -1;
+#endif
+    return 0;
+}
+
 /* -- see zlib.h -- */
 int Z_EXPORT PREFIX(gzclose_w)(gzFile file) {
     int ret = Z_OK;
@@ -510,6 +1234,17 @@ int Z_EXPORT PREFIX(gzclose_w)(gzFile file) {
     /* flush, free memory, and close file */
     if (gz_comp(state, Z_FINISH) == -1)
         ret = state->err;
+    if (state->span && ret == Z_OK && gz_span_close(state) == -1)
+        ret = state->err;
+    zng_free(state->index);
+    if (state->bgzf != NULL) {
+        if (ret == Z_OK && gz_bgzf_close(state) == -1)
+            ret = state->err;
+        gz_bgzf_free(state);
+    }
+#ifdef HAVE_IO_URING
+    gz_uring_free(state);
+#endif
     if (state->size) {
         if (!state->direct) {
             (void)PREFIX(deflateEnd)(&(state->strm));
@@ -519,8 +1254,35 @@ int Z_EXPORT PREFIX(gzclose_w)(gzFile file) {
     }
     gz_error(state, Z_OK, NULL);
     free(state->path);
-    if (close(state->fd) == -1)
+    if (state->mem != NULL)
+        zng_free(state->mem);       /* the data is the application's now */
+    else if (close(state->fd) == -1)
         ret = Z_ERRNO;
     zng_free(state);
     return ret;
 }
+
+/* Return the BGZF virtual offset of the next byte to write: the offset of its
+   member in the file shifted up 16 bits, plus its offset in the member's data,
+   or -1 on error. */
+z_off64_t Z_INTERNAL gz_bgzf_tell_w(gz_state *state) {
+    /* check that there's no error */
+    if (state->err != Z_OK)
+        return -1;
+
+    /* make sure the start of the file is known */
+    if (state->size == 0 && gz_init(state) == -1)
+        return -1;
+
+    /* check for seek request */
+    if (state->seek) {
+        state->seek = 0;
+        if (gz_zero(state, state->skip) == -1)
+            return -1;
+    }
+
+    /* move buffered input to the next member */
+    if (state->strm.avail_in && gz_comp(state, Z_NO_FLUSH) == -1)
+        return -1;
+    return (state->bgzf->coff << 16) | state->bgzf->have;
+}
@@ -37,12 +37,7 @@ int32_t ZNG_CONDEXPORT PREFIX(inflateBackInit)(PREFIX3(stream) *strm, int32_t wi
     if (strm == NULL || window == NULL || windowBits < MIN_WBITS || windowBits > MAX_WBITS)
         return Z_STREAM_ERROR;
     strm->msg = NULL;                   /* in case we return an error */
-    if (strm->zalloc == NULL) {
-        strm->zalloc = PREFIX(zcalloc);
-        strm->opaque = NULL;
-    }
-    if (strm->zfree == NULL)
-        strm->zfree = PREFIX(zcfree);
+    PREFIX(zdefault_alloc)(strm);
 
     inflate_allocs *alloc_bufs = alloc_inflate(strm);
     if (alloc_bufs == NULL)
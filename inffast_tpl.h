@@ -114,6 +114,9 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
     unsigned char *from;        /* where to copy match from */
     unsigned dist;              /* match distance */
     unsigned extra_safe;        /* copy chunks safely in all cases */
+#ifdef INFLATE_RING_WINDOW
+    int ring;                   /* window is mirrored at window + wsize */
+#endif
 
     /* copy state to local variables */
     state = (struct inflate_state *)strm->state;
@@ -127,6 +130,9 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
     whave = state->whave;
     wnext = state->wnext;
     window = state->window;
+#ifdef INFLATE_RING_WINDOW
+    ring = INFLATE_RING(state);
+#endif
     hold = state->hold;
     bits = state->bits;
     lcode = state->lencode;
@@ -226,6 +232,11 @@ void Z_INTERNAL INFLATE_FAST(PREFIX3(stream) *strm, uint32_t start) {
 #endif
                     }
                     from = window;
+#ifdef INFLATE_RING_WINDOW
+                    if (ring) {                 /* contiguous through the mirror */
+                        from += wsize + wnext - op;
+                    } else
+#endif
                     if (wnext == 0) {           /* very common case */
                         from += wsize - op;
                     } else if (wnext >= op) {   /* contiguous in window */
@@ -3,6 +3,10 @@
  * For conditions of distribution and use, see copyright notice in zlib.h
  */
 
+#ifdef INFLATE_RING_WINDOW
+#  define _GNU_SOURCE 1 /* memfd_create */
+#endif
+
 #include "zbuild.h"
 #include "zutil.h"
 #include "inftrees.h"
@@ -11,6 +15,11 @@
 #include "inffixed_tbl.h"
 #include "functable.h"
 
+#ifdef INFLATE_RING_WINDOW
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
 /* Avoid conflicts with zlib.h macros */
 #ifdef ZLIB_COMPAT
 # undef inflateInit
@@ -58,6 +67,37 @@ static int inflateStateCheck(PREFIX3(stream) *strm) {
     return 0;
 }
 
+#ifndef ZLIB_COMPAT
+/* Compact form of a stream between zng_inflateHibernate() and zng_inflateWake(). The state is kept with
+   mode set to HIBERNATE and alloc_bufs pointing to allocs, whose window holds the valid window bytes in
+   order, oldest first. */
+typedef struct inflate_hibernated_s {
+    inflate_allocs allocs;
+    inflate_mode mode;          /* mode before hibernation */
+    uint32_t packed_len;        /* compressed size of the window bytes, or 0 if stored as is */
+} inflate_hibernated;
+
+static inflate_hibernated *inflateHibernatedState(PREFIX3(stream) *strm) {
+    struct inflate_state *state;
+    if (strm == NULL || strm->zalloc == NULL || strm->zfree == NULL)
+        return NULL;
+    state = (struct inflate_state *)strm->state;
+    if (state == NULL || state->alloc_bufs == NULL || state->strm != strm || state->mode != HIBERNATE)
+        return NULL;
+    return (inflate_hibernated *)state->alloc_bufs;
+}
+#endif
+
+/* Copy the state, pointing the code table pointers into the copy */
+static void copy_state(struct inflate_state *copy, const struct inflate_state *state) {
+    memcpy(copy, state, sizeof(struct inflate_state));
+    if (state->lencode >= state->codes && state->lencode <= state->codes + ENOUGH - 1) {
+        copy->lencode = copy->codes + (state->lencode - state->codes);
+        copy->distcode = copy->codes + (state->distcode - state->codes);
+    }
+    copy->next = copy->codes + (state->next - state->codes);
+}
+
 int32_t Z_EXPORT PREFIX(inflateResetKeep)(PREFIX3(stream) *strm) {
     struct inflate_state *state;
 
@@ -145,6 +185,50 @@ int32_t Z_EXPORT PREFIX(inflateReset2)(PREFIX3(stream) *strm, int32_t windowBits
 #  define LOGSZPL(name,size,loc,pad)
 #endif
 
+#ifdef INFLATE_RING_WINDOW
+/* ===========================================================================
+ * Map a memfd of RING_WINDOW_SIZE bytes twice back to back, followed by a page of
+ * private memory for chunked reads past the end of the mirror. Returns NULL if
+ * the mapping cannot be created, in which case the regular window is used.
+ */
+static size_t ring_window_map_size(void) {
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0 || RING_WINDOW_SIZE % (unsigned long)page != 0)
+        return 0;
+    return 2 * RING_WINDOW_SIZE + (size_t)page;
+}
+
+static unsigned char *ring_window_map(void) {
+    size_t map_size = ring_window_map_size();
+    unsigned char *ring;
+    int fd;
+
+    if (map_size == 0)
+        return NULL;
+    fd = memfd_create("zlib-ng-window", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    ring = NULL;
+    if (ftruncate(fd, RING_WINDOW_SIZE) == 0) {
+        ring = (unsigned char *)mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ring == MAP_FAILED) {
+            ring = NULL;
+        } else if (mmap(ring, RING_WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+                   mmap(ring + RING_WINDOW_SIZE, RING_WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            munmap(ring, map_size);
+            ring = NULL;
+        }
+    }
+    /* The mappings keep the memory alive */
+    close(fd);
+    return ring;
+}
+
+static void ring_window_unmap(unsigned char *ring) {
+    munmap(ring, ring_window_map_size());
+}
+#endif
+
 /* ===========================================================================
  * Allocate a big buffer and divide it up into the various buffers inflate needs.
  * Handles alignment of allocated buffer and alignment of individual buffers.
@@ -170,15 +254,15 @@ Z_INTERNAL inflate_allocs* alloc_inflate(PREFIX3(stream) *strm) {
     int alloc_pos = PAD_16(curr_size);
     curr_size = alloc_pos + alloc_size;
 
-    /* Add 64-1 or 4096-1 to allow window alignment, and round size of buffer up to multiple of 64 */
-    int total_size = PAD_64(curr_size + (WINDOW_PAD_SIZE - 1));
+    /* Round size of buffer up to multiple of 64 */
+    int total_size = PAD_64(curr_size);
 
-    /* Allocate buffer, align to 64-byte cacheline, and zerofill the resulting buffer */
-    char *original_buf = (char *)strm->zalloc(strm->opaque, 1, total_size);
-    if (original_buf == NULL)
+    /* Allocate buffer aligned to 64 bytes or 4096 bytes for the window */
+    char *original_buf;
+    char *buff = (char *)PREFIX(zalloc_aligned)(strm, total_size, WINDOW_PAD_SIZE, &original_buf);
+    if (buff == NULL)
         return NULL;
-
-    char *buff = (char *)HINT_ALIGNED_WINDOW((char *)PAD_WINDOW(original_buf));
+    buff = (char *)HINT_ALIGNED_WINDOW(buff);
     LOGSZPL("Buffer alloc", total_size, PADSZ((uintptr_t)original_buf,WINDOW_PAD_SIZE), PADSZ(curr_size,WINDOW_PAD_SIZE));
 
     /* Initialize alloc_bufs */
@@ -188,6 +272,9 @@ Z_INTERNAL inflate_allocs* alloc_inflate(PREFIX3(stream) *strm) {
 
     alloc_bufs->window =  (unsigned char *)HINT_ALIGNED_WINDOW((buff + window_pos));
     alloc_bufs->state = (inflate_state *)HINT_ALIGNED_64((buff + state_pos));
+#ifdef INFLATE_RING_WINDOW
+    alloc_bufs->ring = NULL;
+#endif
 
 #ifdef Z_MEMORY_SANITIZER
     /* This is _not_ to subvert the memory sanitizer but to instead unposion some
@@ -207,6 +294,10 @@ Z_INTERNAL void free_inflate(PREFIX3(stream) *strm) {
 
     if (state->alloc_bufs != NULL) {
         inflate_allocs *alloc_bufs = state->alloc_bufs;
+#ifdef INFLATE_RING_WINDOW
+        if (alloc_bufs->ring != NULL)
+            ring_window_unmap(alloc_bufs->ring);
+#endif
         alloc_bufs->zfree(strm->opaque, alloc_bufs->buf_start);
         strm->state = NULL;
     }
@@ -226,12 +317,7 @@ int32_t ZNG_CONDEXPORT PREFIX(inflateInit2)(PREFIX3(stream) *strm, int32_t windo
     if (strm == NULL)
         return Z_STREAM_ERROR;
     strm->msg = NULL;                   /* in case we return an error */
-    if (strm->zalloc == NULL) {
-        strm->zalloc = PREFIX(zcalloc);
-        strm->opaque = NULL;
-    }
-    if (strm->zfree == NULL)
-        strm->zfree = PREFIX(zcfree);
+    PREFIX(zdefault_alloc)(strm);
 
     inflate_allocs *alloc_bufs = alloc_inflate(strm);
     if (alloc_bufs == NULL)
@@ -329,8 +415,18 @@ static void updatewindow(PREFIX3(stream) *strm, const uint8_t *end, uint32_t len
     state = (struct inflate_state *)strm->state;
 
     /* if window not in use yet, initialize */
-    if (state->wsize == 0)
+    if (state->wsize == 0) {
         state->wsize = 1U << state->wbits;
+#ifdef INFLATE_RING_WINDOW
+        /* map the ring on first use, so streams that never need a window don't pay for it */
+        if (state->wsize == RING_WINDOW_SIZE && state->alloc_bufs->ring == NULL)
+            state->alloc_bufs->ring = ring_window_map();
+        if (state->wsize == RING_WINDOW_SIZE && state->alloc_bufs->ring != NULL)
+            state->window = state->alloc_bufs->ring;
+        else
+            state->window = state->alloc_bufs->window;
+#endif
+    }
 
     /* len state->wsize or less output bytes into the circular window */
     if (len >= state->wsize) {
@@ -348,6 +444,19 @@ static void updatewindow(PREFIX3(stream) *strm, const uint8_t *end, uint32_t len
         state->wnext = 0;
         state->whave = state->wsize;
     } else {
+#ifdef INFLATE_RING_WINDOW
+        if (INFLATE_RING(state)) {
+            /* Bytes written past the end of the window land at its start through the mirror */
+            if (INFLATE_NEED_CHECKSUM(strm) && cksum) {
+                inf_chksum_cpy(strm, state->window + state->wnext, end - len, len);
+            } else {
+                memcpy(state->window + state->wnext, end - len, len);
+            }
+            state->wnext = (state->wnext + len) & (state->wsize - 1);
+            state->whave = MIN(state->whave + len, state->wsize);
+            return;
+        }
+#endif
         dist = state->wsize - state->wnext;
         /* Only do this if the caller specifies to checksum bytes AND the platform requires
          * We need to maintain the correct order here for the checksum */
@@ -1077,6 +1186,11 @@ int32_t Z_EXPORT PREFIX(inflate)(PREFIX3(stream) *strm, int32_t flush) {
 #endif
                     break;
                 }
+#ifdef INFLATE_RING_WINDOW
+                if (INFLATE_RING(state)) {
+                    from = state->window + state->wsize + state->wnext - copy;
+                } else
+#endif
                 if (copy > state->wnext) {
                     copy -= state->wnext;
                     from = state->window + (state->wsize - copy);
@@ -1201,8 +1315,13 @@ int32_t Z_EXPORT PREFIX(inflate)(PREFIX3(stream) *strm, int32_t flush) {
 }
 
 int32_t Z_EXPORT PREFIX(inflateEnd)(PREFIX3(stream) *strm) {
+#ifndef ZLIB_COMPAT
+    if (inflateStateCheck(strm) && inflateHibernatedState(strm) == NULL)
+        return Z_STREAM_ERROR;
+#else
     if (inflateStateCheck(strm))
         return Z_STREAM_ERROR;
+#endif
 
     /* Free allocated buffers */
     free_inflate(strm);
@@ -1395,13 +1514,8 @@ int32_t Z_EXPORT PREFIX(inflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     copy = alloc_bufs->state;
 
     /* copy state */
-    memcpy(copy, state, sizeof(struct inflate_state));
+    copy_state(copy, state);
     copy->strm = dest;
-    if (state->lencode >= state->codes && state->lencode <= state->codes + ENOUGH - 1) {
-        copy->lencode = copy->codes + (state->lencode - state->codes);
-        copy->distcode = copy->codes + (state->distcode - state->codes);
-    }
-    copy->next = copy->codes + (state->next - state->codes);
     copy->window = alloc_bufs->window;
     copy->alloc_bufs = alloc_bufs;
 
@@ -1460,3 +1574,135 @@ unsigned long Z_EXPORT PREFIX(inflateCodesUsed)(PREFIX3(stream) *strm) {
     state = (struct inflate_state *)strm->state;
     return (unsigned long)(state->next - state->codes);
 }
+
+#ifndef ZLIB_COMPAT
+/* ===========================================================================
+ * Restore len bytes of window history compressed by zng_hibernate_pack().
+ */
+int32_t Z_INTERNAL zng_hibernate_unpack(zng_stream *strm, uint8_t *dst, uint32_t len, const uint8_t *src,
+                                        uint32_t packed_len) {
+    zng_stream tmp;
+    int32_t ret;
+
+    memset(&tmp, 0, sizeof(tmp));
+    tmp.zalloc = strm->zalloc;
+    tmp.zfree = strm->zfree;
+    tmp.opaque = strm->opaque;
+    ret = zng_inflateInit2(&tmp, -MAX_WBITS);
+    if (ret != Z_OK)
+        return ret;
+
+    tmp.next_in = src;
+    tmp.avail_in = packed_len;
+    tmp.next_out = dst;
+    tmp.avail_out = len;
+    ret = zng_inflate(&tmp, Z_FINISH);
+    if (ret == Z_STREAM_END && tmp.total_out == len)
+        ret = Z_OK;
+    else if (ret != Z_MEM_ERROR)
+        ret = Z_DATA_ERROR;
+    zng_inflateEnd(&tmp);
+    return ret;
+}
+int32_t Z_EXPORT zng_inflateHibernate(zng_stream *strm, int32_t flags) {
+    struct inflate_state *state, *copy;
+    inflate_hibernated *h;
+    uint8_t *packed = NULL;
+    uint32_t packed_len = 0, first;
+
+    if (inflateStateCheck(strm) || (flags & ~Z_HIBERNATE_COMPRESS) != 0)
+        return Z_STREAM_ERROR;
+#ifdef S390_DFLTCC_INFLATE
+    return Z_STREAM_ERROR;
+#endif
+    state = (struct inflate_state *)strm->state;
+
+    /* The window is only wrapped around once it is full, in which case the oldest byte is at wnext */
+    first = state->whave == state->wsize ? state->wsize - state->wnext : state->whave;
+    if ((flags & Z_HIBERNATE_COMPRESS) && state->whave > 0) {
+        packed = (uint8_t *)strm->zalloc(strm->opaque, 1, state->whave);
+        if (packed != NULL)
+            packed_len = zng_hibernate_pack(strm, packed, state->whave - 1, state->window + state->whave - first,
+                                            first, state->window, state->whave - first);
+    }
+
+    /* Allocate the state, followed by the hibernation record and the window bytes */
+    size_t data_size = packed_len ? packed_len : state->whave;
+    int hib_pos = PAD_16((int)sizeof(struct inflate_state));
+    int data_pos = hib_pos + (int)sizeof(inflate_hibernated);
+    char *original_buf;
+    char *buff = (char *)PREFIX(zalloc_aligned)(strm, PAD_64(data_pos + data_size), 64, &original_buf);
+    if (buff == NULL) {
+        if (packed != NULL)
+            strm->zfree(strm->opaque, packed);
+        return Z_MEM_ERROR;
+    }
+    buff = (char *)HINT_ALIGNED_64(buff);
+
+    copy = (struct inflate_state *)buff;
+    h = (inflate_hibernated *)(buff + hib_pos);
+    memset(h, 0, sizeof(inflate_hibernated));
+    h->allocs.buf_start = original_buf;
+    h->allocs.zfree = strm->zfree;
+    h->allocs.state = copy;
+    h->allocs.window = (unsigned char *)buff + data_pos;
+    h->mode = state->mode;
+    h->packed_len = packed_len;
+    if (packed_len) {
+        memcpy(h->allocs.window, packed, packed_len);
+    } else {
+        memcpy(h->allocs.window, state->window + state->whave - first, first);
+        memcpy(h->allocs.window + first, state->window, state->whave - first);
+    }
+    if (packed != NULL)
+        strm->zfree(strm->opaque, packed);
+
+    copy_state(copy, state);
+    copy->alloc_bufs = &h->allocs;
+    copy->window = h->allocs.window;
+    copy->mode = HIBERNATE;
+
+    free_inflate(strm);
+    strm->state = (struct internal_state *)copy;
+    return Z_OK;
+}
+
+int32_t Z_EXPORT zng_inflateWake(zng_stream *strm) {
+    inflate_hibernated *h = inflateHibernatedState(strm);
+    struct inflate_state *state, *copy;
+
+    if (h == NULL)
+        return Z_STREAM_ERROR;
+    copy = (struct inflate_state *)strm->state;
+
+    inflate_allocs *alloc_bufs = alloc_inflate(strm);
+    if (alloc_bufs == NULL)
+        return Z_MEM_ERROR;
+    state = alloc_bufs->state;
+
+    /* Restore the window bytes unwrapped, so the next byte goes after them */
+    if (h->packed_len) {
+        int32_t ret = zng_hibernate_unpack(strm, alloc_bufs->window, copy->whave, h->allocs.window, h->packed_len);
+        if (ret != Z_OK) {
+            /* Release the new buffers and stay hibernated */
+            state->alloc_bufs = alloc_bufs;
+            strm->state = (struct internal_state *)state;
+            free_inflate(strm);
+            strm->state = (struct internal_state *)copy;
+            return ret;
+        }
+    } else {
+        memcpy(alloc_bufs->window, h->allocs.window, copy->whave);
+    }
+
+    copy_state(state, copy);
+    state->alloc_bufs = alloc_bufs;
+    state->window = alloc_bufs->window;
+    state->wnext = state->whave == state->wsize ? 0 : state->whave;
+    state->mode = h->mode;
+
+    h->allocs.zfree(strm->opaque, h->allocs.buf_start);
+    strm->state = (struct internal_state *)state;
+    return Z_OK;
+}
+#endif
@@ -57,7 +57,8 @@ typedef enum {
     LENGTH,     /* i: waiting for 32-bit length (gzip) */
     DONE,       /* finished check, done -- remain here until reset */
     BAD,        /* got a data error -- remain here until reset */
-    SYNC        /* looking for synchronization bytes to restart inflate() */
+    SYNC,       /* looking for synchronization bytes to restart inflate() */
+    HIBERNATE   /* compacted by zng_inflateHibernate() -- remain here until woken */
 } inflate_mode;
 
 /*
@@ -83,6 +84,8 @@ typedef enum {
                 LIT -> LEN
     Process trailer:
         CHECK -> LENGTH -> DONE
+    Between inflate() calls:
+        (any) -> HIBERNATE -> (same)
  */
 typedef struct inflate_state inflate_state;
 
@@ -92,8 +95,18 @@ typedef struct inflate_allocs_s {
     free_func        zfree;
     inflate_state   *state;
     unsigned char   *window;
+#ifdef INFLATE_RING_WINDOW
+    unsigned char   *ring;      /* window mapped twice back to back on first use, or NULL */
+#endif
 } inflate_allocs;
 
+#ifdef INFLATE_RING_WINDOW
+#  define RING_WINDOW_SIZE (1U << MAX_WBITS)
+/* True if window + wsize aliases the start of the window, so that any wsize bytes
+   of history can be read contiguously without handling wraparound. */
+#  define INFLATE_RING(state) ((state)->window == (state)->alloc_bufs->ring && (state)->wsize == RING_WINDOW_SIZE)
+#endif
+
 /* State maintained between inflate() calls -- approximately 7K bytes, not
    including the allocated sliding window, which is up to 32K bytes. */
 struct ALIGNED_(64) inflate_state {
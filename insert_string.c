@@ -7,15 +7,16 @@
 
 #include "zbuild.h"
 #include "deflate.h"
+#include "insert_string_p.h"
 
-#define HASH_SLIDE           16
-
-#define HASH_CALC(h, val)    h = ((val * 2654435761U) >> HASH_SLIDE);
+#define HASH_CALC(h, val)    h = ((val * HASH_MULTIPLIER) >> HASH_SLIDE);
 #define HASH_CALC_VAR        h
 #define HASH_CALC_VAR_INIT   uint32_t h = 0
 
 #define UPDATE_HASH          update_hash
 #define INSERT_STRING        insert_string
 #define QUICK_INSERT_STRING  quick_insert_string
+#define INSERT_STRING_HEAD   insert_string_head
+#define QUICK_INSERT_HEAD    quick_insert_head
 
 #include "insert_string_tpl.h"
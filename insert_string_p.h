@@ -0,0 +1,28 @@
+/* insert_string_p.h -- Private inline functions and macros shared with the
+ *                      integer hash insert_string implementations
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef INSERT_STRING_P_H
+#define INSERT_STRING_P_H
+
+/* Multiplicative hash used by insert_string.c and the arch-specific batched
+ * insert_string variants. All of them share head[] with quick_insert_string,
+ * so they must compute exactly the same hash. */
+#define HASH_MULTIPLIER  2654435761U
+#define HASH_SLIDE       16
+
+/* ===========================================================================
+ * Link string at position idx, whose hash index hm has already been
+ * calculated, into its hash chain.
+ */
+static inline void insert_string_link(deflate_state *const s, uint32_t hm, Pos idx) {
+    Pos head = s->head[hm];
+    if (LIKELY(head != idx)) {
+        s->prev[idx & s->w_mask] = head;
+        s->head[hm] = idx;
+    }
+}
+
+#endif
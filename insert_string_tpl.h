@@ -110,4 +110,32 @@ Z_INTERNAL void INSERT_STRING(deflate_state *const s, uint32_t str, uint32_t cou
         }
     }
 }
+
+#ifdef QUICK_INSERT_HEAD
+/* ===========================================================================
+ * Same as QUICK_INSERT_STRING and INSERT_STRING, but only update head[]. Used
+ * by deflate_quick, which never walks the hash chains, and by streams that
+ * were allocated without prev[].
+ */
+Z_INTERNAL Pos QUICK_INSERT_HEAD(deflate_state *const s, uint32_t str) {
+    Pos head;
+    uint8_t *strstart = s->window + str + HASH_CALC_OFFSET;
+    uint32_t val, hm;
+
+    HASH_CALC_VAR_INIT;
+    HASH_CALC_READ;
+    HASH_CALC(HASH_CALC_VAR, val);
+    HASH_CALC_VAR &= HASH_CALC_MASK;
+    hm = HASH_CALC_VAR;
+
+    head = s->head[hm];
+    s->head[hm] = (Pos)str;
+    return head;
+}
+
+Z_INTERNAL void INSERT_STRING_HEAD(deflate_state *const s, uint32_t str, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        QUICK_INSERT_HEAD(s, str + i);
+}
+#endif
 #endif
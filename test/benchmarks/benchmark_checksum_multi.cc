@@ -0,0 +1,80 @@
+/* benchmark_checksum_multi.cc -- benchmark multi-buffer crc32 variants
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  include "arch_functions.h"
+#  include "../test_cpu_features.h"
+}
+
+#define MAX_RANDOM_INTS (1024 * 1024)
+#define MAX_RANDOM_INTS_SIZE (MAX_RANDOM_INTS * sizeof(uint32_t))
+
+class checksum_multi: public benchmark::Fixture {
+private:
+    uint32_t *random_ints;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        random_ints = (uint32_t *)zng_alloc(MAX_RANDOM_INTS_SIZE);
+        assert(random_ints != NULL);
+
+        for (int32_t i = 0; i < MAX_RANDOM_INTS; i++) {
+            random_ints[i] = rand();
+        }
+    }
+
+    /* Checksum CHECKSUM_MULTI_LANES buffers of state.range(0) bytes per iteration */
+    void Bench(benchmark::State& state, checksum_multi_func multi) {
+        const uint8_t *buf[CHECKSUM_MULTI_LANES];
+        size_t len[CHECKSUM_MULTI_LANES];
+        uint32_t hash[CHECKSUM_MULTI_LANES] = { 0 };
+
+        for (int i = 0; i < CHECKSUM_MULTI_LANES; i++) {
+            buf[i] = (const uint8_t *)random_ints + i * (MAX_RANDOM_INTS_SIZE / CHECKSUM_MULTI_LANES);
+            len[i] = (size_t)state.range(0);
+        }
+
+        for (auto _ : state) {
+            multi(hash, buf, len);
+        }
+
+        benchmark::DoNotOptimize(hash);
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(random_ints);
+    }
+};
+
+#define BENCHMARK_CHECKSUM_MULTI(name, fptr, support_flag) \
+    BENCHMARK_DEFINE_F(checksum_multi, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        Bench(state, fptr); \
+    } \
+    BENCHMARK_REGISTER_F(checksum_multi, name)->Arg(16)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1500)->Arg(4<<10);
+
+/* The generic variant calls the best single buffer function once per buffer */
+BENCHMARK_CHECKSUM_MULTI(crc32_generic, crc32_multi_c, 1);
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+BENCHMARK_CHECKSUM_MULTI(crc32_native, native_crc32_multi, 1);
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+BENCHMARK_CHECKSUM_MULTI(crc32_pclmulqdq, crc32_multi_pclmulqdq, test_cpu_features.x86.has_pclmulqdq);
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+BENCHMARK_CHECKSUM_MULTI(crc32_vpclmulqdq, crc32_multi_vpclmulqdq, (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq));
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/* benchmark_crc32c.cc -- benchmark crc32c variants
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <assert.h>
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  include "arch_functions.h"
+#  include "../test_cpu_features.h"
+}
+
+#define MAX_RANDOM_INTS (1024 * 1024)
+#define MAX_RANDOM_INTS_SIZE (MAX_RANDOM_INTS * sizeof(uint32_t))
+
+class crc32c: public benchmark::Fixture {
+private:
+    uint32_t *random_ints;
+
+public:
+    void SetUp(const ::benchmark::State& state) {
+        random_ints = (uint32_t *)zng_alloc(MAX_RANDOM_INTS_SIZE);
+        assert(random_ints != NULL);
+
+        for (int32_t i = 0; i < MAX_RANDOM_INTS; i++) {
+            random_ints[i] = rand();
+        }
+    }
+
+    void Bench(benchmark::State& state, crc32_func crc32c) {
+        uint32_t hash = 0;
+
+        for (auto _ : state) {
+            hash = crc32c(hash, (const unsigned char *)random_ints, (size_t)state.range(0));
+        }
+
+        benchmark::DoNotOptimize(hash);
+    }
+
+    void TearDown(const ::benchmark::State& state) {
+        zng_free(random_ints);
+    }
+};
+
+#define BENCHMARK_CRC32C(name, fptr, support_flag) \
+    BENCHMARK_DEFINE_F(crc32c, name)(benchmark::State& state) { \
+        if (!support_flag) { \
+            state.SkipWithError("CPU does not support " #name); \
+        } \
+        Bench(state, fptr); \
+    } \
+    BENCHMARK_REGISTER_F(crc32c, name)->Arg(1)->Arg(8)->Arg(12)->Arg(16)->Arg(32)->Arg(64)->Arg(512)->Arg(4<<10)->Arg(32<<10)->Arg(256<<10)->Arg(4096<<10);
+
+BENCHMARK_CRC32C(braid, crc32c_braid, 1);
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+BENCHMARK_CRC32C(native, native_crc32c, 1);
+#else
+
+#ifdef ARM_ACLE
+BENCHMARK_CRC32C(acle, crc32c_acle, test_cpu_features.arm.has_crc32);
+#endif
+#ifdef X86_PCLMULQDQ_CRC
+BENCHMARK_CRC32C(sse42, crc32c_sse42, (test_cpu_features.x86.has_sse42 && test_cpu_features.x86.has_pclmulqdq));
+#endif
+
+#endif
@@ -61,6 +61,25 @@ add_test(NAME makecrct
     -DIGNORE_LINE_ENDINGS=ON
     -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
 
+# Test generated crc32c tables match tables in source directory
+set(TEST_COMMAND ${MAKECRCT_COMMAND} "-c")
+add_test(NAME makecrct-crc32c
+    COMMAND ${CMAKE_COMMAND}
+    "-DCOMMAND=${TEST_COMMAND}"
+    -DOUTPUT=${PROJECT_BINARY_DIR}/Testing/Temporary/crc32c_braid_tbl._h
+    -DCOMPARE=${PROJECT_SOURCE_DIR}/crc32c_braid_tbl.h
+    -DIGNORE_LINE_ENDINGS=ON
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
+
+# Test generated crc64 tables match tables in source directory
+add_test(NAME makecrc64t
+    COMMAND ${CMAKE_COMMAND}
+    "-DCOMMAND=${MAKECRC64T_COMMAND}"
+    -DOUTPUT=${PROJECT_BINARY_DIR}/Testing/Temporary/crc64_tbl._h
+    -DCOMPARE=${PROJECT_SOURCE_DIR}/crc64_tbl.h
+    -DIGNORE_LINE_ENDINGS=ON
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/run-and-compare.cmake)
+
 # Test generated inflate tables match tables in source directory
 add_test(NAME makefixed
     COMMAND ${CMAKE_COMMAND}
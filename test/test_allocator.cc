@@ -0,0 +1,172 @@
+/* test_allocator.cc - Test aligned allocator interface for streams */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define ARENA_SIZE (1024 * 1024)
+
+/* Bump allocator that only releases memory on reset */
+typedef struct {
+    uint8_t *buf;
+    size_t used;
+    size_t allocs;
+    size_t max_align;
+    int misaligned;
+} arena;
+
+static void *arena_alloc(void *opaque, size_t size, size_t align) {
+    arena *a = (arena *)opaque;
+    size_t pos = (a->used + align - 1) & ~(align - 1);
+    if (pos + size > ARENA_SIZE)
+        return NULL;
+    a->used = pos + size;
+    a->allocs++;
+    if (align > a->max_align)
+        a->max_align = align;
+    if (((uintptr_t)(a->buf + pos) & (align - 1)) != 0)
+        a->misaligned = 1;
+    return a->buf + pos;
+}
+
+static void arena_reset(void *opaque) {
+    arena *a = (arena *)opaque;
+    a->used = 0;
+}
+
+/* Regular allocation functions, to check that streams that set their own are left alone */
+static void *plain_alloc(void *opaque, unsigned items, unsigned size) {
+    Z_UNUSED(opaque);
+    return malloc((size_t)items * size);
+}
+
+static void plain_free(void *opaque, void *ptr) {
+    Z_UNUSED(opaque);
+    free(ptr);
+}
+
+class allocator : public ::testing::Test {
+public:
+    uint8_t *raw;
+    arena a;
+    zng_allocator alloc;
+
+    void SetUp() {
+        memset(&a, 0, sizeof(a));
+        raw = (uint8_t *)malloc(ARENA_SIZE + 4096);
+        /* Align the arena itself so that aligned offsets give aligned pointers */
+        a.buf = raw + ((4096 - ((uintptr_t)raw & 4095)) & 4095);
+        alloc.alloc = arena_alloc;
+        alloc.free = NULL;
+        alloc.reset = arena_reset;
+        alloc.opaque = &a;
+    }
+
+    void TearDown() {
+        zng_setDefaultAllocator(NULL);
+        free(raw);
+    }
+
+    /* Compress and decompress hello with streams that are already set up for allocation */
+    void roundtrip(zng_stream *c_stream, zng_stream *d_stream) {
+        uint8_t compr[128], uncompr[128];
+        int32_t err;
+
+        err = zng_deflateInit(c_stream, Z_DEFAULT_COMPRESSION);
+        EXPECT_EQ(err, Z_OK);
+        c_stream->next_in = (z_const unsigned char *)hello;
+        c_stream->avail_in = hello_len;
+        c_stream->next_out = compr;
+        c_stream->avail_out = sizeof(compr);
+        err = zng_deflate(c_stream, Z_FINISH);
+        EXPECT_EQ(err, Z_STREAM_END);
+
+        err = zng_inflateInit(d_stream);
+        EXPECT_EQ(err, Z_OK);
+        d_stream->next_in = compr;
+        d_stream->avail_in = (uint32_t)c_stream->total_out;
+        d_stream->next_out = uncompr;
+        d_stream->avail_out = sizeof(uncompr);
+        err = zng_inflate(d_stream, Z_FINISH);
+        EXPECT_EQ(err, Z_STREAM_END);
+        EXPECT_EQ(d_stream->total_out, hello_len);
+        EXPECT_STREQ((char *)uncompr, hello);
+
+        err = zng_deflateEnd(c_stream);
+        EXPECT_EQ(err, Z_OK);
+        err = zng_inflateEnd(d_stream);
+        EXPECT_EQ(err, Z_OK);
+    }
+};
+
+TEST_F(allocator, stream) {
+    zng_stream c_stream, d_stream;
+
+    memset(&c_stream, 0, sizeof(c_stream));
+    memset(&d_stream, 0, sizeof(d_stream));
+    EXPECT_EQ(zng_setStreamAllocator(&c_stream, &alloc), Z_OK);
+    EXPECT_EQ(zng_setStreamAllocator(&d_stream, &alloc), Z_OK);
+
+    roundtrip(&c_stream, &d_stream);
+    /* One aligned block per stream, with no padding for alignment by hand */
+    EXPECT_EQ(a.allocs, 2);
+    EXPECT_GE(a.max_align, 64);
+    EXPECT_EQ(a.misaligned, 0);
+
+    EXPECT_EQ(zng_resetAllocator(&alloc), Z_OK);
+    EXPECT_EQ(a.used, 0);
+}
+
+TEST_F(allocator, default_allocator) {
+    zng_stream c_stream, d_stream;
+
+    EXPECT_EQ(zng_setDefaultAllocator(&alloc), Z_OK);
+
+    memset(&c_stream, 0, sizeof(c_stream));
+    memset(&d_stream, 0, sizeof(d_stream));
+    roundtrip(&c_stream, &d_stream);
+    EXPECT_EQ(a.allocs, 2);
+    EXPECT_EQ(zng_resetAllocator(NULL), Z_OK);
+
+    /* Streams with their own allocation functions are left alone */
+    memset(&c_stream, 0, sizeof(c_stream));
+    memset(&d_stream, 0, sizeof(d_stream));
+    c_stream.zalloc = d_stream.zalloc = plain_alloc;
+    c_stream.zfree = d_stream.zfree = plain_free;
+    roundtrip(&c_stream, &d_stream);
+    EXPECT_EQ(a.allocs, 2);
+
+    EXPECT_EQ(zng_setDefaultAllocator(NULL), Z_OK);
+    memset(&c_stream, 0, sizeof(c_stream));
+    memset(&d_stream, 0, sizeof(d_stream));
+    roundtrip(&c_stream, &d_stream);
+    EXPECT_EQ(a.allocs, 2);
+}
+
+TEST_F(allocator, errors) {
+    zng_allocator bad = alloc;
+    zng_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    bad.alloc = NULL;
+    EXPECT_EQ(zng_setStreamAllocator(&strm, &bad), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_setStreamAllocator(&strm, NULL), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_setDefaultAllocator(&bad), Z_STREAM_ERROR);
+    EXPECT_EQ(zng_resetAllocator(NULL), Z_STREAM_ERROR);
+    bad.alloc = alloc.alloc;
+    bad.reset = NULL;
+    EXPECT_EQ(zng_resetAllocator(&bad), Z_STREAM_ERROR);
+
+    /* Running out of arena memory is reported as usual */
+    a.used = ARENA_SIZE;
+    EXPECT_EQ(zng_setStreamAllocator(&strm, &alloc), Z_OK);
+    EXPECT_EQ(zng_deflateInit(&strm, Z_DEFAULT_COMPRESSION), Z_MEM_ERROR);
+}
@@ -0,0 +1,138 @@
+/* test_checksum_multi.cc -- multi-buffer crc32 and adler32 unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+#  ifndef ZLIB_COMPAT
+#    include "zlib-ng.h"
+#  endif
+}
+
+#include <gtest/gtest.h>
+
+#define LANE_SIZE 6000
+
+static uint32_t crc32_init(size_t i) {
+    return (uint32_t)(i * 0x9e3779b9);
+}
+
+class checksum_multi : public ::testing::Test {
+public:
+    uint8_t *buf;
+
+    void SetUp() {
+        buf = (uint8_t *)malloc(CHECKSUM_MULTI_LANES * LANE_SIZE);
+        for (size_t i = 0; i < CHECKSUM_MULTI_LANES * LANE_SIZE; i++)
+            buf[i] = (uint8_t)(rand() >> 7);
+    }
+
+    void TearDown() {
+        free(buf);
+    }
+
+    /* Compare every lane against the single buffer function, covering the folding and tail paths with
+       lanes of equal length and lanes that end at different blocks */
+    void hash(checksum_multi_func multi) {
+        static const size_t lens[] = { 16, 17, 31, 32, 63, 64, 65, 100, 127, 128, 255, 256, 319, 512, 1000,
+                                       5552, 5553, LANE_SIZE - 400 };
+        static const size_t spreads[] = { 0, 1, 15, 16, 64, 100 };
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            for (size_t s = 0; s < sizeof(spreads) / sizeof(spreads[0]); s++) {
+                for (size_t offset = 0; offset < 8; offset += 3) {
+                    const uint8_t *lane[CHECKSUM_MULTI_LANES];
+                    size_t len[CHECKSUM_MULTI_LANES];
+                    uint32_t check[CHECKSUM_MULTI_LANES];
+
+                    for (int j = 0; j < CHECKSUM_MULTI_LANES; j++) {
+                        lane[j] = buf + j * LANE_SIZE + offset + j;
+                        len[j] = lens[i] + ((j * 3 + 1) % CHECKSUM_MULTI_LANES) * spreads[s];
+                        check[j] = crc32_init(len[j] + j);
+                    }
+                    multi(check, lane, len);
+                    for (int j = 0; j < CHECKSUM_MULTI_LANES; j++) {
+                        EXPECT_EQ(check[j], PREFIX(crc32_braid)(crc32_init(len[j] + j), lane[j], len[j]))
+                            << "len " << len[j] << " offset " << offset << " lane " << j;
+                    }
+                }
+            }
+        }
+    }
+};
+
+#define TEST_CHECKSUM_MULTI(name, func, support_flag) \
+    TEST_F(checksum_multi, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func); \
+        memset(buf, 0xff, CHECKSUM_MULTI_LANES * LANE_SIZE); \
+        hash(func); \
+    }
+
+TEST_CHECKSUM_MULTI(crc32_generic, crc32_multi_c, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CHECKSUM_MULTI(crc32_native, native_crc32_multi, 1)
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CHECKSUM_MULTI(crc32_pclmulqdq, crc32_multi_pclmulqdq, test_cpu_features.x86.has_pclmulqdq)
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+TEST_CHECKSUM_MULTI(crc32_vpclmulqdq, crc32_multi_vpclmulqdq,
+                    (test_cpu_features.x86.has_pclmulqdq && test_cpu_features.x86.has_avx512_common &&
+                     test_cpu_features.x86.has_vpclmulqdq))
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+static uint32_t adler32_init(size_t i) {
+    return (uint32_t)((i * 7919) % 65521 | ((i * 104729) % 65521) << 16);
+}
+
+/* Buffers of different lengths, including short, empty and NULL ones, and a partial group at the end */
+TEST_F(checksum_multi, api) {
+    static const size_t lens[] = { 64, 300, 0, 17, 512, 1000, 5, 64, 64, 64, 64, 200, 1, 128, 700, 63, 256 };
+    const size_t count = sizeof(lens) / sizeof(lens[0]);
+    zng_iovec iov[count];
+    uint32_t crc[count], adler[count];
+    size_t off = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        iov[i].iov_base = buf + off;
+        iov[i].iov_len = lens[i];
+        off = (off + lens[i] + 13) % (CHECKSUM_MULTI_LANES * LANE_SIZE - 1000);
+    }
+    iov[9].iov_base = NULL;
+
+    for (size_t n = 0; n <= count; n++) {
+        for (size_t i = 0; i < count; i++) {
+            crc[i] = crc32_init(i);
+            adler[i] = adler32_init(i);
+        }
+        zng_crc32_multi(crc, iov, n);
+        zng_adler32_multi(adler, iov, n);
+        for (size_t i = 0; i < count; i++) {
+            if (i < n) {
+                EXPECT_EQ(crc[i], zng_crc32_z(crc32_init(i), (const uint8_t *)iov[i].iov_base, iov[i].iov_len))
+                    << "count " << n << " buffer " << i;
+                EXPECT_EQ(adler[i], zng_adler32_z(adler32_init(i), (const uint8_t *)iov[i].iov_base, iov[i].iov_len))
+                    << "count " << n << " buffer " << i;
+            } else {
+                EXPECT_EQ(crc[i], crc32_init(i));
+                EXPECT_EQ(adler[i], adler32_init(i));
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,57 @@
+/* test_checksum_parallel.cc - Test zng_crc32_parallel() and zng_adler32_parallel() against the serial checksums */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (256 * 1024 + 123)
+#define MIN_CHUNK 1000
+
+class checksum_parallel : public ::testing::Test {
+public:
+    uint8_t *buf;
+
+    void SetUp() {
+        buf = (uint8_t *)malloc(DATA_SIZE);
+        for (size_t i = 0; i < DATA_SIZE; i++)
+            buf[i] = (uint8_t)(rand() >> 7);
+    }
+
+    void TearDown() {
+        free(buf);
+    }
+};
+
+/* Cover lengths below, at and above the minimum chunk size, and chunks that are not a multiple of
+   the cache line size */
+static const size_t lens[] = { 0, 1, 999, 1000, 1001, 4096, 10000, 65536 + 17, DATA_SIZE };
+
+TEST_F(checksum_parallel, crc32) {
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        for (unsigned threads = 0; threads <= 8; threads++) {
+            uint32_t init = (uint32_t)(lens[i] * 0x9e3779b9);
+            EXPECT_EQ(zng_crc32_parallel(init, buf, lens[i], threads, MIN_CHUNK), zng_crc32_z(init, buf, lens[i]))
+                << "len " << lens[i] << " threads " << threads;
+        }
+    }
+    EXPECT_EQ(zng_crc32_parallel(0, buf, DATA_SIZE, 0, 0), zng_crc32_z(0, buf, DATA_SIZE));
+    EXPECT_EQ(zng_crc32_parallel(0, buf, DATA_SIZE, 1000, 1), zng_crc32_z(0, buf, DATA_SIZE));
+    EXPECT_EQ(zng_crc32_parallel(0x1234, NULL, 100, 4, MIN_CHUNK), 0);
+}
+
+TEST_F(checksum_parallel, adler32) {
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        for (unsigned threads = 0; threads <= 8; threads++) {
+            uint32_t init = (uint32_t)(lens[i] % 65521 + ((lens[i] * 7) % 65521 << 16));
+            EXPECT_EQ(zng_adler32_parallel(init, buf, lens[i], threads, MIN_CHUNK), zng_adler32_z(init, buf, lens[i]))
+                << "len " << lens[i] << " threads " << threads;
+        }
+    }
+    EXPECT_EQ(zng_adler32_parallel(1, buf, DATA_SIZE, 0, 0), zng_adler32_z(1, buf, DATA_SIZE));
+    EXPECT_EQ(zng_adler32_parallel(1, buf, DATA_SIZE, 1000, 1), zng_adler32_z(1, buf, DATA_SIZE));
+    EXPECT_EQ(zng_adler32_parallel(0x1234, NULL, 100, 4, MIN_CHUNK), 1);
+}
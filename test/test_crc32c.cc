@@ -0,0 +1,158 @@
+/* test_crc32c.cc -- crc32c unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+#  ifndef ZLIB_COMPAT
+#    include "zlib-ng.h"
+#  endif
+}
+
+#include <gtest/gtest.h>
+
+/* Long enough for the three-way interleaving of the hardware variants */
+#define LONG_SIZE (3 * 8192 * 2 + 3 * 256 + 77)
+
+typedef uint32_t (*crc32c_copy_func)(uint32_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+
+/* Bit at a time reference implementation */
+static uint32_t crc32c_bitwise(uint32_t crc, const uint8_t *buf, size_t len) {
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (int k = 0; k < 8; k++)
+            crc = crc & 1 ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+    }
+    return ~crc;
+}
+
+class crc32c_variant : public ::testing::Test {
+public:
+    uint8_t *buf;
+    uint8_t *dst;
+
+    void SetUp() {
+        buf = (uint8_t *)malloc(LONG_SIZE);
+        dst = (uint8_t *)malloc(LONG_SIZE);
+        for (size_t i = 0; i < LONG_SIZE; i++)
+            buf[i] = (uint8_t)(rand() >> 7);
+    }
+
+    void TearDown() {
+        free(dst);
+        free(buf);
+    }
+
+    /* Test vectors from RFC 3720, appendix B.4 */
+    void known_values(crc32_func crc32c) {
+        uint8_t data[32];
+
+        EXPECT_EQ(crc32c(0, (const uint8_t *)"123456789", 9), 0xe3069283);
+        memset(data, 0, sizeof(data));
+        EXPECT_EQ(crc32c(0, data, sizeof(data)), 0x8a9136aa);
+        memset(data, 0xff, sizeof(data));
+        EXPECT_EQ(crc32c(0, data, sizeof(data)), 0x62a8ab43);
+        for (int i = 0; i < 32; i++)
+            data[i] = (uint8_t)i;
+        EXPECT_EQ(crc32c(0, data, sizeof(data)), 0x46dd794e);
+        for (int i = 0; i < 32; i++)
+            data[i] = (uint8_t)(31 - i);
+        EXPECT_EQ(crc32c(0, data, sizeof(data)), 0x113fdb5c);
+    }
+
+    /* Compare against the reference for all alignments and a spread of lengths */
+    void hash(crc32_func crc32c) {
+        static const size_t lens[] = { 0, 1, 7, 8, 9, 63, 767, 768, 769, 3000, 24575, 24576, 24577 };
+
+        known_values(crc32c);
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            for (size_t offset = 0; offset < 8; offset++) {
+                uint32_t init = (uint32_t)(lens[i] * 0x9e3779b9);
+                EXPECT_EQ(crc32c(init, buf + offset, lens[i]), crc32c_bitwise(init, buf + offset, lens[i]))
+                    << "len " << lens[i] << " offset " << offset;
+            }
+        }
+        EXPECT_EQ(crc32c(0, buf, LONG_SIZE), crc32c_bitwise(0, buf, LONG_SIZE));
+    }
+
+    void hash_copy(crc32c_copy_func crc32c_copy) {
+        static const size_t lens[] = { 0, 5, 768, 24577, LONG_SIZE - 8 };
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            for (size_t offset = 0; offset < 8; offset += 3) {
+                memset(dst, 0, LONG_SIZE);
+                EXPECT_EQ(crc32c_copy(1, dst + offset, buf + offset, lens[i]), crc32c_bitwise(1, buf + offset, lens[i]));
+                EXPECT_EQ(memcmp(dst + offset, buf + offset, lens[i]), 0);
+                if (offset + lens[i] < LONG_SIZE) {
+                    EXPECT_EQ(dst[offset + lens[i]], 0);
+                }
+            }
+        }
+    }
+};
+
+#define TEST_CRC32C(name, func, support_flag) \
+    TEST_F(crc32c_variant, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func); \
+    }
+
+#define TEST_CRC32C_COPY(name, func, support_flag) \
+    TEST_F(crc32c_variant, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash_copy(func); \
+    }
+
+TEST_CRC32C(braid, crc32c_braid, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CRC32C(native, native_crc32c, 1)
+TEST_CRC32C_COPY(native_copy, native_crc32c_fold_copy, 1)
+#else
+
+#ifdef ARM_ACLE
+TEST_CRC32C(acle, crc32c_acle, test_cpu_features.arm.has_crc32)
+#endif
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CRC32C(sse42, crc32c_sse42, (test_cpu_features.x86.has_sse42 && test_cpu_features.x86.has_pclmulqdq))
+TEST_CRC32C_COPY(sse42_copy, crc32c_fold_copy_sse42, (test_cpu_features.x86.has_sse42 && test_cpu_features.x86.has_pclmulqdq))
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+TEST(crc32c, api) {
+    uint8_t src[1000], dst[1000];
+    uint32_t crc1, crc2, whole;
+
+    for (size_t i = 0; i < sizeof(src); i++)
+        src[i] = (uint8_t)(i * 7 + (i >> 3));
+
+    EXPECT_EQ(zng_crc32c(0, NULL, 0), 0);
+    EXPECT_EQ(zng_crc32c_copy(0, NULL, NULL, 0), 0);
+    whole = zng_crc32c(0, src, sizeof(src));
+    EXPECT_EQ(whole, crc32c_bitwise(0, src, sizeof(src)));
+
+    EXPECT_EQ(zng_crc32c_copy(0, dst, src, sizeof(src)), whole);
+    EXPECT_EQ(memcmp(dst, src, sizeof(src)), 0);
+
+    for (size_t split = 0; split <= sizeof(src); split += 111) {
+        crc1 = zng_crc32c(0, src, split);
+        crc2 = zng_crc32c(0, src + split, sizeof(src) - split);
+        EXPECT_EQ(zng_crc32c_combine(crc1, crc2, (z_off64_t)(sizeof(src) - split)), whole);
+    }
+}
+#endif
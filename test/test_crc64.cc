@@ -0,0 +1,169 @@
+/* test_crc64.cc -- crc64 unit test
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+#  ifndef ZLIB_COMPAT
+#    include "zlib-ng.h"
+#  endif
+}
+
+#include <gtest/gtest.h>
+
+#define LONG_SIZE (4 * 256 * 3 + 64 + 48 + 15)
+
+#define POLY_XZ   0xc96c5795d7870f42
+#define POLY_NVME 0x9a6c9329ac4bc9b5
+
+typedef uint64_t (*crc64_copy_func)(uint64_t crc, uint8_t *dst, const uint8_t *src, size_t len);
+
+/* Bit at a time reference implementation */
+static uint64_t crc64_bitwise(uint64_t poly, uint64_t crc, const uint8_t *buf, size_t len) {
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (int k = 0; k < 8; k++)
+            crc = crc & 1 ? (crc >> 1) ^ poly : crc >> 1;
+    }
+    return ~crc;
+}
+
+class crc64_variant : public ::testing::Test {
+public:
+    uint8_t *buf;
+    uint8_t *dst;
+
+    void SetUp() {
+        buf = (uint8_t *)malloc(LONG_SIZE);
+        dst = (uint8_t *)malloc(LONG_SIZE);
+        for (size_t i = 0; i < LONG_SIZE; i++)
+            buf[i] = (uint8_t)(rand() >> 7);
+    }
+
+    void TearDown() {
+        free(dst);
+        free(buf);
+    }
+
+    /* Compare against the check value and the reference, covering every path of the folding loops */
+    void hash(crc64_func crc64, uint64_t poly, uint64_t check) {
+        static const size_t lens[] = { 0, 1, 7, 15, 16, 63, 64, 65, 127, 128, 255, 256, 257, 319, 511, 512,
+                                       1000, 1024 + 48 + 15, LONG_SIZE - 8 };
+
+        EXPECT_EQ(crc64(0, (const uint8_t *)"123456789", 9), check);
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            for (size_t offset = 0; offset < 8; offset++) {
+                uint64_t init = (uint64_t)lens[i] * 0x9e3779b97f4a7c15;
+                EXPECT_EQ(crc64(init, buf + offset, lens[i]), crc64_bitwise(poly, init, buf + offset, lens[i]))
+                    << "len " << lens[i] << " offset " << offset;
+            }
+        }
+    }
+
+    void hash_copy(crc64_copy_func crc64_copy, uint64_t poly) {
+        static const size_t lens[] = { 0, 5, 64, 100, 256, 1000, LONG_SIZE - 8 };
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+            for (size_t offset = 0; offset < 8; offset += 3) {
+                memset(dst, 0, LONG_SIZE);
+                EXPECT_EQ(crc64_copy(1, dst + offset, buf + offset, lens[i]), crc64_bitwise(poly, 1, buf + offset, lens[i]));
+                EXPECT_EQ(memcmp(dst + offset, buf + offset, lens[i]), 0);
+                if (offset + lens[i] < LONG_SIZE) {
+                    EXPECT_EQ(dst[offset + lens[i]], 0);
+                }
+            }
+        }
+    }
+};
+
+#define TEST_CRC64(name, func, func_copy, func_nvme, func_nvme_copy, support_flag) \
+    TEST_F(crc64_variant, name) { \
+        if (!(support_flag)) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        hash(func, POLY_XZ, 0x995dc9bbdf1939fa); \
+        hash_copy(func_copy, POLY_XZ); \
+        hash(func_nvme, POLY_NVME, 0xae8b14860a799888); \
+        hash_copy(func_nvme_copy, POLY_NVME); \
+    }
+
+TEST_CRC64(generic, crc64_c, crc64_fold_copy_c, crc64_nvme_c, crc64_nvme_fold_copy_c, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_CRC64(native, native_crc64, native_crc64_fold_copy, native_crc64_nvme, native_crc64_nvme_fold_copy, 1)
+#else
+
+#ifdef X86_PCLMULQDQ_CRC
+TEST_CRC64(pclmulqdq, crc64_pclmulqdq, crc64_fold_copy_pclmulqdq, crc64_nvme_pclmulqdq,
+           crc64_nvme_fold_copy_pclmulqdq, test_cpu_features.x86.has_pclmulqdq)
+#endif
+#ifdef X86_VPCLMULQDQ_CRC
+TEST_CRC64(vpclmulqdq, crc64_vpclmulqdq, crc64_fold_copy_vpclmulqdq, crc64_nvme_vpclmulqdq,
+           crc64_nvme_fold_copy_vpclmulqdq, (test_cpu_features.x86.has_pclmulqdq &&
+           test_cpu_features.x86.has_avx512_common && test_cpu_features.x86.has_vpclmulqdq))
+#endif
+
+#endif
+
+#ifndef ZLIB_COMPAT
+static void test_api(crc64_func crc64, crc64_copy_func crc64_copy,
+                     uint64_t (*crc64_combine)(uint64_t, uint64_t, z_off64_t), uint64_t poly) {
+    uint8_t src[1000], dst[1000];
+    uint64_t crc1, crc2, whole;
+
+    for (size_t i = 0; i < sizeof(src); i++)
+        src[i] = (uint8_t)(i * 7 + (i >> 3));
+
+    EXPECT_EQ(crc64(0, NULL, 0), 0);
+    EXPECT_EQ(crc64_copy(0, NULL, NULL, 0), 0);
+    whole = crc64(0, src, sizeof(src));
+    EXPECT_EQ(whole, crc64_bitwise(poly, 0, src, sizeof(src)));
+
+    EXPECT_EQ(crc64_copy(0, dst, src, sizeof(src)), whole);
+    EXPECT_EQ(memcmp(dst, src, sizeof(src)), 0);
+
+    for (size_t split = 0; split <= sizeof(src); split += 111) {
+        crc1 = crc64(0, src, split);
+        crc2 = crc64(0, src + split, sizeof(src) - split);
+        EXPECT_EQ(crc64_combine(crc1, crc2, (z_off64_t)(sizeof(src) - split)), whole);
+    }
+}
+
+TEST(crc64, api) {
+    test_api(zng_crc64, zng_crc64_copy, zng_crc64_combine, POLY_XZ);
+}
+
+TEST(crc64, api_nvme) {
+    test_api(zng_crc64_nvme, zng_crc64_nvme_copy, zng_crc64_nvme_combine, POLY_NVME);
+}
+
+/* Combining is associative, which also holds for lengths far beyond any real buffer */
+TEST(crc64, combine_long) {
+    const z_off64_t len1 = ((z_off64_t)1 << 61) + 12345, len2 = ((z_off64_t)1 << 61) + 7;
+    const uint64_t a = 0x0123456789abcdef, b = 0xfedcba9876543210, c = 0x5555aaaa3333cccc;
+
+    EXPECT_EQ(zng_crc64_combine(zng_crc64_combine(a, b, len1), c, len2),
+              zng_crc64_combine(a, zng_crc64_combine(b, c, len2), len1 + len2));
+    EXPECT_EQ(zng_crc64_nvme_combine(zng_crc64_nvme_combine(a, b, len1), c, len2),
+              zng_crc64_nvme_combine(a, zng_crc64_nvme_combine(b, c, len2), len1 + len2));
+}
+
+/* A length that is not positive adds nothing to crc1, rather than running off the end of the table */
+TEST(crc64, combine_negative) {
+    const uint64_t a = 0x0123456789abcdef, b = 0xfedcba9876543210;
+    const z_off64_t lens[] = { 0, -1, -2, -12345, -((z_off64_t)1 << 30) };
+
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        EXPECT_EQ(zng_crc64_combine(a, b, lens[i]), a ^ b) << lens[i];
+        EXPECT_EQ(zng_crc64_nvme_combine(a, b, lens[i]), a ^ b) << lens[i];
+    }
+}
+#endif
@@ -0,0 +1,171 @@
+/* test_deflate_alloc.cc - Test allocation of deflate hash tables by level and strategy */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deflate.h"
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define INPUT_SIZE (96 * 1024)
+#define CHUNK_SIZE (16 * 1024)
+
+static void make_input(uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++)
+        buf[i] = (i % 61 == 0) ? (uint8_t)(i * 13) : (uint8_t)hello[(i / 3) % hello_len];
+}
+
+static void expect_tables(PREFIX3(stream) *strm, bool head, bool prev) {
+#ifdef S390_DFLTCC_DEFLATE
+    head = prev = true;
+#endif
+    deflate_state *s = (deflate_state *)strm->state;
+    EXPECT_EQ(s->head != NULL, head);
+    EXPECT_EQ(s->prev != NULL, prev);
+}
+
+TEST(deflate_alloc, tables_by_level) {
+    PREFIX3(stream) c_stream;
+    static const struct {
+        int level, strategy;
+        bool head, prev;
+    } cases[] = {
+        { 0, Z_DEFAULT_STRATEGY, false, false },
+#ifndef NO_QUICK_STRATEGY
+        { 1, Z_DEFAULT_STRATEGY, true, false },
+#endif
+        { 2, Z_DEFAULT_STRATEGY, true, true },
+        { 6, Z_DEFAULT_STRATEGY, true, true },
+        { 9, Z_FILTERED, true, true },
+        { 6, Z_HUFFMAN_ONLY, false, false },
+        { 6, Z_RLE, false, false },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        memset(&c_stream, 0, sizeof(c_stream));
+        EXPECT_EQ(PREFIX(deflateInit2)(&c_stream, cases[i].level, Z_DEFLATED, MAX_WBITS, DEF_MEM_LEVEL,
+                                       cases[i].strategy), Z_OK);
+        expect_tables(&c_stream, cases[i].head, cases[i].prev);
+        EXPECT_EQ(PREFIX(deflateEnd)(&c_stream), Z_OK);
+    }
+}
+
+/* Switch levels and strategies between chunks of input, growing the tables along the way */
+TEST(deflate_alloc, grow_on_params) {
+    static const int steps[][2] = {
+        { 0, Z_DEFAULT_STRATEGY }, { 6, Z_RLE }, { 1, Z_DEFAULT_STRATEGY }, { 0, Z_DEFAULT_STRATEGY },
+        { 9, Z_DEFAULT_STRATEGY }, { 1, Z_HUFFMAN_ONLY }
+    };
+    PREFIX3(stream) c_stream, d_stream;
+    uint8_t *input = (uint8_t *)malloc(INPUT_SIZE);
+    uint8_t *compr = (uint8_t *)malloc(2 * INPUT_SIZE);
+    uint8_t *uncompr = (uint8_t *)malloc(INPUT_SIZE);
+    size_t offset = 0;
+    int err;
+
+    make_input(input, INPUT_SIZE);
+    memset(&c_stream, 0, sizeof(c_stream));
+    err = PREFIX(deflateInit2)(&c_stream, steps[0][0], Z_DEFLATED, MAX_WBITS, DEF_MEM_LEVEL, steps[0][1]);
+    EXPECT_EQ(err, Z_OK);
+    expect_tables(&c_stream, false, false);
+
+    c_stream.next_out = compr;
+    c_stream.avail_out = 2 * INPUT_SIZE;
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        if (i > 0) {
+            err = PREFIX(deflateParams)(&c_stream, steps[i][0], steps[i][1]);
+            EXPECT_EQ(err, Z_OK);
+        }
+        c_stream.next_in = input + offset;
+        c_stream.avail_in = CHUNK_SIZE;
+        err = PREFIX(deflate)(&c_stream, Z_NO_FLUSH);
+        EXPECT_EQ(err, Z_OK);
+        EXPECT_EQ(c_stream.avail_in, 0);
+        offset += CHUNK_SIZE;
+    }
+    /* Tables are kept once grown */
+    expect_tables(&c_stream, true, true);
+    err = PREFIX(deflate)(&c_stream, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    err = PREFIX(deflateEnd)(&c_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    memset(&d_stream, 0, sizeof(d_stream));
+    err = PREFIX(inflateInit)(&d_stream);
+    EXPECT_EQ(err, Z_OK);
+    d_stream.next_in = compr;
+    d_stream.avail_in = (uint32_t)c_stream.total_out;
+    d_stream.next_out = uncompr;
+    d_stream.avail_out = INPUT_SIZE;
+    err = PREFIX(inflate)(&d_stream, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(d_stream.total_out, offset);
+    EXPECT_EQ(memcmp(input, uncompr, offset), 0);
+    err = PREFIX(inflateEnd)(&d_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    free(uncompr);
+    free(compr);
+    free(input);
+}
+
+/* A dictionary set at level 0 is still used for matches after switching to a higher level */
+TEST(deflate_alloc, dictionary_before_grow) {
+    PREFIX3(stream) c_stream, d_stream, copy;
+    uint8_t input[1024], compr[2048], uncompr[1024];
+    int err;
+
+    make_input(input, sizeof(input));
+    memset(&c_stream, 0, sizeof(c_stream));
+    err = PREFIX(deflateInit2)(&c_stream, 0, Z_DEFLATED, -MAX_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    EXPECT_EQ(err, Z_OK);
+    err = PREFIX(deflateSetDictionary)(&c_stream, input, sizeof(input));
+    EXPECT_EQ(err, Z_OK);
+
+    /* Copies keep the tables of their source */
+    err = PREFIX(deflateCopy)(&copy, &c_stream);
+    EXPECT_EQ(err, Z_OK);
+    expect_tables(&copy, false, false);
+    err = PREFIX(deflateEnd)(&copy);
+    EXPECT_EQ(err, Z_OK);
+
+    err = PREFIX(deflateParams)(&c_stream, 6, Z_DEFAULT_STRATEGY);
+    EXPECT_EQ(err, Z_OK);
+    expect_tables(&c_stream, true, true);
+
+    c_stream.next_in = input;
+    c_stream.avail_in = sizeof(input);
+    c_stream.next_out = compr;
+    c_stream.avail_out = sizeof(compr);
+    err = PREFIX(deflate)(&c_stream, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_LT(c_stream.total_out, 64);
+    err = PREFIX(deflateEnd)(&c_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    memset(&d_stream, 0, sizeof(d_stream));
+    err = PREFIX(inflateInit2)(&d_stream, -MAX_WBITS);
+    EXPECT_EQ(err, Z_OK);
+    err = PREFIX(inflateSetDictionary)(&d_stream, input, sizeof(input));
+    EXPECT_EQ(err, Z_OK);
+    d_stream.next_in = compr;
+    d_stream.avail_in = (uint32_t)c_stream.total_out;
+    d_stream.next_out = uncompr;
+    d_stream.avail_out = sizeof(uncompr);
+    err = PREFIX(inflate)(&d_stream, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(memcmp(input, uncompr, sizeof(input)), 0);
+    err = PREFIX(inflateEnd)(&d_stream);
+    EXPECT_EQ(err, Z_OK);
+}
@@ -0,0 +1,82 @@
+/* test_deflate_direct_output.cc - Test deflate() writing directly into large output buffers */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define INPUT_SIZE (1024 * 1024)
+
+class deflate_direct_output : public ::testing::TestWithParam<std::tuple<int, uint32_t>> {
+};
+
+TEST_P(deflate_direct_output, roundtrip) {
+    PREFIX3(stream) c_stream;
+    int level = std::get<0>(GetParam());
+    uint32_t chunk = std::get<1>(GetParam());
+    uint8_t *input, *compr, *uncompr;
+    z_uintmax_t compr_len, uncompr_len;
+    int err;
+
+    input = (uint8_t *)malloc(INPUT_SIZE);
+    ASSERT_TRUE(input != NULL);
+    /* Mix runs, repeated text and noise so that all block types are emitted */
+    for (uint32_t i = 0; i < INPUT_SIZE; i++) {
+        if ((i >> 12) % 3 == 0)
+            input[i] = (uint8_t)rand();
+        else if ((i >> 12) % 3 == 1)
+            input[i] = (uint8_t)hello[i % hello_len];
+        else
+            input[i] = (uint8_t)(i >> 8);
+    }
+
+    compr_len = PREFIX(compressBound)(INPUT_SIZE);
+    compr = (uint8_t *)malloc((size_t)compr_len);
+    ASSERT_TRUE(compr != NULL);
+
+    memset(&c_stream, 0, sizeof(c_stream));
+    err = PREFIX(deflateInit)(&c_stream, level);
+    EXPECT_EQ(err, Z_OK);
+
+    c_stream.next_in = input;
+    c_stream.avail_in = INPUT_SIZE;
+    c_stream.next_out = compr;
+
+    /* Output buffers both above and below the size of the pending buffer */
+    do {
+        c_stream.avail_out = (uint32_t)MIN(chunk, compr_len - c_stream.total_out);
+        err = PREFIX(deflate)(&c_stream, Z_FINISH);
+    } while (err == Z_OK);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(c_stream.next_out, compr + c_stream.total_out);
+
+    err = PREFIX(deflateEnd)(&c_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    uncompr_len = INPUT_SIZE;
+    uncompr = (uint8_t *)malloc(INPUT_SIZE);
+    ASSERT_TRUE(uncompr != NULL);
+
+    err = PREFIX(uncompress)(uncompr, &uncompr_len, compr, (z_uintmax_t)c_stream.total_out);
+    EXPECT_EQ(err, Z_OK);
+    EXPECT_EQ(uncompr_len, INPUT_SIZE);
+    EXPECT_EQ(memcmp(input, uncompr, INPUT_SIZE), 0);
+
+    free(input);
+    free(compr);
+    free(uncompr);
+}
+
+INSTANTIATE_TEST_SUITE_P(deflate, deflate_direct_output,
+    testing::Combine(testing::Range(1, 10), testing::Values(1000u, 65536u + 7u, 200000u, UINT32_MAX)));
@@ -0,0 +1,133 @@
+/* test_deflate_lit_mem.cc - Test selecting the deflate symbol buffer layout per stream */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define INPUT_SIZE (128 * 1024)
+
+static int32_t set_lit_mem(zng_stream *strm, int lit_mem) {
+    zng_deflate_param_value param;
+    param.param = Z_DEFLATE_LIT_MEM;
+    param.buf = &lit_mem;
+    param.size = sizeof(lit_mem);
+    return zng_deflateSetParams(strm, &param, 1);
+}
+
+static int get_lit_mem(zng_stream *strm) {
+    zng_deflate_param_value param;
+    int lit_mem = -1;
+    param.param = Z_DEFLATE_LIT_MEM;
+    param.buf = &lit_mem;
+    param.size = sizeof(lit_mem);
+    EXPECT_EQ(zng_deflateGetParams(strm, &param, 1), Z_OK);
+    return lit_mem;
+}
+
+class deflate_lit_mem : public ::testing::TestWithParam<std::tuple<int, int>> {
+public:
+    uint8_t *input, *compr, *uncompr;
+    size_t compr_size, live_bytes;
+
+    void SetUp() {
+        live_bytes = 0;
+        compr_size = INPUT_SIZE * 2;
+        input = (uint8_t *)malloc(INPUT_SIZE);
+        compr = (uint8_t *)malloc(compr_size);
+        uncompr = (uint8_t *)malloc(INPUT_SIZE);
+        for (size_t i = 0; i < INPUT_SIZE; i++)
+            input[i] = (i % 53 == 0) ? (uint8_t)(i * 31) : (uint8_t)hello[(i / 5) % hello_len];
+    }
+
+    void TearDown() {
+        free(uncompr);
+        free(compr);
+        free(input);
+        EXPECT_EQ(live_bytes, 0);
+    }
+
+    /* Compress the input with the given layout, in small pieces to go through several blocks */
+    size_t compress(int level, int mem_level, int lit_mem, size_t *stream_bytes) {
+        zng_stream c_stream;
+        int32_t err;
+
+        memset(&c_stream, 0, sizeof(c_stream));
+        c_stream.zalloc = counting_alloc;
+        c_stream.zfree = counting_free;
+        c_stream.opaque = &live_bytes;
+        err = zng_deflateInit2(&c_stream, level, Z_DEFLATED, MAX_WBITS, mem_level, Z_DEFAULT_STRATEGY);
+        EXPECT_EQ(err, Z_OK);
+        err = set_lit_mem(&c_stream, lit_mem);
+        EXPECT_EQ(err, Z_OK);
+        EXPECT_EQ(get_lit_mem(&c_stream), lit_mem);
+        *stream_bytes = live_bytes;
+
+        c_stream.next_out = compr;
+        c_stream.avail_out = (uint32_t)compr_size;
+        for (size_t offset = 0; offset < INPUT_SIZE; offset += 4096) {
+            c_stream.next_in = input + offset;
+            c_stream.avail_in = 4096;
+            err = zng_deflate(&c_stream, offset + 4096 < INPUT_SIZE ? Z_NO_FLUSH : Z_FINISH);
+            EXPECT_EQ(err, offset + 4096 < INPUT_SIZE ? Z_OK : Z_STREAM_END);
+        }
+        err = zng_deflateEnd(&c_stream);
+        EXPECT_EQ(err, Z_OK);
+        return (size_t)c_stream.total_out;
+    }
+
+    void verify(size_t compr_len) {
+        size_t uncompr_len = INPUT_SIZE;
+        EXPECT_EQ(zng_uncompress(uncompr, &uncompr_len, compr, compr_len), Z_OK);
+        EXPECT_EQ(uncompr_len, INPUT_SIZE);
+        EXPECT_EQ(memcmp(input, uncompr, INPUT_SIZE), 0);
+    }
+};
+
+TEST_P(deflate_lit_mem, roundtrip) {
+    int level = std::get<0>(GetParam());
+    int mem_level = std::get<1>(GetParam());
+    size_t separate_bytes, interleaved_bytes;
+    size_t separate_len, interleaved_len;
+
+    separate_len = compress(level, mem_level, 1, &separate_bytes);
+    verify(separate_len);
+    interleaved_len = compress(level, mem_level, 0, &interleaved_bytes);
+    verify(interleaved_len);
+
+    /* Both layouts hold the same number of symbols, so blocks end at the same places */
+    EXPECT_EQ(separate_len, interleaved_len);
+    EXPECT_LT(interleaved_bytes, separate_bytes);
+}
+
+INSTANTIATE_TEST_SUITE_P(deflate_lit_mem, deflate_lit_mem,
+    testing::Combine(testing::Range(0, 10), testing::Values(1, 8, 9)));
+
+TEST(deflate_lit_mem_state, too_late) {
+    zng_stream c_stream;
+    uint8_t out[256];
+
+    memset(&c_stream, 0, sizeof(c_stream));
+    EXPECT_EQ(zng_deflateInit(&c_stream, Z_DEFAULT_COMPRESSION), Z_OK);
+    c_stream.next_in = (z_const uint8_t *)hello;
+    c_stream.avail_in = hello_len;
+    c_stream.next_out = out;
+    c_stream.avail_out = sizeof(out);
+    EXPECT_EQ(zng_deflate(&c_stream, Z_NO_FLUSH), Z_OK);
+
+    int lit_mem = get_lit_mem(&c_stream);
+    EXPECT_EQ(set_lit_mem(&c_stream, !lit_mem), Z_STREAM_ERROR);
+    /* Keeping the current layout is always fine */
+    EXPECT_EQ(set_lit_mem(&c_stream, lit_mem), Z_OK);
+    EXPECT_EQ(get_lit_mem(&c_stream), lit_mem);
+
+    EXPECT_EQ(zng_deflate(&c_stream, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(zng_deflateEnd(&c_stream), Z_OK);
+}
@@ -92,3 +92,55 @@ TEST(deflate_quick, block_open) {
 
     EXPECT_TRUE(memcmp(uncompressed, next_in, sizeof(uncompressed)) == 0);
 }
+
+/* A stream reset while deflate_quick() has its last block open must start the next stream with a new block.
+   The block stays open when the pending buffer fills up, which takes more input than the buffer holds. */
+TEST(deflate_quick, reset_block_open) {
+    static unsigned char next_in[70000], next_out[80000], uncompressed[4096];
+    PREFIX3(stream) strm;
+    uint32_t seed = 1;
+    int err;
+
+    for (size_t i = 0; i < sizeof(next_in); i++) {
+        seed = seed * 1103515245 + 12345;
+        next_in[i] = (unsigned char)(seed >> 16);
+    }
+
+    memset(&strm, 0, sizeof(strm));
+    err = PREFIX(deflateInit2)(&strm, 1, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    EXPECT_EQ(err, Z_OK);
+
+    /* Not enough room to finish, then start over */
+    strm.next_in = next_in;
+    strm.avail_in = sizeof(next_in);
+    strm.next_out = next_out;
+    strm.avail_out = 60000;
+    err = PREFIX(deflate)(&strm, Z_FINISH);
+    EXPECT_EQ(err, Z_OK);
+    err = PREFIX(deflateReset)(&strm);
+    EXPECT_EQ(err, Z_OK);
+
+    strm.next_in = next_in;
+    strm.avail_in = sizeof(uncompressed);
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    err = PREFIX(deflate)(&strm, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    uint32_t compressed_size = (uint32_t)(sizeof(next_out) - strm.avail_out);
+    err = PREFIX(deflateEnd)(&strm);
+    EXPECT_EQ(err, Z_OK);
+
+    memset(&strm, 0, sizeof(strm));
+    err = PREFIX(inflateInit2)(&strm, -MAX_WBITS);
+    EXPECT_EQ(err, Z_OK);
+    strm.next_in = next_out;
+    strm.avail_in = compressed_size;
+    strm.next_out = uncompressed;
+    strm.avail_out = sizeof(uncompressed);
+    err = PREFIX(inflate)(&strm, Z_NO_FLUSH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    err = PREFIX(inflateEnd)(&strm);
+    EXPECT_EQ(err, Z_OK);
+
+    EXPECT_TRUE(memcmp(uncompressed, next_in, sizeof(uncompressed)) == 0);
+}
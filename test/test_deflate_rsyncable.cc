@@ -0,0 +1,300 @@
+/* test_deflate_rsyncable.cc - Test content-defined flush points in deflate */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define DATA_SIZE (1024 * 1024)
+#define EDIT_POS 5000
+#define TESTFILE "rsyncable.gz"
+
+static int32_t set_rsyncable(zng_stream *strm, int rsyncable) {
+    zng_deflate_param_value param;
+    param.param = Z_DEFLATE_RSYNCABLE;
+    param.buf = &rsyncable;
+    param.size = sizeof(rsyncable);
+    return zng_deflateSetParams(strm, &param, 1);
+}
+
+static int get_rsyncable(zng_stream *strm) {
+    zng_deflate_param_value param;
+    int rsyncable = -1;
+    param.param = Z_DEFLATE_RSYNCABLE;
+    param.buf = &rsyncable;
+    param.size = sizeof(rsyncable);
+    EXPECT_EQ(zng_deflateGetParams(strm, &param, 1), Z_OK);
+    return rsyncable;
+}
+
+class deflate_rsyncable : public ::testing::Test {
+public:
+    uint8_t *data, *edit;
+    size_t edit_len;
+
+    void SetUp() {
+        static const char *words[] = {
+            "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "zlib", "deflate", "inflate",
+            "window", "block", "stream", "flush", "hash", "match", "literal", "length", "distance", "\n"
+        };
+        uint32_t seed = 1;
+        size_t i = 0, n;
+
+        /* Text made of random words, followed by a copy with a few bytes replaced and a few inserted */
+        data = (uint8_t *)malloc(DATA_SIZE);
+        edit = (uint8_t *)malloc(DATA_SIZE + 16);
+        ASSERT_TRUE(data != NULL && edit != NULL);
+        while (i < DATA_SIZE) {
+            seed = seed * 1103515245 + 12345;
+            const char *word = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+            n = strlen(word);
+            if (n > DATA_SIZE - i - 1)
+                n = DATA_SIZE - i - 1;
+            memcpy(data + i, word, n);
+            i += n;
+            data[i++] = ' ';
+        }
+        memcpy(edit, data, EDIT_POS);
+        memcpy(edit + EDIT_POS, "an edit here", 12);
+        memcpy(edit + EDIT_POS + 12, data + EDIT_POS + 3, DATA_SIZE - EDIT_POS - 3);
+        edit_len = DATA_SIZE + 9;
+    }
+
+    void TearDown() {
+        free(edit);
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Compress len bytes of in to a malloc'd buffer with level, feeding deflate piece bytes of input and
+       output at a time if piece is not zero, and check that it decompresses back to in */
+    uint8_t *compress(const uint8_t *in, size_t len, int level, int strategy, int rsyncable, size_t piece,
+                      size_t *compr_len) {
+        zng_stream strm;
+        size_t size, pos = 0;
+        uint8_t *compr, *uncompr;
+        int32_t err;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_EQ(zng_deflateInit2(&strm, level, Z_DEFLATED, MAX_WBITS, 8, strategy), Z_OK);
+        EXPECT_EQ(get_rsyncable(&strm), 0);
+        EXPECT_EQ(set_rsyncable(&strm, rsyncable), Z_OK);
+        EXPECT_EQ(get_rsyncable(&strm), rsyncable);
+        size = zng_deflateBound(&strm, (unsigned long)len);
+        compr = (uint8_t *)malloc(size);
+        EXPECT_TRUE(compr != NULL);
+        if (compr == NULL)
+            return NULL;
+        strm.next_in = in;
+        strm.next_out = compr;
+        do {
+            strm.avail_in = (uint32_t)(piece == 0 || piece > len - (strm.next_in - in) ?
+                                       len - (strm.next_in - in) : piece);
+            strm.avail_out = (uint32_t)(piece == 0 || piece > size - pos ? size - pos : piece);
+            err = zng_deflate(&strm, strm.avail_in == len - (size_t)(strm.next_in - in) ? Z_FINISH : Z_NO_FLUSH);
+            pos = strm.next_out - compr;
+            EXPECT_TRUE(err == Z_OK || err == Z_STREAM_END) << err;
+        } while (err == Z_OK);
+        EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+        *compr_len = pos;
+
+        uncompr = (uint8_t *)malloc(len + 1);
+        EXPECT_TRUE(uncompr != NULL);
+        if (uncompr != NULL) {
+            size_t got = len + 1;
+            EXPECT_EQ(zng_uncompress2(uncompr, &got, compr, compr_len), Z_OK);
+            EXPECT_EQ(got, len);
+            EXPECT_EQ(memcmp(uncompr, in, len), 0);
+            free(uncompr);
+        }
+        return compr;
+    }
+
+    /* Number of bytes of b in pieces ending with a sync flush marker that are also found in a */
+    static size_t shared(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len) {
+        size_t i, j, beg = 0, len, total = 0;
+
+        for (j = 0; j + 4 <= b_len; j++) {
+            if (memcmp(b + j, "\0\0\377\377", 4) != 0)
+                continue;
+            len = j + 4 - beg;
+            for (i = 0; i + len <= a_len; i++) {
+                if (memcmp(a + i, b + beg, len) == 0) {
+                    total += len;
+                    break;
+                }
+            }
+            beg = j + 4;
+            j += 3;
+        }
+        return total;
+    }
+};
+
+TEST_F(deflate_rsyncable, edit) {
+    static const int levels[] = { 1, 2, 3, 6, 9 };
+    uint8_t *a, *b;
+    size_t a_len, b_len, i;
+
+    for (i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        /* Most of the compressed data is the same after an edit near the start, which moves the rest of the
+           data, where without flush points none of it is */
+        a = compress(data, DATA_SIZE, levels[i], Z_DEFAULT_STRATEGY, 1, 0, &a_len);
+        b = compress(edit, edit_len, levels[i], Z_DEFAULT_STRATEGY, 1, 0, &b_len);
+        ASSERT_TRUE(a != NULL && b != NULL);
+        EXPECT_GT(shared(a, a_len, b, b_len), a_len * 3 / 4) << "level " << levels[i];
+        free(b);
+        free(a);
+        a = compress(data, DATA_SIZE, levels[i], Z_DEFAULT_STRATEGY, 0, 0, &a_len);
+        b = compress(edit, edit_len, levels[i], Z_DEFAULT_STRATEGY, 0, 0, &b_len);
+        ASSERT_TRUE(a != NULL && b != NULL);
+        EXPECT_LT(shared(a, a_len, b, b_len), a_len / 100) << "level " << levels[i];
+        free(b);
+
+        /* The cost is small */
+        b = compress(data, DATA_SIZE, levels[i], Z_DEFAULT_STRATEGY, 1, 0, &b_len);
+        ASSERT_TRUE(b != NULL);
+        EXPECT_LT(b_len, a_len + a_len / 20) << "level " << levels[i];
+        free(b);
+        free(a);
+    }
+}
+
+TEST_F(deflate_rsyncable, pieces) {
+    static const size_t pieces[] = { 1, 7, 100, 4096, 70000 };
+    static const int strategies[] = { Z_DEFAULT_STRATEGY, Z_FILTERED, Z_HUFFMAN_ONLY, Z_RLE, Z_FIXED };
+    uint8_t *a;
+    size_t a_len, i, j;
+
+    /* Input and output a little at a time, so that deflate stops before and after flush points */
+    for (j = 0; j < sizeof(strategies) / sizeof(strategies[0]); j++) {
+        for (i = 0; i < sizeof(pieces) / sizeof(pieces[0]); i++) {
+            a = compress(data, 200000, j ? 6 : 1, strategies[j], 1, pieces[i], &a_len);
+            free(a);
+        }
+    }
+}
+
+TEST_F(deflate_rsyncable, bound) {
+    uint32_t seed = 1;
+    uint8_t *a;
+    size_t a_len, i;
+
+    /* Data that does not compress fits in deflateBound(), and so does level 0, where it has no effect */
+    for (i = 0; i < DATA_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+    a = compress(data, DATA_SIZE, 1, Z_DEFAULT_STRATEGY, 1, 0, &a_len);
+    free(a);
+    a = compress(data, DATA_SIZE, 9, Z_DEFAULT_STRATEGY, 1, 0, &a_len);
+    free(a);
+    a = compress(data, DATA_SIZE, 0, Z_DEFAULT_STRATEGY, 1, 0, &a_len);
+    free(a);
+}
+
+TEST_F(deflate_rsyncable, params) {
+    zng_stream strm;
+    uint8_t out[64];
+    int32_t err;
+
+    /* Flushes and a change of level with flush points on, and turning them off along the way */
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    EXPECT_EQ(set_rsyncable(&strm, 1), Z_OK);
+    strm.next_in = data;
+    strm.avail_in = 100000;
+    uint8_t *compr = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(compr != NULL);
+    strm.next_out = compr;
+    strm.avail_out = DATA_SIZE;
+    EXPECT_EQ(zng_deflate(&strm, Z_SYNC_FLUSH), Z_OK);
+    EXPECT_EQ(strm.avail_in, 0U);
+    EXPECT_EQ(zng_deflateParams(&strm, 1, Z_DEFAULT_STRATEGY), Z_OK);
+    strm.next_in = data + 100000;
+    strm.avail_in = 100000;
+    EXPECT_EQ(zng_deflate(&strm, Z_FULL_FLUSH), Z_OK);
+    EXPECT_EQ(set_rsyncable(&strm, 0), Z_OK);
+    EXPECT_EQ(get_rsyncable(&strm), 0);
+    strm.next_in = data + 200000;
+    strm.avail_in = 100000;
+    EXPECT_EQ(zng_deflate(&strm, Z_FINISH), Z_STREAM_END);
+    size_t compr_len = DATA_SIZE - strm.avail_out;
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+
+    uint8_t *uncompr = (uint8_t *)malloc(300001);
+    ASSERT_TRUE(uncompr != NULL);
+    size_t got = 300001;
+    EXPECT_EQ(zng_uncompress2(uncompr, &got, compr, &compr_len), Z_OK);
+    EXPECT_EQ(got, 300000U);
+    EXPECT_EQ(memcmp(uncompr, data, got), 0);
+    free(uncompr);
+    free(compr);
+
+    /* Wrong size */
+    memset(&strm, 0, sizeof(strm));
+    EXPECT_EQ(zng_deflateInit(&strm, 6), Z_OK);
+    zng_deflate_param_value param;
+    char small = 1;
+    param.param = Z_DEFLATE_RSYNCABLE;
+    param.buf = &small;
+    param.size = sizeof(small);
+    EXPECT_EQ(zng_deflateSetParams(&strm, &param, 1), Z_BUF_ERROR);
+    EXPECT_EQ(param.status, Z_BUF_ERROR);
+    EXPECT_EQ(get_rsyncable(&strm), 0);
+    strm.next_in = data;
+    strm.avail_in = 0;
+    strm.next_out = out;
+    strm.avail_out = sizeof(out);
+    err = zng_deflate(&strm, Z_FINISH);
+    EXPECT_EQ(err, Z_STREAM_END);
+    EXPECT_EQ(zng_deflateEnd(&strm), Z_OK);
+}
+
+#ifdef WITH_GZFILEOP
+TEST_F(deflate_rsyncable, gzip) {
+    uint8_t *a, *buf;
+    size_t a_len, b_len;
+    gzFile file;
+    FILE *f;
+    int i;
+
+    /* "y" makes the same flush points as the deflate parameter */
+    for (i = 0; i < 2; i++) {
+        file = zng_gzopen(TESTFILE, "wy");
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(zng_gzwrite(file, i ? edit : data, i ? (unsigned)edit_len : DATA_SIZE),
+                  i ? (int)edit_len : DATA_SIZE);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        f = fopen(TESTFILE, "rb");
+        ASSERT_TRUE(f != NULL);
+        buf = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(buf != NULL);
+        b_len = fread(buf, 1, DATA_SIZE, f);
+        fclose(f);
+
+        /* Skip the gzip header and trailer */
+        a = compress(i ? edit : data, i ? edit_len : DATA_SIZE, Z_DEFAULT_COMPRESSION, Z_DEFAULT_STRATEGY, 1, 0,
+                     &a_len);
+        ASSERT_TRUE(a != NULL);
+        ASSERT_EQ(b_len, a_len - 6 + 18);
+        EXPECT_EQ(memcmp(a + 2, buf + 10, a_len - 6), 0);
+        free(a);
+        free(buf);
+
+        file = zng_gzopen(TESTFILE, "ry");
+        ASSERT_TRUE(file != NULL);
+        buf = (uint8_t *)malloc(DATA_SIZE + 16);
+        ASSERT_TRUE(buf != NULL);
+        EXPECT_EQ(zng_gzread(file, buf, DATA_SIZE + 16), i ? (int)edit_len : DATA_SIZE);
+        EXPECT_EQ(memcmp(buf, i ? edit : data, i ? edit_len : DATA_SIZE), 0);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        free(buf);
+    }
+}
+#endif
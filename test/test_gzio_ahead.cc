@@ -0,0 +1,185 @@
+/* test_gzio_ahead.cc - Test reading gzip files with a read-ahead thread */
+
+#include "test_gzio_shared.h"
+
+#define TESTFILE "ahead.gz"
+#define DATA_SIZE (2 * 1024 * 1024 + 777)
+
+class gzio_ahead : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 200000, 4);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write len bytes of data from pos to TESTFILE with mode */
+    void write(const char *mode, size_t pos, size_t len) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(PREFIX(gzwrite)(file, data + pos, (unsigned)len), (int)len);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read TESTFILE back with mode in pieces of many sizes, and compare it with the first len bytes of data */
+    void read(const char *mode, size_t len) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 600011);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+};
+
+TEST_F(gzio_ahead, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    write("wb", 0, 1000000);
+    write("ab1", 1000000, DATA_SIZE - 1000000);
+    read("rA", DATA_SIZE);
+
+    /* Combined with the other read modes */
+    read("rAP", DATA_SIZE);
+    write("wB", 0, DATA_SIZE);
+    read("rAB", DATA_SIZE);
+
+    /* Not compressed, and empty */
+    gzio_replace(TESTFILE, data, 100000);
+    read("rA", 100000);
+    gzio_replace(TESTFILE, data, 0);
+    read("rA", 0);
+#endif
+}
+
+TEST_F(gzio_ahead, lines) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+    char line[64];
+    size_t pos = 0, n;
+    int c;
+
+    /* No zeros, so that strlen() gives the length of each line */
+    for (pos = 0; pos < DATA_SIZE; pos++)
+        data[pos] |= data[pos] == 0;
+    pos = 0;
+
+    write("wb", 0, DATA_SIZE);
+    file = PREFIX(gzopen)(TESTFILE, "rA");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzdirect)(file), 0);
+    while (PREFIX(gzgets)(file, line, sizeof(line)) != NULL) {
+        n = strlen(line);
+        ASSERT_LE(pos + n, (size_t)DATA_SIZE);
+        ASSERT_EQ(memcmp(line, data + pos, n), 0) << "at " << pos;
+        pos += n;
+
+        /* Push back a byte now and then */
+        if (pos % 7 == 0 && (c = PREFIX(gzgetc)(file)) != -1) {
+            EXPECT_EQ(c, data[pos]);
+            EXPECT_EQ(PREFIX(gzungetc)(c, file), c);
+        }
+    }
+    EXPECT_EQ(pos, (size_t)DATA_SIZE);
+    EXPECT_EQ(PREFIX(gzeof)(file), 1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+
+TEST_F(gzio_ahead, seek) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const size_t positions[] = { 1000000, 5, 2000000, 1999999, 0, 777777, DATA_SIZE - 1 };
+    gzFile file;
+    uint8_t buf[100];
+    size_t i;
+
+    write("wb", 0, DATA_SIZE);
+    file = PREFIX(gzopen)(TESTFILE, "rA");
+    ASSERT_TRUE(file != NULL);
+    for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+        EXPECT_EQ(PREFIX(gzseek)(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, 1), 1);
+        EXPECT_EQ(buf[0], data[positions[i]]) << "position " << positions[i];
+        EXPECT_EQ(PREFIX(gztell)(file), (z_off_t)positions[i] + 1);
+    }
+    EXPECT_EQ(PREFIX(gzrewind)(file), 0);
+    EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), (int)sizeof(buf));
+    EXPECT_EQ(memcmp(buf, data, sizeof(buf)), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+
+TEST_F(gzio_ahead, errors) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, *out;
+    size_t len, pos;
+    gzFile file;
+    int err, got;
+
+    write("wb", 0, DATA_SIZE);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    out = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(out != NULL);
+
+    /* Truncated */
+    gzio_replace(TESTFILE, buf, len / 2);
+    file = PREFIX(gzopen)(TESTFILE, "rA");
+    ASSERT_TRUE(file != NULL);
+    got = PREFIX(gzread)(file, out, DATA_SIZE);
+    EXPECT_GT(got, 0);
+    EXPECT_LT(got, DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, got), 0);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_BUF_ERROR);
+
+    /* Corrupted */
+    buf[len / 2] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    file = PREFIX(gzopen)(TESTFILE, "rA");
+    ASSERT_TRUE(file != NULL);
+    do {
+        got = PREFIX(gzread)(file, out, 65536);
+    } while (got > 0);
+    EXPECT_EQ(got, -1);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    PREFIX(gzclose)(file);
+
+    /* Reading on after gzclearerr(), as the file is written */
+    write("wb", 0, 300000);
+    file = PREFIX(gzopen)(TESTFILE, "rA");
+    ASSERT_TRUE(file != NULL);
+    pos = 0;
+    while ((got = PREFIX(gzread)(file, out + pos, 100000)) > 0)
+        pos += got;
+    EXPECT_EQ(got, 0);
+    EXPECT_EQ(pos, 300000U);
+    EXPECT_EQ(PREFIX(gzeof)(file), 1);
+    EXPECT_EQ(PREFIX(gzread)(file, out + pos, 100000), 0);
+    write("ab", 300000, 200000);
+    PREFIX(gzclearerr)(file);
+    while ((got = PREFIX(gzread)(file, out + pos, 100000)) > 0)
+        pos += got;
+    EXPECT_EQ(pos, 500000U);
+    EXPECT_EQ(memcmp(out, data, pos), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    free(out);
+    free(buf);
+#endif
+}
@@ -0,0 +1,303 @@
+/* test_gzio_append.cc - Test appending to gzip files by continuing the last gzip stream with "c" */
+
+#include "test_gzio_shared.h"
+
+#include <fcntl.h>
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+#define TESTFILE "append.gz"
+#define DATA_SIZE (3 * 1024 * 1024 + 4321)
+
+class gzio_append : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 300000, 4);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write len bytes of data from pos to file in pieces of many sizes, with a flush now and then */
+    void write(gzFile file, size_t pos, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_write(file, data + pos, len, 200003, 7);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read TESTFILE and compare it with the first len bytes of data */
+    void read(size_t len) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, "rb");
+
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Return the number of gzip streams in len bytes at buf, or -1 if they don't all decompress */
+    int streams(const uint8_t *buf, size_t len) {
+        PREFIX3(stream) strm;
+        uint8_t *out = (uint8_t *)malloc(65536);
+        int count = 0, ret = Z_OK;
+
+        memset(&strm, 0, sizeof(strm));
+        if (out == NULL || PREFIX(inflateInit2)(&strm, MAX_WBITS + 16) != Z_OK) {
+            free(out);
+            return -1;
+        }
+        strm.next_in = (z_const uint8_t *)buf;
+        strm.avail_in = (uint32_t)len;
+        while (strm.avail_in) {
+            do {
+                strm.next_out = out;
+                strm.avail_out = 65536;
+                ret = PREFIX(inflate)(&strm, Z_NO_FLUSH);
+            } while (ret == Z_OK);
+            if (ret != Z_STREAM_END)
+                break;
+            count++;
+            PREFIX(inflateReset)(&strm);
+        }
+        PREFIX(inflateEnd)(&strm);
+        free(out);
+        return ret == Z_STREAM_END ? count : -1;
+    }
+
+    /* Return the number of gzip streams in TESTFILE, or -1 if they don't all decompress */
+    int file_streams() {
+        size_t len;
+        uint8_t *buf = gzio_load(TESTFILE, &len);
+        int count;
+
+        if (buf == NULL)
+            return -1;
+        count = streams(buf, len);
+        free(buf);
+        return count;
+    }
+};
+
+TEST_F(gzio_append, cont) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const char *modes[] = { "ac", "abc1", "ac9", "acR", "ach", "acF", "ac0", "acy" };
+    size_t pos, i, n;
+
+    /* One gzip stream however many times it is appended to, at any level and strategy */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 500000);
+    pos = 500000;
+    for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        n = i == 2 ? 1000000 : 100000 + i * 777;
+        write(PREFIX(gzopen)(TESTFILE, modes[i]), pos, n);
+        pos += n;
+        EXPECT_EQ(file_streams(), 1) << modes[i];
+        read(pos);
+    }
+
+    /* A byte or two at a time, so that the last block is within a byte or two */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 1);
+    for (pos = 1; pos < 200; pos += n) {
+        n = pos % 3;
+        write(PREFIX(gzopen)(TESTFILE, "ac"), pos, n);
+    }
+    EXPECT_EQ(file_streams(), 1);
+    read(pos);
+#endif
+}
+
+TEST_F(gzio_append, size) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const char *words[] = { "ok", "retry", "fail", "skip" };
+    size_t cont_len, apart_len, pos;
+    uint32_t seed = 1;
+    uint8_t *buf;
+    int i;
+
+    /* Log-like lines, which are much like the ones before them */
+    for (pos = 0; pos < 200000;) {
+        uint32_t r = gzio_rand(&seed);
+        pos += snprintf((char *)data + pos, 100, "record %u status=%s value=%u\n", (unsigned)pos / 37,
+                        words[r & 3], (r >> 4) % 1000);
+    }
+
+    /* Small appends compress nearly as well as writing all at once, since the history goes on, and better
+       than a new stream for each */
+    for (i = 0; i < 2; i++) {
+        write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 2000);
+        for (pos = 2000; pos < 200000; pos += 2000)
+            write(PREFIX(gzopen)(TESTFILE, i ? "ab" : "abc"), pos, 2000);
+        read(200000);
+        EXPECT_EQ(file_streams(), i ? 100 : 1);
+        buf = gzio_load(TESTFILE, i ? &apart_len : &cont_len);
+        free(buf);
+    }
+    EXPECT_LT(cont_len, apart_len - apart_len / 8);
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 200000);
+    buf = gzio_load(TESTFILE, &pos);
+    free(buf);
+    EXPECT_LT(cont_len, pos + pos / 10);
+#endif
+}
+
+TEST_F(gzio_append, streams) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+
+    /* Only the last of several gzip streams is continued */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 600000);
+    write(PREFIX(gzopen)(TESTFILE, "ab"), 600000, 600000);
+    write(PREFIX(gzopen)(TESTFILE, "abc"), 1200000, 600000);
+    EXPECT_EQ(file_streams(), 2);
+    read(1800000);
+
+    /* A seekable file continues its last stream, and loses its index */
+    write(PREFIX(gzopen)(TESTFILE, "wbS"), 0, 2500000);
+    EXPECT_EQ(file_streams(), 4);
+    write(PREFIX(gzopen)(TESTFILE, "abc"), 2500000, DATA_SIZE - 2500000);
+    EXPECT_EQ(file_streams(), 3);
+    read(DATA_SIZE);
+
+    /* Started from nothing, and nothing written */
+    remove(TESTFILE);
+    write(PREFIX(gzopen)(TESTFILE, "abc"), 0, 300000);
+    EXPECT_EQ(file_streams(), 1);
+    read(300000);
+    file = PREFIX(gzopen)(TESTFILE, "abc");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    EXPECT_EQ(file_streams(), 1);
+    read(300000);
+
+    /* A stream that is finished by gzflush() is followed by a new one */
+    file = PREFIX(gzopen)(TESTFILE, "abc");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 300000, 100000), 100000);
+    EXPECT_EQ(PREFIX(gzflush)(file, Z_FINISH), Z_OK);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 400000, 100000), 100000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    EXPECT_EQ(file_streams(), 2);
+    read(500000);
+#endif
+}
+
+TEST_F(gzio_append, fallback) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, *after;
+    size_t len, after_len;
+
+    /* BGZF ends with an empty stream that has its size in the header, so a new stream is appended */
+    write(PREFIX(gzopen)(TESTFILE, "wbB"), 0, 200000);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    write(PREFIX(gzopen)(TESTFILE, "abc"), 200000, 100000);
+    after = gzio_load(TESTFILE, &after_len);
+    ASSERT_TRUE(after != NULL);
+    EXPECT_GT(after_len, len);
+    EXPECT_EQ(memcmp(after, buf, len), 0);
+    EXPECT_EQ(streams(after + len, after_len - len), 1);
+    read(300000);
+    free(after);
+    free(buf);
+
+    /* As is one after a gzip stream that is cut short */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 200000);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    gzio_replace(TESTFILE, buf, len - 4);
+    write(PREFIX(gzopen)(TESTFILE, "abc"), 0, 100000);
+    after = gzio_load(TESTFILE, &after_len);
+    ASSERT_TRUE(after != NULL);
+    EXPECT_GT(after_len, len - 4);
+    EXPECT_EQ(memcmp(after, buf, len - 4), 0);
+    EXPECT_EQ(streams(after + len - 4, after_len - (len - 4)), 1);
+    free(after);
+    free(buf);
+
+    /* "c" does nothing with "w", or with "T" */
+    write(PREFIX(gzopen)(TESTFILE, "wbc"), 0, 100000);
+    read(100000);
+    write(PREFIX(gzopen)(TESTFILE, "abcT"), 100000, 1000);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    EXPECT_EQ(memcmp(buf + len - 1000, data + 100000, 1000), 0);
+    free(buf);
+#endif
+}
+
+#ifndef _WIN32
+TEST_F(gzio_append, dopen) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    int fd;
+
+    /* A descriptor that can be read and written is continued */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 400000);
+    fd = open(TESTFILE, O_RDWR);
+    ASSERT_NE(fd, -1);
+    write(PREFIX(gzdopen)(fd, "abc"), 400000, 400000);
+    EXPECT_EQ(file_streams(), 1);
+    read(800000);
+
+    /* But not one that can only be appended to, or that can't be read */
+    fd = open(TESTFILE, O_WRONLY | O_APPEND);
+    ASSERT_NE(fd, -1);
+    write(PREFIX(gzdopen)(fd, "abc"), 800000, 100000);
+    EXPECT_EQ(file_streams(), 2);
+    fd = open(TESTFILE, O_WRONLY);
+    ASSERT_NE(fd, -1);
+    lseek(fd, 0, SEEK_END);
+    write(PREFIX(gzdopen)(fd, "abc"), 900000, 100000);
+    EXPECT_EQ(file_streams(), 3);
+    read(1000000);
+#endif
+}
+#endif
+
+#ifndef ZLIB_COMPAT
+TEST_F(gzio_append, mem) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    void *buf = NULL;
+    size_t len = 0;
+    gzFile file;
+    uint8_t *out;
+
+    /* Memory is continued in place */
+    file = zng_gzopen_memstream(&buf, &len, "w");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzwrite(file, data, 700000), 700000);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    file = zng_gzopen_memstream(&buf, &len, "ac");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzwrite(file, data + 700000, 700000), 700000);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    EXPECT_EQ(streams((uint8_t *)buf, len), 1);
+    out = (uint8_t *)malloc(1400001);
+    ASSERT_TRUE(out != NULL);
+    file = zng_gzopen_mem(buf, len, "r");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzread(file, out, 1400001), 1400000);
+    EXPECT_EQ(memcmp(out, data, 1400000), 0);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    free(out);
+    free(buf);
+#endif
+}
+#endif
@@ -0,0 +1,281 @@
+/* test_gzio_bgzf.cc - Test read/write of BGZF (blocked gzip) files */
+
+#include "test_gzio_shared.h"
+
+#define TESTFILE "bgzf.gz"
+#define INDEXFILE "bgzf.gz.gzi"
+#define DATA_SIZE (1024 * 1024 + 12345)
+
+static const uint8_t bgzf_eof[28] = {
+    31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0, 27, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+class gzio_bgzf : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 100000, 3);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+        remove(INDEXFILE);
+    }
+
+    /* Write the first len bytes of data to TESTFILE in pieces of different sizes, with some flushes */
+    void write(const char *mode, size_t len) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+        gzio_write(file, data, len, 100003, 7);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read TESTFILE back with threads and compare it with the first len bytes of data, pushing back bytes as it
+       goes if pushback is true */
+    void read(const char *mode, size_t len, unsigned threads, bool pushback = false) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+#ifndef ZLIB_COMPAT
+        EXPECT_EQ(PREFIX(gzthreads)(file, threads), 0);
+#else
+        Z_UNUSED(threads);
+#endif
+        if (pushback)
+            gzio_read_ungetc(file, data, len);
+        else
+            gzio_read(file, data, len, 70001);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+};
+
+TEST_F(gzio_bgzf, format) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    size_t len, pos, total = 0, members = 0;
+    uint8_t *buf;
+
+    write("wB9", DATA_SIZE);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+
+    /* Walk the members using their sizes, ending with the empty one */
+    for (pos = 0; pos + 18 <= len; members++) {
+        size_t size = (buf[pos + 16] | buf[pos + 17] << 8) + 1;
+        ASSERT_EQ(memcmp(buf + pos, bgzf_eof, 16), 0) << "member " << members;
+        ASSERT_LE(pos + size, len);
+        size_t isize = buf[pos + size - 4] | buf[pos + size - 3] << 8 | (size_t)buf[pos + size - 2] << 16 |
+                       (size_t)buf[pos + size - 1] << 24;
+        EXPECT_LE(isize, 0xff00UL);
+        total += isize;
+        pos += size;
+    }
+    EXPECT_EQ(pos, len);
+    EXPECT_EQ(total, (size_t)DATA_SIZE);
+    EXPECT_GT(members, (size_t)DATA_SIZE / 0xff00);
+    EXPECT_EQ(memcmp(buf + len - 28, bgzf_eof, 28), 0);
+    free(buf);
+
+    /* It is gzip, so it reads without "B" too */
+    read("rb", DATA_SIZE, 1);
+#endif
+}
+
+TEST_F(gzio_bgzf, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    write("wB", DATA_SIZE);
+    read("rB", DATA_SIZE, 1);
+    read("rB", DATA_SIZE, 2);
+    read("rB", DATA_SIZE, 5);
+    read("rB", DATA_SIZE, 0);
+
+    /* Level 1 expands the random runs, which are then stored instead */
+    write("wB1", DATA_SIZE);
+    read("rB", DATA_SIZE, 3);
+
+    /* A short file, and an empty file */
+    write("wB6h", 100);
+    read("rB", 100, 3);
+    write("wB", 0);
+    read("rB", 0, 3);
+#endif
+}
+
+TEST_F(gzio_bgzf, mixed) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+
+    /* Plain gzip read with "B" */
+    write("wb", DATA_SIZE);
+    read("rB", DATA_SIZE, 4);
+
+    /* BGZF followed by a plain gzip member, then BGZF again */
+    file = PREFIX(gzopen)(TESTFILE, "wB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 300000), 300000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "ab");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 300000, 200000), 200000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "aB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 500000, DATA_SIZE - 500000), DATA_SIZE - 500000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    read("rB", DATA_SIZE, 3);
+    read("rb", DATA_SIZE, 1);
+#endif
+}
+
+TEST_F(gzio_bgzf, errors) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, *out;
+    size_t len;
+    gzFile file;
+    FILE *f;
+    int err, got;
+
+    write("wB", DATA_SIZE);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    out = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(out != NULL);
+
+    /* Truncated in the middle of a member */
+    gzio_replace(TESTFILE, buf, len / 2);
+    file = PREFIX(gzopen)(TESTFILE, "rB");
+    ASSERT_TRUE(file != NULL);
+    got = PREFIX(gzread)(file, out, DATA_SIZE);
+    EXPECT_GT(got, 0);
+    EXPECT_LT(got, DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, got), 0);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_BUF_ERROR);
+
+    /* Corrupted data in a member past the first batch */
+    buf[len - 1000] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    file = PREFIX(gzopen)(TESTFILE, "rB");
+    ASSERT_TRUE(file != NULL);
+    do {
+        got = PREFIX(gzread)(file, out, 65536);
+    } while (got > 0);
+    EXPECT_EQ(got, -1);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    PREFIX(gzclose)(file);
+
+    /* Trailing garbage is ignored */
+    buf[len - 1000] ^= 0x55;
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    fwrite(buf, 1, len, f);
+    fwrite("garbage", 1, 7, f);
+    fclose(f);
+    read("rB", DATA_SIZE, 2);
+
+    free(out);
+    free(buf);
+#endif
+}
+
+TEST_F(gzio_bgzf, ungetc) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    /* Bytes pushed back go in front of the rest of the batch */
+    write("wB", DATA_SIZE);
+    read("rB", DATA_SIZE, 4, true);
+    read("rB", DATA_SIZE, 1, true);
+#endif
+}
+
+#ifndef ZLIB_COMPAT
+TEST_F(gzio_bgzf, seek) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const size_t positions[] = { 0, 1, 0xff00 - 1, 0xff00, 0xff00 + 1, 100000, 300001, 654321,
+                                        DATA_SIZE - 0xff00, DATA_SIZE - 1 };
+    const size_t count = sizeof(positions) / sizeof(positions[0]);
+    int64_t voffset[count];
+    uint8_t buf[100];
+    gzFile file;
+    size_t i, pos;
+
+    /* Write, noting the virtual offsets of some positions */
+    file = PREFIX(gzopen)(TESTFILE, "wB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzbgzf_index)(file, INDEXFILE), 0);
+    for (pos = 0, i = 0; i < count; i++) {
+        EXPECT_EQ(PREFIX(gzwrite)(file, data + pos, (unsigned)(positions[i] - pos)), (int)(positions[i] - pos));
+        pos = positions[i];
+        voffset[i] = PREFIX(gzbgzf_tell)(file);
+        EXPECT_GE(voffset[i], 0);
+        EXPECT_EQ(voffset[i] & 0xffff, (int64_t)(pos % 0xff00));
+    }
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + pos, (unsigned)(DATA_SIZE - pos)), (int)(DATA_SIZE - pos));
+    EXPECT_EQ(PREFIX(gzbgzf_index)(file, INDEXFILE), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    /* Reading gives the same virtual offsets */
+    file = PREFIX(gzopen)(TESTFILE, "rB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzthreads)(file, 3), 0);
+    for (i = 0; i < count; i++) {
+        EXPECT_EQ(PREFIX(gzseek)(file, (z_off64_t)positions[i], SEEK_SET), (z_off64_t)positions[i]);
+        EXPECT_EQ(PREFIX(gzbgzf_tell)(file), voffset[i]) << "position " << positions[i];
+    }
+    EXPECT_EQ(PREFIX(gzthreads)(file, 3), -1);
+
+    /* Going to virtual offsets without an index, which gztell() doesn't know about */
+    for (i = count; i-- > 0;) {
+        EXPECT_EQ(PREFIX(gzbgzf_seek)(file, voffset[i]), 0);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, 1), 1);
+        EXPECT_EQ(buf[0], data[positions[i]]) << "position " << positions[i];
+        EXPECT_EQ(PREFIX(gztell)(file), (z_off64_t)(positions[i] % 0xff00) + 1);
+    }
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    /* With the index, virtual offsets and gzseek() both know where they are */
+    file = PREFIX(gzopen)(TESTFILE, "rB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzbgzf_index)(file, "does/not/exist.gzi"), -1);
+    EXPECT_EQ(PREFIX(gzbgzf_index)(file, INDEXFILE), 0);
+    for (i = count; i-- > 0;) {
+        size_t n = DATA_SIZE - positions[i] < sizeof(buf) ? DATA_SIZE - positions[i] : sizeof(buf);
+
+        EXPECT_EQ(PREFIX(gzbgzf_seek)(file, voffset[i]), 0);
+        EXPECT_EQ(PREFIX(gztell)(file), (z_off64_t)positions[i]);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, (unsigned)n), (int)n);
+        EXPECT_EQ(memcmp(buf, data + positions[i], n), 0) << "position " << positions[i];
+
+        EXPECT_EQ(PREFIX(gzseek)(file, (z_off64_t)positions[(i * 7) % count], SEEK_SET),
+                  (z_off64_t)positions[(i * 7) % count]);
+        EXPECT_EQ(PREFIX(gzgetc)(file), data[positions[(i * 7) % count]]);
+    }
+    EXPECT_EQ(PREFIX(gzbgzf_seek)(file, voffset[count - 1] + (1 << 16)), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    /* Only for BGZF */
+    file = PREFIX(gzopen)(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzbgzf_tell)(file), -1);
+    EXPECT_EQ(PREFIX(gzbgzf_seek)(file, 0), -1);
+    EXPECT_EQ(PREFIX(gzbgzf_index)(file, INDEXFILE), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+#endif
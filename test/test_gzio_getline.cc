@@ -0,0 +1,151 @@
+/* test_gzio_getline.cc - Test reading lines of gzip files in place with gzgetline_view() */
+
+#include "test_gzio_shared.h"
+
+#define TESTFILE "getline.gz"
+#define DATA_SIZE (3 * 1024 * 1024 + 111)
+
+class gzio_getline : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        uint32_t seed = 1;
+        size_t i, n, k;
+
+        /* Lines of many lengths, some empty, some with zeros, and some longer than the buffers */
+        data = (uint8_t *)malloc(DATA_SIZE);
+        ASSERT_TRUE(data != NULL);
+        for (i = 0; i < DATA_SIZE; i++)
+            data[i] = (uint8_t)("abcdefgh \0"[gzio_rand(&seed) % 10]);
+        for (i = 0, k = 1; i < DATA_SIZE; i += n) {
+            k = k * 7 % 503 + 1;
+            n = k % 97 == 0 ? k * 1000 : k - 1;
+            data[i] = '\n';
+            n++;
+        }
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write all of data to TESTFILE with mode */
+    void write(const char *mode) {
+        gzFile file = zng_gzopen(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(zng_gzwrite(file, data, DATA_SIZE), DATA_SIZE);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+    }
+
+    /* Read TESTFILE with mode and buffer size line by line, checking each line against data, and return the
+       number of lines */
+    size_t read(const char *mode, unsigned size) {
+        gzFile file = zng_gzopen(TESTFILE, mode);
+        const char *line;
+        size_t pos = 0, len, count = 0;
+        uint8_t *nl;
+
+        EXPECT_TRUE(file != NULL);
+        if (file == NULL)
+            return 0;
+        if (size) {
+            EXPECT_EQ(zng_gzbuffer(file, size), 0);
+        }
+        while ((line = zng_gzgetline_view(file, &len)) != NULL) {
+            nl = (uint8_t *)memchr(data + pos, '\n', DATA_SIZE - pos);
+            EXPECT_EQ(len, nl == NULL ? DATA_SIZE - pos : (size_t)(nl - data) + 1 - pos) << "line " << count;
+            if (len > DATA_SIZE - pos || memcmp(line, data + pos, len) != 0) {
+                ADD_FAILURE() << "line " << count << " at " << pos;
+                break;
+            }
+            pos += len;
+            count++;
+            EXPECT_EQ(zng_gztell(file), (z_off_t)pos);
+        }
+        EXPECT_EQ(len, 0U);
+        EXPECT_EQ(pos, (size_t)DATA_SIZE);
+        EXPECT_EQ(zng_gzeof(file), 1);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        return count;
+    }
+};
+
+TEST_F(gzio_getline, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    size_t count;
+
+    write("wb");
+    count = read("rb", 0);
+    EXPECT_GT(count, 500U);
+    EXPECT_EQ(read("rb", 4096), count);
+
+    /* Combined with the read modes that hand out data from other buffers */
+    EXPECT_EQ(read("rA", 0), count);
+    EXPECT_EQ(read("rP", 0), count);
+    write("wB");
+    EXPECT_EQ(read("rB", 0), count);
+
+    /* Not compressed, and without a newline at the end */
+    data[DATA_SIZE - 1] = 'x';
+    write("wT");
+    EXPECT_EQ(read("r", 0), count);
+#endif
+}
+
+TEST_F(gzio_getline, mixed) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+    const char *line;
+    char buf[64];
+    size_t len, pos;
+    int c;
+
+    /* Lines interleaved with gzread(), gzgets(), gzungetc(), and gzseek() */
+    write("wb");
+    file = zng_gzopen(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzread(file, buf, 10), 10);
+    EXPECT_EQ(memcmp(buf, data, 10), 0);
+    line = zng_gzgetline_view(file, &len);
+    ASSERT_TRUE(line != NULL);
+    EXPECT_EQ(memcmp(line, data + 10, len), 0);
+    EXPECT_EQ(line[len - 1], '\n');
+    pos = 10 + len;
+    c = zng_gzgetc(file);
+    EXPECT_EQ(c, data[pos]);
+    EXPECT_EQ(zng_gzungetc(c, file), c);
+    line = zng_gzgetline_view(file, &len);
+    ASSERT_TRUE(line != NULL);
+    EXPECT_EQ(memcmp(line, data + pos, len), 0);
+    pos += len;
+    EXPECT_TRUE(zng_gzgets(file, buf, sizeof(buf)) != NULL);
+    pos += strlen(buf);
+
+    /* A line ending past a skip */
+    EXPECT_EQ(zng_gzseek(file, 2000000, SEEK_SET), 2000000);
+    line = zng_gzgetline_view(file, &len);
+    ASSERT_TRUE(line != NULL);
+    EXPECT_EQ(memcmp(line, data + 2000000, len), 0);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+
+    /* Not for writing, and nothing in an empty file */
+    file = zng_gzopen(TESTFILE, "wb");
+    ASSERT_TRUE(file != NULL);
+    len = 1;
+    EXPECT_TRUE(zng_gzgetline_view(file, &len) == NULL);
+    EXPECT_EQ(len, 0U);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    file = zng_gzopen(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_TRUE(zng_gzgetline_view(file, &len) == NULL);
+    EXPECT_EQ(zng_gzeof(file), 1);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+#endif
+}
@@ -0,0 +1,207 @@
+/* test_gzio_mem.cc - Test reading and writing gzip data in memory */
+
+#include "test_gzio_shared.h"
+
+#define TESTFILE "mem.gz"
+#define DATA_SIZE (2 * 1024 * 1024 + 333)
+
+class gzio_mem : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 200000, 4);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write len bytes of data from pos to memory with mode in pieces of many sizes, appending to *buf with
+       "a", and check that *buf and *len are up to date after each flush */
+    void write(const char *mode, void **buf, size_t *len, size_t pos, size_t n) {
+        gzFile file = zng_gzopen_memstream(buf, len, mode);
+        size_t end = pos + n, k = 1;
+
+        ASSERT_TRUE(file != NULL);
+        while (pos < end) {
+            k = k * 11 % 300007 + 1;
+            if (k > end - pos)
+                k = end - pos;
+            ASSERT_EQ(zng_gzwrite(file, data + pos, (unsigned)k), (int)k);
+            pos += k;
+            if (k % 5 == 0) {
+                ASSERT_EQ(zng_gzflush(file, Z_SYNC_FLUSH), Z_OK);
+                EXPECT_EQ(zng_gzoffset(file), (z_off_t)*len);
+                EXPECT_TRUE(*buf != NULL);
+            }
+        }
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+    }
+
+    /* Read file back in pieces of many sizes, and compare it with the first len bytes of data */
+    void read(gzFile file, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 300007);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+    }
+};
+
+TEST_F(gzio_mem, write) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const char *modes[] = { "wb", "w1", "wT", "wB", "wS", "wy" };
+    void *buf = NULL;
+    uint8_t *file_buf;
+    size_t len = 0, file_len, i;
+    gzFile file;
+
+    /* The same as written to a file, with one write */
+    for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        file = zng_gzopen_memstream(&buf, &len, modes[i]);
+        ASSERT_TRUE(file != NULL);
+        EXPECT_TRUE(buf == NULL);
+        EXPECT_EQ(len, 0U);
+        EXPECT_EQ(zng_gzwrite(file, data, DATA_SIZE), DATA_SIZE);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        file = zng_gzopen(TESTFILE, modes[i]);
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(zng_gzwrite(file, data, DATA_SIZE), DATA_SIZE);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        file_buf = gzio_load(TESTFILE, &file_len);
+        ASSERT_TRUE(file_buf != NULL);
+        EXPECT_EQ(len, file_len) << modes[i];
+        EXPECT_EQ(memcmp(buf, file_buf, len < file_len ? len : file_len), 0) << modes[i];
+        free(file_buf);
+        read(zng_gzopen_mem(buf, len, "r"), DATA_SIZE);
+        free(buf);
+    }
+
+    /* In pieces, and appended to */
+    write("w", &buf, &len, 0, 1000000);
+    write("a", &buf, &len, 1000000, DATA_SIZE - 1000000);
+    read(zng_gzopen_mem(buf, len, "r"), DATA_SIZE);
+    free(buf);
+    buf = NULL;
+    write("a", &buf, &len, 0, DATA_SIZE);
+    read(zng_gzopen_mem(buf, len, "rA"), DATA_SIZE);
+    free(buf);
+
+    /* Nothing written */
+    file = zng_gzopen_memstream(&buf, &len, "wT");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    EXPECT_TRUE(buf == NULL);
+    EXPECT_EQ(len, 0U);
+#endif
+}
+
+TEST_F(gzio_mem, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const size_t positions[] = { 1000000, 5, 2000000, 1999999, 0, 777777, DATA_SIZE - 1 };
+    static const char *modes[] = { "r", "rA", "rP", "rm", "ru" };
+    char line[64];
+    uint8_t out[100];
+    void *buf;
+    size_t len, i, m;
+    gzFile file;
+
+    /* The read modes */
+    write("wb", &buf, &len, 0, DATA_SIZE);
+    for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+        read(zng_gzopen_mem(buf, len, modes[m]), DATA_SIZE);
+
+    /* Lines, and the offset in the memory */
+    file = zng_gzopen_mem(buf, len, "r");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzdirect(file), 0);
+    EXPECT_TRUE(zng_gzgets(file, line, sizeof(line)) != NULL);
+    EXPECT_EQ(memcmp(line, data, strlen(line)), 0);
+    EXPECT_GT(zng_gzoffset(file), 0);
+    EXPECT_LE(zng_gzoffset(file), (z_off_t)len);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    free(buf);
+
+    /* Seeking, with and without an index */
+    for (m = 0; m < 2; m++) {
+        write(m ? "wS" : "wb", &buf, &len, 0, DATA_SIZE);
+        file = zng_gzopen_mem(buf, len, "r");
+        ASSERT_TRUE(file != NULL);
+        for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+            EXPECT_EQ(zng_gzseek(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+            EXPECT_EQ(zng_gzread(file, out, 1), 1);
+            EXPECT_EQ(out[0], data[positions[i]]) << "position " << positions[i];
+        }
+        EXPECT_EQ(zng_gzrewind(file), 0);
+        EXPECT_EQ(zng_gzread(file, out, sizeof(out)), (int)sizeof(out));
+        EXPECT_EQ(memcmp(out, data, sizeof(out)), 0);
+        EXPECT_EQ(zng_gzclose(file), Z_OK);
+        free(buf);
+    }
+
+    /* Not compressed, and empty */
+    read(zng_gzopen_mem(data, 100000, "r"), 100000);
+    file = zng_gzopen_mem(data, 100000, "r");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(zng_gzseek(file, 50000, SEEK_SET), 50000);
+    EXPECT_EQ(zng_gzread(file, out, sizeof(out)), (int)sizeof(out));
+    EXPECT_EQ(memcmp(out, data + 50000, sizeof(out)), 0);
+    EXPECT_EQ(zng_gzdirect(file), 1);
+    EXPECT_EQ(zng_gzclose(file), Z_OK);
+    read(zng_gzopen_mem(NULL, 0, "r"), 0);
+#endif
+}
+
+TEST_F(gzio_mem, errors) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    void *buf = (void *)data;
+    size_t len = 1234, got;
+    uint8_t *out;
+    gzFile file;
+    int err;
+
+    /* Wrong modes and arguments, which leave *buf and *len alone */
+    EXPECT_TRUE(zng_gzopen_mem(data, DATA_SIZE, "w") == NULL);
+    EXPECT_TRUE(zng_gzopen_mem(data, DATA_SIZE, "a") == NULL);
+    EXPECT_TRUE(zng_gzopen_mem(NULL, 1, "r") == NULL);
+    EXPECT_TRUE(zng_gzopen_memstream(&buf, &len, "r") == NULL);
+    EXPECT_TRUE(zng_gzopen_memstream(&buf, &len, "") == NULL);
+    EXPECT_TRUE(zng_gzopen_memstream(NULL, &len, "w") == NULL);
+    EXPECT_TRUE(zng_gzopen_memstream(&buf, NULL, "w") == NULL);
+    EXPECT_TRUE(buf == (void *)data);
+    EXPECT_EQ(len, 1234U);
+
+    /* Truncated, and corrupted */
+    write("wb", &buf, &len, 0, DATA_SIZE);
+    out = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(out != NULL);
+    file = zng_gzopen_mem(buf, len / 2, "r");
+    ASSERT_TRUE(file != NULL);
+    got = zng_gzread(file, out, DATA_SIZE);
+    EXPECT_GT(got, 0U);
+    EXPECT_LT(got, (size_t)DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, got), 0);
+    zng_gzerror(file, &err);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    EXPECT_EQ(zng_gzclose(file), Z_BUF_ERROR);
+    ((uint8_t *)buf)[len / 2] ^= 0x55;
+    file = zng_gzopen_mem(buf, len, "r");
+    ASSERT_TRUE(file != NULL);
+    do {
+        err = zng_gzread(file, out, 65536);
+    } while (err > 0);
+    EXPECT_EQ(err, -1);
+    zng_gzerror(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    zng_gzclose(file);
+    free(out);
+    free(buf);
+#endif
+}
@@ -0,0 +1,204 @@
+/* test_gzio_mmap.cc - Test reading gzip files mapped into memory */
+
+#include "test_gzio_shared.h"
+
+#include <fcntl.h>
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+#define TESTFILE "mmap.gz"
+#define DATA_SIZE (1024 * 1024 + 4567)
+
+class gzio_mmap : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 100000, 3);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write data to TESTFILE with mode, as two members */
+    void write(const char *mode) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(PREFIX(gzwrite)(file, data, 300000), 300000);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+        file = PREFIX(gzopen)(TESTFILE, mode[1] == 'B' ? "aB" : "ab");
+        ASSERT_TRUE(file != NULL);
+        EXPECT_EQ(PREFIX(gzwrite)(file, data + 300000, DATA_SIZE - 300000), DATA_SIZE - 300000);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read file back in pieces of many sizes and compare it with the first len bytes of data, then check
+       that gzoffset() is at the end of the file, which is size bytes long */
+    void read(gzFile file, size_t len, size_t size) {
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 300007);
+        EXPECT_EQ(PREFIX(gzoffset)(file), (z_off_t)size);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+};
+
+TEST_F(gzio_mmap, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    size_t len;
+    uint8_t *buf;
+
+    write("wb");
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    free(buf);
+    read(PREFIX(gzopen)(TESTFILE, "rm"), DATA_SIZE, len);
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE, len);
+
+    /* Combined with the other read modes */
+    read(PREFIX(gzopen)(TESTFILE, "rmP"), DATA_SIZE, len);
+    read(PREFIX(gzopen)(TESTFILE, "rmA"), DATA_SIZE, len);
+    write("wB");
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    free(buf);
+    read(PREFIX(gzopen)(TESTFILE, "rmB"), DATA_SIZE, len);
+
+    /* Not compressed, and empty */
+    gzio_replace(TESTFILE, data, 100000);
+    read(PREFIX(gzopen)(TESTFILE, "rm"), 100000, 100000);
+    gzio_replace(TESTFILE, data, 0);
+    read(PREFIX(gzopen)(TESTFILE, "rm"), 0, 0);
+#endif
+}
+
+TEST_F(gzio_mmap, fd) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf;
+    size_t len;
+    int fd;
+
+    /* The gzip data starts where the file descriptor is */
+    write("wb");
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    gzio_replace(TESTFILE, data, 1000);
+    FILE *f = fopen(TESTFILE, "ab");
+    ASSERT_TRUE(f != NULL);
+    EXPECT_EQ(fwrite(buf, 1, len, f), len);
+    fclose(f);
+    free(buf);
+
+    fd = open(TESTFILE, O_RDONLY);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(lseek(fd, 1000, SEEK_SET), 1000);
+    read(PREFIX(gzdopen)(fd, "rm"), DATA_SIZE, 1000 + len);
+#endif
+}
+
+TEST_F(gzio_mmap, seek) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const size_t positions[] = { 500000, 5, 1000000, 999999, 0, 300000, 299999, DATA_SIZE - 1 };
+    const char *modes[] = { "rm", "rmA" };
+    gzFile file;
+    uint8_t buf[100];
+    size_t i, m;
+
+    write("wb");
+    for (m = 0; m < 2; m++) {
+        file = PREFIX(gzopen)(TESTFILE, modes[m]);
+        ASSERT_TRUE(file != NULL);
+        for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+            EXPECT_EQ(PREFIX(gzseek)(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+            EXPECT_EQ(PREFIX(gzread)(file, buf, 1), 1);
+            EXPECT_EQ(buf[0], data[positions[i]]) << modes[m] << " position " << positions[i];
+        }
+        EXPECT_EQ(PREFIX(gzrewind)(file), 0);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), (int)sizeof(buf));
+        EXPECT_EQ(memcmp(buf, data, sizeof(buf)), 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Seeking in a file that is not compressed goes straight there */
+    gzio_replace(TESTFILE, data, DATA_SIZE);
+    file = PREFIX(gzopen)(TESTFILE, "rm");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzdirect)(file), 1);
+    for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+        EXPECT_EQ(PREFIX(gzseek)(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, 1), 1);
+        EXPECT_EQ(buf[0], data[positions[i]]) << "position " << positions[i];
+    }
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+
+TEST_F(gzio_mmap, errors) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, *out;
+    size_t len;
+    gzFile file;
+    int err, got;
+
+    write("wb");
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    out = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(out != NULL);
+
+    /* Truncated */
+    gzio_replace(TESTFILE, buf, len / 2);
+    file = PREFIX(gzopen)(TESTFILE, "rm");
+    ASSERT_TRUE(file != NULL);
+    got = PREFIX(gzread)(file, out, DATA_SIZE);
+    EXPECT_GT(got, 0);
+    EXPECT_LT(got, DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, got), 0);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_BUF_ERROR);
+
+    /* Corrupted */
+    buf[len / 2] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    file = PREFIX(gzopen)(TESTFILE, "rm");
+    ASSERT_TRUE(file != NULL);
+    do {
+        got = PREFIX(gzread)(file, out, 65536);
+    } while (got > 0);
+    EXPECT_EQ(got, -1);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    PREFIX(gzclose)(file);
+
+    /* Trailing garbage is ignored */
+    buf[len / 2] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    FILE *f = fopen(TESTFILE, "ab");
+    ASSERT_TRUE(f != NULL);
+    fwrite("garbage", 1, 7, f);
+    fclose(f);
+    file = PREFIX(gzopen)(TESTFILE, "rm");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzread)(file, out, DATA_SIZE), DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, DATA_SIZE), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    free(out);
+    free(buf);
+#endif
+}
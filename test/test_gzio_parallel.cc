@@ -0,0 +1,274 @@
+/* test_gzio_parallel.cc - Test reading files of many gzip members in parallel */
+
+#include "test_gzio_shared.h"
+
+#define TESTFILE "parallel.gz"
+#define DATA_SIZE (4 * 1024 * 1024 + 4321)
+
+class gzio_parallel : public ::testing::Test {
+public:
+    uint8_t *data;
+    FILE *f;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 300000, 4);
+        ASSERT_TRUE(data != NULL);
+        f = NULL;
+    }
+
+    void TearDown() {
+        if (f != NULL)
+            fclose(f);
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Append a gzip member with len bytes of buf to f */
+    void member(const uint8_t *buf, size_t len, int level, PREFIX(gz_header) *head = NULL) {
+        PREFIX3(stream) strm;
+        uint8_t *out;
+        size_t size;
+
+        memset(&strm, 0, sizeof(strm));
+        ASSERT_EQ(PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        if (head != NULL) {
+            EXPECT_EQ(PREFIX(deflateSetHeader)(&strm, head), Z_OK);
+        }
+        size = PREFIX(deflateBound)(&strm, (unsigned long)len) + 256;
+        out = (uint8_t *)malloc(size);
+        ASSERT_TRUE(out != NULL);
+        strm.next_in = (z_const unsigned char *)buf;
+        strm.avail_in = (uint32_t)len;
+        strm.next_out = out;
+        strm.avail_out = (uint32_t)size;
+        EXPECT_EQ(PREFIX(deflate)(&strm, Z_FINISH), Z_STREAM_END);
+        EXPECT_EQ(fwrite(out, 1, size - strm.avail_out, f), size - strm.avail_out);
+        EXPECT_EQ(PREFIX(deflateEnd)(&strm), Z_OK);
+        free(out);
+    }
+
+    /* Write all of data to TESTFILE as members of many sizes, with some big ones, and return the number of
+       members */
+    size_t write_members(size_t big) {
+        size_t pos = 0, n = 1, count = 0;
+
+        f = fopen(TESTFILE, "wb");
+        EXPECT_TRUE(f != NULL);
+        if (f == NULL)
+            return 0;
+        while (pos < DATA_SIZE) {
+            n = n * 7 % 40009 + 1;
+            if (count % 50 == 49)
+                n = big;
+            if (n > DATA_SIZE - pos)
+                n = DATA_SIZE - pos;
+            member(data + pos, n, (int)(count % 10));
+            pos += n;
+            count++;
+        }
+        fclose(f);
+        f = NULL;
+        return count;
+    }
+
+    /* Read TESTFILE back with mode and threads and compare it with the first len bytes of data, pushing back
+       bytes as it goes if pushback is true */
+    void read(const char *mode, size_t len, unsigned threads, bool pushback = false) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, mode);
+
+        ASSERT_TRUE(file != NULL);
+#ifndef ZLIB_COMPAT
+        EXPECT_EQ(PREFIX(gzthreads)(file, threads), 0);
+#else
+        Z_UNUSED(threads);
+#endif
+        if (pushback)
+            gzio_read_ungetc(file, data, len);
+        else
+            gzio_read(file, data, len, 300007);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read TESTFILE to the end or an error, check that what was read matches data up to valid bytes, and return
+       the error -- data from a corrupt member may be returned before its check value is reached */
+    int read_error(size_t *len, size_t valid = DATA_SIZE) {
+        gzFile file = PREFIX(gzopen)(TESTFILE, "rP");
+        uint8_t *buf = (uint8_t *)malloc(DATA_SIZE);
+        int got, err;
+
+        EXPECT_TRUE(file != NULL);
+        EXPECT_TRUE(buf != NULL);
+        if (file == NULL || buf == NULL)
+            return Z_ERRNO;
+        *len = 0;
+        do {
+            got = PREFIX(gzread)(file, buf + *len, 65536 < DATA_SIZE - *len ? 65536 : (unsigned)(DATA_SIZE - *len));
+            if (got > 0)
+                *len += got;
+        } while (got > 0);
+        EXPECT_EQ(memcmp(buf, data, *len < valid ? *len : valid), 0);
+        PREFIX(gzerror)(file, &err);
+        PREFIX(gzclose)(file);
+        free(buf);
+        return err;
+    }
+
+    /* Return where the data of the member with byte pos of the len bytes at buf starts in data */
+    size_t member_start(const uint8_t *buf, size_t len, size_t pos) {
+        PREFIX3(stream) strm;
+        uint8_t *out = (uint8_t *)malloc(DATA_SIZE);
+        size_t start = 0;
+
+        memset(&strm, 0, sizeof(strm));
+        EXPECT_TRUE(out != NULL);
+        if (out == NULL || PREFIX(inflateInit2)(&strm, MAX_WBITS + 16) != Z_OK) {
+            free(out);
+            return 0;
+        }
+        strm.next_in = (z_const uint8_t *)buf;
+        strm.avail_in = (uint32_t)len;
+        strm.next_out = out;
+        strm.avail_out = DATA_SIZE;
+        while (PREFIX(inflate)(&strm, Z_NO_FLUSH) == Z_STREAM_END && len - strm.avail_in <= pos) {
+            start = DATA_SIZE - strm.avail_out;
+            PREFIX(inflateReset)(&strm);
+        }
+        PREFIX(inflateEnd)(&strm);
+        free(out);
+        return start;
+    }
+};
+
+TEST_F(gzio_parallel, read) {
+    EXPECT_GT(write_members(30000), 100U);
+    read("rP", DATA_SIZE, 1);
+    read("rP", DATA_SIZE, 2);
+    read("rP", DATA_SIZE, 7);
+    read("rP", DATA_SIZE, 0);
+    read("rb", DATA_SIZE, 1);
+
+    /* Members too big to decode several at a time */
+    write_members(1500000);
+    read("rP", DATA_SIZE, 2);
+    read("rP", DATA_SIZE, 0);
+
+    /* A single member */
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    member(data, DATA_SIZE, 6);
+    fclose(f);
+    f = NULL;
+    read("rP", DATA_SIZE, 3);
+}
+
+TEST_F(gzio_parallel, ungetc) {
+    /* Bytes pushed back go in front of the rest of the batch, with many members or just one */
+    write_members(30000);
+    read("rP", DATA_SIZE, 1, true);
+    read("rP", DATA_SIZE, 3, true);
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    member(data, DATA_SIZE, 6);
+    fclose(f);
+    f = NULL;
+    read("rP", DATA_SIZE, 1, true);
+    read("rP", DATA_SIZE, 3, true);
+}
+
+TEST_F(gzio_parallel, headers) {
+    PREFIX(gz_header) head;
+    static uint8_t extra[] = { 'A', 'B', 3, 0, 1, 2, 3 };
+    static uint8_t name[] = "name";
+    static uint8_t comment[] = "comment";
+    size_t pos, n;
+
+    /* Members with all kinds of header fields */
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    for (pos = 0, n = 0; pos < DATA_SIZE; pos += 100000, n++) {
+        memset(&head, 0, sizeof(head));
+        head.extra = n & 1 ? extra : NULL;
+        head.extra_len = sizeof(extra);
+        head.name = n & 2 ? name : NULL;
+        head.comment = n & 4 ? comment : NULL;
+        head.hcrc = (n & 8) != 0;
+        member(data + pos, pos + 100000 < DATA_SIZE ? 100000 : DATA_SIZE - pos, 6, &head);
+    }
+    fclose(f);
+    f = NULL;
+    read("rP", DATA_SIZE, 4);
+}
+
+TEST_F(gzio_parallel, false_header) {
+    static const uint8_t fake[] = { 31, 139, 8, 0, 0, 0, 0, 0, 0, 3 };
+    size_t pos;
+
+    /* Stored members with what looks like a gzip header and a small trailer in their data */
+    for (pos = 1000; pos + 1000 < DATA_SIZE; pos += 77777) {
+        memcpy(data + pos, fake, sizeof(fake));
+        memset(data + pos + 200, 0, 8);
+    }
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    for (pos = 0; pos < DATA_SIZE; pos += 50000)
+        member(data + pos, pos + 50000 < DATA_SIZE ? 50000 : DATA_SIZE - pos, pos % 150000 ? 6 : 0);
+    fclose(f);
+    f = NULL;
+    read("rP", DATA_SIZE, 3);
+}
+
+TEST_F(gzio_parallel, errors) {
+    uint8_t *buf;
+    size_t len, got, start;
+
+    write_members(30000);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+
+    /* Trailing garbage is ignored */
+    f = fopen(TESTFILE, "ab");
+    ASSERT_TRUE(f != NULL);
+    fwrite("garbage", 1, 7, f);
+    fclose(f);
+    f = NULL;
+    read("rP", DATA_SIZE, 3);
+
+    /* Truncated in the middle of a member */
+    gzio_replace(TESTFILE, buf, len / 2);
+    EXPECT_EQ(read_error(&got), Z_BUF_ERROR);
+    EXPECT_GT(got, 0U);
+
+    /* Corrupted data in a member in the middle, with the data before it read correctly */
+    start = member_start(buf, len, len / 2);
+    EXPECT_GT(start, 0U);
+    buf[len / 2] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    EXPECT_EQ(read_error(&got, start), Z_DATA_ERROR);
+    EXPECT_GT(got + 65536, start);  /* less what the gzread() that failed had copied */
+    EXPECT_LT(got, (size_t)DATA_SIZE);
+
+    free(buf);
+}
+
+TEST_F(gzio_parallel, other) {
+    gzFile file;
+
+    /* Not gzip at all */
+    f = fopen(TESTFILE, "wb");
+    ASSERT_TRUE(f != NULL);
+    fwrite(data, 1, 100000, f);
+    fclose(f);
+    f = NULL;
+    read("rP", 100000, 2);
+
+    /* "P" is ignored when writing */
+#ifndef NO_GZCOMPRESS
+    file = PREFIX(gzopen)(TESTFILE, "wP");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 100000), 100000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    read("rP", 100000, 2);
+#else
+    Z_UNUSED(file);
+#endif
+}
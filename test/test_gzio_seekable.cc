@@ -0,0 +1,250 @@
+/* test_gzio_seekable.cc - Test writing seekable gzip files with an index, and seeking in them */
+
+#include "test_gzio_shared.h"
+
+#include <fcntl.h>
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+#define TESTFILE "seekable.gz"
+#define DATA_SIZE (3 * 1024 * 1024 + 1234)
+
+class gzio_seekable : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 300000, 3);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Write len bytes of data from pos to file in pieces of many sizes */
+    void write(gzFile file, size_t pos, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_write(file, data + pos, len, 200003, 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Return true if TESTFILE ends with the locator of an index */
+    bool indexed() {
+        size_t len;
+        uint8_t *buf = gzio_load(TESTFILE, &len);
+        bool ret;
+
+        if (buf == NULL)
+            return false;
+        ret = len > 30 && memcmp(buf + len - 30, "ZX\20\0", 4) == 0 && buf[len - 10] == 3;
+        free(buf);
+        return ret;
+    }
+
+    /* Read all of file and compare it with the first len bytes of data */
+    void read(gzFile file, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Seek around in file and check the data there */
+    void seek(gzFile file) {
+        static const size_t positions[] = { 2500000, 5, 1048576, 1048575, 3000000, 0, 777777, DATA_SIZE - 1 };
+        uint8_t buf[100];
+        size_t i, n;
+
+        ASSERT_TRUE(file != NULL);
+        for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+            n = DATA_SIZE - positions[i] < sizeof(buf) ? DATA_SIZE - positions[i] : sizeof(buf);
+            EXPECT_EQ(PREFIX(gzseek)(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+            EXPECT_EQ(PREFIX(gzread)(file, buf, (unsigned)n), (int)n);
+            EXPECT_EQ(memcmp(buf, data + positions[i], n), 0) << "position " << positions[i];
+            EXPECT_EQ(PREFIX(gztell)(file), (z_off_t)(positions[i] + n));
+        }
+        EXPECT_EQ(PREFIX(gzrewind)(file), 0);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), (int)sizeof(buf));
+        EXPECT_EQ(memcmp(buf, data, sizeof(buf)), 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Damage the first gzip stream of TESTFILE, so that only reading that goes past it with the index works */
+    void damage(size_t pos) {
+        size_t len;
+        uint8_t *buf = gzio_load(TESTFILE, &len);
+
+        ASSERT_TRUE(buf != NULL);
+        for (size_t i = pos + 1000; i < pos + 2000; i++)
+            buf[i] = (uint8_t)~buf[i];
+        gzio_replace(TESTFILE, buf, len);
+        free(buf);
+    }
+};
+
+TEST_F(gzio_seekable, write) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+    uint8_t buf[64];
+    int err;
+
+    write(PREFIX(gzopen)(TESTFILE, "wS"), 0, DATA_SIZE);
+    EXPECT_TRUE(indexed());
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "rP"), DATA_SIZE);
+
+    /* Seek with the index in all the ways of reading */
+    seek(PREFIX(gzopen)(TESTFILE, "rb"));
+    seek(PREFIX(gzopen)(TESTFILE, "rm"));
+    seek(PREFIX(gzopen)(TESTFILE, "ru"));
+    seek(PREFIX(gzopen)(TESTFILE, "rP"));
+    seek(PREFIX(gzopen)(TESTFILE, "rA"));
+
+    /* The index goes past the start of the file */
+    damage(0);
+    file = PREFIX(gzopen)(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseek)(file, 2000000, SEEK_SET), 2000000);
+    EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), (int)sizeof(buf));
+    EXPECT_EQ(memcmp(buf, data + 2000000, sizeof(buf)), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseek)(file, 10000, SEEK_SET), 10000);
+    EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), -1);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    PREFIX(gzclose)(file);
+
+    /* Less than a span is a single gzip stream, with no index */
+    write(PREFIX(gzopen)(TESTFILE, "wS"), 0, 1000000);
+    EXPECT_FALSE(indexed());
+    read(PREFIX(gzopen)(TESTFILE, "rb"), 1000000);
+
+    /* "S" is ignored when not compressing */
+    write(PREFIX(gzopen)(TESTFILE, "wST"), 0, 100000);
+    file = PREFIX(gzopen)(TESTFILE, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzdirect)(file), 1);
+    read(file, 100000);
+#endif
+}
+
+TEST_F(gzio_seekable, append) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, tail[10];
+    gzFile file;
+    size_t len;
+    int fd;
+
+    /* The index of what's appended doesn't count from the start, so it's not used, but seeking still works */
+    write(PREFIX(gzopen)(TESTFILE, "wS"), 0, 1500000);
+    write(PREFIX(gzopen)(TESTFILE, "aS"), 1500000, DATA_SIZE - 1500000);
+    EXPECT_TRUE(indexed());
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE);
+    seek(PREFIX(gzopen)(TESTFILE, "rb"));
+
+    /* Written and read from the same offset in the file, the index is used */
+    gzio_replace(TESTFILE, data, 1000);
+    fd = open(TESTFILE, O_WRONLY);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(lseek(fd, 1000, SEEK_SET), 1000);
+    write(PREFIX(gzdopen)(fd, "wS"), 0, DATA_SIZE);
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    EXPECT_EQ(memcmp(buf, data, 1000), 0);
+    free(buf);
+    fd = open(TESTFILE, O_RDONLY);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(lseek(fd, 1000, SEEK_SET), 1000);
+    seek(PREFIX(gzdopen)(fd, "rb"));
+    damage(1000);
+    fd = open(TESTFILE, O_RDONLY);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(lseek(fd, 1000, SEEK_SET), 1000);
+    file = PREFIX(gzdopen)(fd, "rb");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseek)(file, DATA_SIZE - 10, SEEK_SET), DATA_SIZE - 10);
+    EXPECT_EQ(PREFIX(gzread)(file, tail, 10), 10);
+    EXPECT_EQ(memcmp(tail, data + DATA_SIZE - 10, 10), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+
+#ifndef ZLIB_COMPAT
+TEST_F(gzio_seekable, span) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+    size_t len, plain;
+    uint8_t *buf;
+
+    write(PREFIX(gzopen)(TESTFILE, "w"), 0, DATA_SIZE);
+    buf = gzio_load(TESTFILE, &plain);
+    free(buf);
+
+    /* Small spans, with more entries than fit in one extra field */
+    file = PREFIX(gzopen)(TESTFILE, "w");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 500), 0);
+    write(file, 0, DATA_SIZE);
+    EXPECT_TRUE(indexed());
+    buf = gzio_load(TESTFILE, &len);
+    ASSERT_TRUE(buf != NULL);
+    EXPECT_GT(len, plain + DATA_SIZE / 500 * 16);
+    free(buf);
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE);
+    seek(PREFIX(gzopen)(TESTFILE, "rb"));
+
+    /* With gzflush() ending streams in between */
+    file = PREFIX(gzopen)(TESTFILE, "wS");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 200000), 0);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 300001), 300001);
+    EXPECT_EQ(PREFIX(gzflush)(file, Z_FINISH), Z_OK);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 300001, 99999), 99999);
+    EXPECT_EQ(PREFIX(gzflush)(file, Z_FINISH), Z_OK);
+    write(file, 400000, DATA_SIZE - 400000);
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE);
+    seek(PREFIX(gzopen)(TESTFILE, "rb"));
+
+    /* A span of zero is a single gzip stream */
+    file = PREFIX(gzopen)(TESTFILE, "wS");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 0), 0);
+    write(file, 0, DATA_SIZE);
+    EXPECT_FALSE(indexed());
+    buf = gzio_load(TESTFILE, &len);
+    free(buf);
+    EXPECT_EQ(len, plain);
+
+    /* Not after writing, not for reading, and not with "T" or "B" */
+    file = PREFIX(gzopen)(TESTFILE, "wS");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 10), 10);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 1000), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "r");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 1000), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "wT");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 1000), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    file = PREFIX(gzopen)(TESTFILE, "wB");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzseekable)(file, 1000), -1);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+#endif
+}
+#endif
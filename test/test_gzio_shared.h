@@ -0,0 +1,147 @@
+#ifndef TEST_GZIO_SHARED_H
+#define TEST_GZIO_SHARED_H
+
+/* Test data and helpers shared by the gzio tests. */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+/* Next pseudo-random value from seed, the same on all platforms */
+static inline uint32_t gzio_rand(uint32_t *seed) {
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+/* Allocate len bytes of text-like data that compresses, with runs of random bytes that don't. The data is cut
+   into runs of run bytes, and the last run of every cycle runs is random. */
+static inline uint8_t *gzio_data(size_t len, size_t run, size_t cycle) {
+    uint8_t *data = (uint8_t *)malloc(len);
+    uint32_t seed = 1;
+
+    if (data == NULL)
+        return NULL;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t r = gzio_rand(&seed);
+        if ((i / run) % cycle == cycle - 1)
+            data[i] = (uint8_t)r;
+        else
+            data[i] = (uint8_t)("abcdefgh \n"[r % 10]);
+    }
+    return data;
+}
+
+/* Write len bytes of buf to file in pieces of many sizes up to max, with a sync flush after each piece whose
+   size is a multiple of flush, unless flush is zero */
+static inline void gzio_write(gzFile file, const uint8_t *buf, size_t len, size_t max, unsigned flush) {
+    size_t pos = 0, n = 1;
+
+    ASSERT_TRUE(file != NULL);
+    while (pos < len) {
+        n = n * 11 % max + 1;
+        if (n > len - pos)
+            n = len - pos;
+        ASSERT_EQ(PREFIX(gzwrite)(file, buf + pos, (unsigned)n), (int)n);
+        pos += n;
+        if (flush && n % flush == 0) {
+            ASSERT_EQ(PREFIX(gzflush)(file, Z_SYNC_FLUSH), Z_OK);
+        }
+    }
+}
+
+/* Read file to the end in pieces of many sizes up to max, or all at once if max is zero, and check that it
+   has the len bytes of buf */
+static inline void gzio_read(gzFile file, const uint8_t *buf, size_t len, size_t max) {
+    uint8_t *got_buf = (uint8_t *)malloc(len + 1);
+    size_t pos = 0, n = 1;
+    int got;
+
+    ASSERT_TRUE(file != NULL);
+    ASSERT_TRUE(got_buf != NULL);
+    do {
+        n = max ? n * 13 % max + 1 : len + 1;
+        got = PREFIX(gzread)(file, got_buf + pos, (unsigned)(n > len + 1 - pos ? len + 1 - pos : n));
+        EXPECT_GE(got, 0);
+        if (got < 0)
+            break;
+        pos += got;
+    } while (got > 0 && pos <= len);
+    EXPECT_EQ(pos, len);
+    EXPECT_EQ(memcmp(got_buf, buf, pos < len ? pos : len), 0);
+    EXPECT_EQ(PREFIX(gzeof)(file), 1);
+    free(got_buf);
+}
+
+/* Read file to the end in pieces of many sizes, with a byte read by gzgetc() and pushed back by gzungetc()
+   before each piece, and now and then the byte before it pushed back too, and check that it has the len bytes
+   of buf */
+static inline void gzio_read_ungetc(gzFile file, const uint8_t *buf, size_t len) {
+    uint8_t *got_buf = (uint8_t *)malloc(len + 1);
+    size_t pos = 0, n = 1;
+    int c, got;
+
+    ASSERT_TRUE(file != NULL);
+    ASSERT_TRUE(got_buf != NULL);
+    do {
+        c = PREFIX(gzgetc)(file);
+        if (c != -1) {
+            EXPECT_EQ(c, buf[pos]) << "at " << pos;
+            EXPECT_EQ(PREFIX(gzungetc)(c, file), c) << "at " << pos;
+            if (pos && n % 3 == 0) {
+                pos--;
+                EXPECT_EQ(PREFIX(gzungetc)(buf[pos], file), buf[pos]) << "at " << pos;
+            }
+        }
+        n = n * 13 % 100003 + 1;
+        got = PREFIX(gzread)(file, got_buf + pos, (unsigned)(n > len + 1 - pos ? len + 1 - pos : n));
+        EXPECT_GE(got, 0) << "at " << pos;
+        if (got < 0)
+            break;
+        pos += got;
+    } while (got > 0 && pos <= len);
+    EXPECT_EQ(pos, len);
+    EXPECT_EQ(memcmp(got_buf, buf, pos < len ? pos : len), 0);
+    EXPECT_EQ(PREFIX(gzeof)(file), 1);
+    free(got_buf);
+}
+
+/* Load the file at path into allocated memory, with room for one more byte */
+static inline uint8_t *gzio_load(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf;
+
+    EXPECT_TRUE(f != NULL);
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = (uint8_t *)malloc(*len + 1);
+    EXPECT_TRUE(buf != NULL);
+    if (buf != NULL) {
+        EXPECT_EQ(fread(buf, 1, *len, f), *len);
+    }
+    fclose(f);
+    return buf;
+}
+
+/* Replace the file at path with len bytes of buf */
+static inline void gzio_replace(const char *path, const uint8_t *buf, size_t len) {
+    FILE *f = fopen(path, "wb");
+
+    ASSERT_TRUE(f != NULL);
+    EXPECT_EQ(fwrite(buf, 1, len, f), len);
+    fclose(f);
+}
+
+#endif
@@ -0,0 +1,230 @@
+/* test_gzio_uring.cc - Test reading and writing gzip files with io_uring */
+
+#include "test_gzio_shared.h"
+
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
+
+#define TESTFILE "uring.gz"
+#define DATA_SIZE (2 * 1024 * 1024 + 999)
+
+class gzio_uring : public ::testing::Test {
+public:
+    uint8_t *data;
+
+    void SetUp() {
+        data = gzio_data(DATA_SIZE, 200000, 3);
+        ASSERT_TRUE(data != NULL);
+    }
+
+    void TearDown() {
+        free(data);
+        remove(TESTFILE);
+    }
+
+    /* Size of TESTFILE */
+    long file_size() {
+        FILE *f = fopen(TESTFILE, "rb");
+        long size;
+
+        EXPECT_TRUE(f != NULL);
+        if (f == NULL)
+            return -1;
+        fseek(f, 0, SEEK_END);
+        size = ftell(f);
+        fclose(f);
+        return size;
+    }
+
+    /* Write len bytes of data from pos to file in pieces of many sizes, with a flush now and then */
+    void write(gzFile file, size_t pos, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_write(file, data + pos, len, 200003, 5);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+
+    /* Read file back in pieces of many sizes, and compare it with the first len bytes of data */
+    void read(gzFile file, size_t len) {
+        ASSERT_TRUE(file != NULL);
+        gzio_read(file, data, len, 300007);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+};
+
+TEST_F(gzio_uring, write) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+
+    write(PREFIX(gzopen)(TESTFILE, "wu"), 0, DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "rb"), DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "ru"), DATA_SIZE);
+
+    /* Small buffers, so that many writes are in flight */
+    file = PREFIX(gzopen)(TESTFILE, "wu1");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzbuffer)(file, 4096), 0);
+    write(file, 0, DATA_SIZE);
+    file = PREFIX(gzopen)(TESTFILE, "ru");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzbuffer)(file, 4096), 0);
+    read(file, DATA_SIZE);
+
+    /* Appending */
+    write(PREFIX(gzopen)(TESTFILE, "wu"), 0, 700000);
+    write(PREFIX(gzopen)(TESTFILE, "au"), 700000, DATA_SIZE - 700000);
+    read(PREFIX(gzopen)(TESTFILE, "ru"), DATA_SIZE);
+
+    /* The offset is where the data is up to once flushed */
+    file = PREFIX(gzopen)(TESTFILE, "wu");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 1000000), 1000000);
+    EXPECT_EQ(PREFIX(gzflush)(file, Z_SYNC_FLUSH), Z_OK);
+    EXPECT_EQ(PREFIX(gzoffset)(file), (z_off_t)file_size());
+    EXPECT_GT(PREFIX(gzoffset)(file), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    /* "u" is ignored when not compressing */
+    file = PREFIX(gzopen)(TESTFILE, "wuT");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 100000), 100000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    EXPECT_EQ(file_size(), 100000);
+    read(PREFIX(gzopen)(TESTFILE, "ru"), 100000);
+#endif
+}
+
+TEST_F(gzio_uring, read) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 500000);
+    write(PREFIX(gzopen)(TESTFILE, "ab1"), 500000, DATA_SIZE - 500000);
+    read(PREFIX(gzopen)(TESTFILE, "ru"), DATA_SIZE);
+
+    /* Combined with the other read modes */
+    read(PREFIX(gzopen)(TESTFILE, "ruP"), DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "ruA"), DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "rum"), DATA_SIZE);
+    write(PREFIX(gzopen)(TESTFILE, "wB"), 0, DATA_SIZE);
+    read(PREFIX(gzopen)(TESTFILE, "ruB"), DATA_SIZE);
+
+    /* Empty */
+    write(PREFIX(gzopen)(TESTFILE, "wT"), 0, 0);
+    read(PREFIX(gzopen)(TESTFILE, "ru"), 0);
+#endif
+}
+
+#ifndef _WIN32
+TEST_F(gzio_uring, pipe) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    gzFile file;
+    int fds[2];
+
+    /* Small enough for the pipe to hold all of it */
+    ASSERT_EQ(pipe(fds), 0);
+    file = PREFIX(gzdopen)(fds[1], "wu");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data, 50000), 50000);
+    EXPECT_EQ(PREFIX(gzflush)(file, Z_SYNC_FLUSH), Z_OK);
+    EXPECT_EQ(PREFIX(gzwrite)(file, data + 50000, 50000), 50000);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    read(PREFIX(gzdopen)(fds[0], "ru"), 100000);
+#endif
+}
+#endif
+
+TEST_F(gzio_uring, seek) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    static const size_t positions[] = { 1000000, 5, 2000000, 1999999, 0, 777777, DATA_SIZE - 1 };
+    gzFile file;
+    uint8_t buf[100];
+    size_t i;
+    int direct;
+
+    for (direct = 0; direct < 2; direct++) {
+        write(PREFIX(gzopen)(TESTFILE, direct ? "wT" : "wb"), 0, DATA_SIZE);
+        file = PREFIX(gzopen)(TESTFILE, "ru");
+        ASSERT_TRUE(file != NULL);
+        for (i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+            EXPECT_EQ(PREFIX(gzseek)(file, (z_off_t)positions[i], SEEK_SET), (z_off_t)positions[i]);
+            EXPECT_EQ(PREFIX(gzread)(file, buf, 1), 1);
+            EXPECT_EQ(buf[0], data[positions[i]]) << "position " << positions[i];
+            EXPECT_EQ(PREFIX(gztell)(file), (z_off_t)positions[i] + 1);
+        }
+        EXPECT_EQ(PREFIX(gzdirect)(file), direct);
+        EXPECT_EQ(PREFIX(gzrewind)(file), 0);
+        EXPECT_EQ(PREFIX(gzread)(file, buf, sizeof(buf)), (int)sizeof(buf));
+        EXPECT_EQ(memcmp(buf, data, sizeof(buf)), 0);
+        EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+    }
+#endif
+}
+
+TEST_F(gzio_uring, errors) {
+#ifdef NO_GZCOMPRESS
+    GTEST_SKIP();
+#else
+    uint8_t *buf, *out;
+    size_t len, pos;
+    gzFile file;
+    int err, got;
+
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, DATA_SIZE);
+    buf = gzio_load(TESTFILE, &len);
+    out = (uint8_t *)malloc(DATA_SIZE);
+    ASSERT_TRUE(buf != NULL && out != NULL);
+
+    /* Truncated */
+    gzio_replace(TESTFILE, buf, len / 2);
+    file = PREFIX(gzopen)(TESTFILE, "ru");
+    ASSERT_TRUE(file != NULL);
+    got = PREFIX(gzread)(file, out, DATA_SIZE);
+    EXPECT_GT(got, 0);
+    EXPECT_LT(got, DATA_SIZE);
+    EXPECT_EQ(memcmp(out, data, got), 0);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_BUF_ERROR);
+
+    /* Corrupted */
+    buf[len / 2] ^= 0x55;
+    gzio_replace(TESTFILE, buf, len);
+    file = PREFIX(gzopen)(TESTFILE, "ru");
+    ASSERT_TRUE(file != NULL);
+    do {
+        got = PREFIX(gzread)(file, out, 65536);
+    } while (got > 0);
+    EXPECT_EQ(got, -1);
+    PREFIX(gzerror)(file, &err);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+    PREFIX(gzclose)(file);
+
+    /* Reading on after gzclearerr(), as the file is written */
+    write(PREFIX(gzopen)(TESTFILE, "wb"), 0, 300000);
+    file = PREFIX(gzopen)(TESTFILE, "ru");
+    ASSERT_TRUE(file != NULL);
+    pos = 0;
+    while ((got = PREFIX(gzread)(file, out + pos, 100000)) > 0)
+        pos += got;
+    EXPECT_EQ(got, 0);
+    EXPECT_EQ(pos, 300000U);
+    EXPECT_EQ(PREFIX(gzeof)(file), 1);
+    write(PREFIX(gzopen)(TESTFILE, "ab"), 300000, 200000);
+    PREFIX(gzclearerr)(file);
+    while ((got = PREFIX(gzread)(file, out + pos, 100000)) > 0)
+        pos += got;
+    EXPECT_EQ(pos, 500000U);
+    EXPECT_EQ(memcmp(out, data, pos), 0);
+    EXPECT_EQ(PREFIX(gzclose)(file), Z_OK);
+
+    free(out);
+    free(buf);
+#endif
+}
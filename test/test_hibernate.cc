@@ -0,0 +1,166 @@
+/* test_hibernate.cc - Test hibernating and waking idle deflate and inflate streams */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define MESSAGES     40
+#define MESSAGE_SIZE 3000
+#define OUT_SIZE     (2 * MESSAGE_SIZE)
+
+/* Messages that share most of their content, as a chat or RPC protocol would */
+static void make_message(uint8_t *msg, int n) {
+    for (int i = 0; i < MESSAGE_SIZE; i++) {
+        if (i % 97 == 0)
+            msg[i] = (uint8_t)('0' + (n + i) % 10);
+        else
+            msg[i] = (uint8_t)hello[(i + n * 13) % hello_len];
+    }
+}
+
+class hibernate : public ::testing::TestWithParam<int> {
+public:
+    zng_stream c_stream, d_stream;
+    size_t live_bytes;
+
+    void SetUp() {
+        live_bytes = 0;
+        memset(&c_stream, 0, sizeof(c_stream));
+        memset(&d_stream, 0, sizeof(d_stream));
+        c_stream.zalloc = d_stream.zalloc = counting_alloc;
+        c_stream.zfree = d_stream.zfree = counting_free;
+        c_stream.opaque = d_stream.opaque = &live_bytes;
+    }
+
+    void TearDown() {
+        EXPECT_EQ(live_bytes, 0);
+    }
+
+    /* Compress and decompress each message with a sync flush, optionally hibernating both streams in between.
+       Returns the total compressed size. */
+    size_t exchange(int level, bool hibernate_streams) {
+        uint8_t msg[MESSAGE_SIZE], out[OUT_SIZE], back[MESSAGE_SIZE];
+        size_t total = 0;
+        int32_t err;
+
+        err = zng_deflateInit2(&c_stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+        EXPECT_EQ(err, Z_OK);
+        err = zng_inflateInit2(&d_stream, -MAX_WBITS);
+        EXPECT_EQ(err, Z_OK);
+
+        for (int n = 0; n < MESSAGES; n++) {
+            int32_t flags = (n & 1) ? Z_HIBERNATE_COMPRESS : 0;
+
+            make_message(msg, n);
+            c_stream.next_in = msg;
+            c_stream.avail_in = MESSAGE_SIZE;
+            c_stream.next_out = out;
+            c_stream.avail_out = OUT_SIZE;
+            err = zng_deflate(&c_stream, Z_SYNC_FLUSH);
+            EXPECT_EQ(err, Z_OK);
+            EXPECT_EQ(c_stream.avail_in, 0);
+            EXPECT_NE(c_stream.avail_out, 0);
+            total += OUT_SIZE - c_stream.avail_out;
+
+            d_stream.next_in = out;
+            d_stream.avail_in = OUT_SIZE - c_stream.avail_out;
+            d_stream.next_out = back;
+            d_stream.avail_out = MESSAGE_SIZE;
+            err = zng_inflate(&d_stream, Z_SYNC_FLUSH);
+            EXPECT_EQ(err, Z_OK);
+            EXPECT_EQ(d_stream.avail_out, 0);
+            EXPECT_EQ(memcmp(msg, back, MESSAGE_SIZE), 0);
+
+            if (hibernate_streams) {
+                size_t awake = live_bytes;
+
+                err = zng_deflateHibernate(&c_stream, flags);
+                EXPECT_EQ(err, Z_OK);
+                err = zng_inflateHibernate(&d_stream, flags);
+                EXPECT_EQ(err, Z_OK);
+                if (flags & Z_HIBERNATE_COMPRESS)
+                    EXPECT_LT(live_bytes * 10, awake);
+                else
+                    EXPECT_LT(live_bytes, awake);
+
+                err = zng_deflateWake(&c_stream);
+                EXPECT_EQ(err, Z_OK);
+                err = zng_inflateWake(&d_stream);
+                EXPECT_EQ(err, Z_OK);
+            }
+        }
+
+        /* The connection is dropped without finishing the stream */
+        err = zng_deflateEnd(&c_stream);
+        EXPECT_EQ(err, Z_DATA_ERROR);
+        err = zng_inflateEnd(&d_stream);
+        EXPECT_EQ(err, Z_OK);
+        return total;
+    }
+};
+
+TEST_P(hibernate, roundtrip) {
+    int level = GetParam();
+    size_t reference = exchange(level, false);
+    size_t hibernated = exchange(level, true);
+
+    /* The history survives hibernation, so later messages still compress against earlier ones */
+    EXPECT_LE(hibernated, reference + reference / 10);
+}
+
+INSTANTIATE_TEST_SUITE_P(hibernate, hibernate, testing::Range(0, 10));
+
+TEST_F(hibernate, states) {
+    uint8_t msg[MESSAGE_SIZE], out[64];
+    int32_t err;
+
+    make_message(msg, 0);
+    err = zng_deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    EXPECT_EQ(err, Z_OK);
+    err = zng_inflateInit(&d_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    /* A fresh stream has no history */
+    err = zng_deflateHibernate(&c_stream, Z_HIBERNATE_COMPRESS);
+    EXPECT_EQ(err, Z_OK);
+    err = zng_deflateWake(&c_stream);
+    EXPECT_EQ(err, Z_OK);
+    err = zng_deflateWake(&c_stream);
+    EXPECT_EQ(err, Z_STREAM_ERROR);
+
+    /* Pending output cannot be dropped */
+    c_stream.next_in = msg;
+    c_stream.avail_in = MESSAGE_SIZE;
+    c_stream.next_out = out;
+    c_stream.avail_out = sizeof(out);
+    err = zng_deflate(&c_stream, Z_SYNC_FLUSH);
+    EXPECT_EQ(err, Z_OK);
+    EXPECT_EQ(c_stream.avail_out, 0);
+    err = zng_deflateHibernate(&c_stream, 0);
+    EXPECT_EQ(err, Z_BUF_ERROR);
+    err = zng_deflateHibernate(&c_stream, 2);
+    EXPECT_EQ(err, Z_STREAM_ERROR);
+
+    /* Hibernated streams can only be woken or ended */
+    err = zng_inflateHibernate(&d_stream, 0);
+    EXPECT_EQ(err, Z_OK);
+    err = zng_inflateHibernate(&d_stream, 0);
+    EXPECT_EQ(err, Z_STREAM_ERROR);
+    err = zng_inflate(&d_stream, Z_NO_FLUSH);
+    EXPECT_EQ(err, Z_STREAM_ERROR);
+    err = zng_inflateReset(&d_stream);
+    EXPECT_EQ(err, Z_STREAM_ERROR);
+    err = zng_inflateEnd(&d_stream);
+    EXPECT_EQ(err, Z_OK);
+
+    err = zng_deflateEnd(&c_stream);
+    EXPECT_EQ(err, Z_DATA_ERROR);
+}
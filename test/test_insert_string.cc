@@ -0,0 +1,104 @@
+/* test_insert_string.cc -- insert_string unit tests
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+extern "C" {
+#  include "zbuild.h"
+#  include "zutil_p.h"
+#  include "deflate.h"
+#  include "arch_functions.h"
+#  include "test_cpu_features.h"
+}
+
+#include <gtest/gtest.h>
+
+#define W_BITS      15
+#define W_SIZE      (1 << W_BITS)
+#define WINDOW_SIZE (2 * W_SIZE)
+
+typedef void (*insert_string_func)(deflate_state *const s, uint32_t str, uint32_t count);
+
+class insert_string_variant : public ::testing::Test {
+public:
+    deflate_state *s_ref;
+    deflate_state *s_test;
+
+    deflate_state *create_state(const uint8_t *window) {
+        deflate_state *s = (deflate_state *)zng_alloc(sizeof(deflate_state));
+        memset(s, 0, sizeof(deflate_state));
+        s->w_size = W_SIZE;
+        s->w_mask = W_SIZE - 1;
+        s->window = (unsigned char *)zng_alloc(WINDOW_SIZE);
+        memcpy(s->window, window, WINDOW_SIZE);
+        s->head = (Pos *)zng_alloc(HASH_SIZE * sizeof(Pos));
+        memset(s->head, 0, HASH_SIZE * sizeof(Pos));
+        s->prev = (Pos *)zng_alloc(W_SIZE * sizeof(Pos));
+        memset(s->prev, 0, W_SIZE * sizeof(Pos));
+        return s;
+    }
+
+    void free_state(deflate_state *s) {
+        zng_free(s->window);
+        zng_free(s->head);
+        zng_free(s->prev);
+        zng_free(s);
+    }
+
+    void SetUp() {
+        uint8_t *window = (uint8_t *)malloc(WINDOW_SIZE);
+        /* Mix repetitive and random data so that hash chains have collisions */
+        for (uint32_t i = 0; i < WINDOW_SIZE; i++)
+            window[i] = (i & 0x400) ? (uint8_t)(i % 7) : (uint8_t)rand();
+        s_ref = create_state(window);
+        s_test = create_state(window);
+        free(window);
+    }
+
+    void TearDown() {
+        free_state(s_ref);
+        free_state(s_test);
+    }
+
+    void insert(insert_string_func insert_string_fn) {
+        static const uint32_t counts[] = { 1, 2, 12, 13, 16, 17, 31, 32, 33, 100, 255, 258, 4096 };
+        uint32_t str = 1;
+
+        for (uint32_t i = 0; str + 4096 + 4 < WINDOW_SIZE; i++) {
+            uint32_t count = counts[i % (sizeof(counts) / sizeof(counts[0]))];
+            insert_string(s_ref, str, count);
+            insert_string_fn(s_test, str, count);
+            str += count + (i % 3);
+        }
+
+        EXPECT_EQ(memcmp(s_ref->head, s_test->head, HASH_SIZE * sizeof(Pos)), 0);
+        EXPECT_EQ(memcmp(s_ref->prev, s_test->prev, W_SIZE * sizeof(Pos)), 0);
+    }
+};
+
+#define TEST_INSERT_STRING(name, func, support_flag) \
+    TEST_F(insert_string_variant, name) { \
+        if (!support_flag) { \
+            GTEST_SKIP(); \
+            return; \
+        } \
+        insert(func); \
+    }
+
+TEST_INSERT_STRING(c, insert_string, 1)
+
+#ifdef DISABLE_RUNTIME_CPU_DETECTION
+TEST_INSERT_STRING(native, native_insert_string, 1)
+#else
+
+#ifdef X86_AVX2
+TEST_INSERT_STRING(avx2, insert_string_avx2, test_cpu_features.x86.has_avx2)
+#endif
+#ifdef ARM_NEON
+TEST_INSERT_STRING(neon, insert_string_neon, test_cpu_features.arm.has_neon)
+#endif
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef TEST_SHARED_H
 #define TEST_SHARED_H
 
+#include <stdlib.h>
+#include <string.h>
+
 /* Test definitions that can be used in the original zlib build environment. */
 
 /* "hello world" would be more standard, but the repeated "hello"
@@ -9,6 +12,25 @@
 static const char hello[] = "hello, hello!";
 static const int hello_len = sizeof(hello);
 
+/* Allocator that keeps track of the number of bytes in use, in the size_t that opaque points to */
+static inline void *counting_alloc(void *opaque, unsigned items, unsigned size) {
+    size_t len = (size_t)items * size;
+    unsigned char *p = (unsigned char *)malloc(len + 16);
+    if (p == NULL)
+        return NULL;
+    memcpy(p, &len, sizeof(len));
+    *(size_t *)opaque += len;
+    return p + 16;
+}
+
+static inline void counting_free(void *opaque, void *ptr) {
+    unsigned char *p = (unsigned char *)ptr - 16;
+    size_t len;
+    memcpy(&len, p, sizeof(len));
+    *(size_t *)opaque -= len;
+    free(p);
+}
+
 /* Clang static analyzer doesn't understand googletest's ASSERT_TRUE, so we need to tell that it's like assert() */
 #ifdef __clang_analyzer__
 #  undef  ASSERT_TRUE
@@ -0,0 +1,197 @@
+/* test_source_size.cc - Test sizing deflate buffers for the expected input size */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "test_shared.h"
+
+#define MESSAGE_SIZE 300
+
+static void make_input(uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++)
+        buf[i] = (i % 31 == 0) ? (uint8_t)(i * 7) : (uint8_t)hello[i % hello_len];
+}
+
+class source_size : public ::testing::Test {
+public:
+    zng_stream c_stream;
+    size_t live_bytes;
+
+    void SetUp() {
+        live_bytes = 0;
+        memset(&c_stream, 0, sizeof(c_stream));
+        c_stream.zalloc = counting_alloc;
+        c_stream.zfree = counting_free;
+        c_stream.opaque = &live_bytes;
+    }
+
+    void TearDown() {
+        EXPECT_EQ(live_bytes, 0);
+    }
+
+    int32_t set_source_size(size_t size) {
+        zng_deflate_param_value param;
+        param.param = Z_DEFLATE_SOURCE_SIZE;
+        param.buf = &size;
+        param.size = sizeof(size);
+        int32_t err = zng_deflateSetParams(&c_stream, &param, 1);
+        if (err == Z_STREAM_ERROR) {
+            EXPECT_NE(param.status, Z_OK);
+        }
+        return err;
+    }
+
+    /* Compress len bytes of input in one go and check that it decompresses back */
+    void roundtrip(const uint8_t *input, size_t len) {
+        size_t out_size = zng_compressBound(len);
+        uint8_t *out = (uint8_t *)malloc(out_size);
+        uint8_t *back = (uint8_t *)malloc(len + 1);
+        zng_stream d_stream;
+        int32_t err;
+
+        c_stream.next_in = input;
+        c_stream.avail_in = (uint32_t)len;
+        c_stream.next_out = out;
+        c_stream.avail_out = (uint32_t)out_size;
+        err = zng_deflate(&c_stream, Z_FINISH);
+        EXPECT_EQ(err, Z_STREAM_END);
+
+        /* Detect the zlib or gzip wrapper */
+        memset(&d_stream, 0, sizeof(d_stream));
+        err = zng_inflateInit2(&d_stream, MAX_WBITS + 32);
+        EXPECT_EQ(err, Z_OK);
+        d_stream.next_in = out;
+        d_stream.avail_in = (uint32_t)c_stream.total_out;
+        d_stream.next_out = back;
+        d_stream.avail_out = (uint32_t)len + 1;
+        err = zng_inflate(&d_stream, Z_FINISH);
+        EXPECT_EQ(err, Z_STREAM_END);
+        EXPECT_EQ(d_stream.total_out, len);
+        EXPECT_EQ(memcmp(input, back, len), 0);
+        EXPECT_EQ(zng_inflateEnd(&d_stream), Z_OK);
+
+        free(back);
+        free(out);
+    }
+};
+
+TEST_F(source_size, shrinks_buffers) {
+    uint8_t input[MESSAGE_SIZE];
+    size_t full, hinted, value = 0;
+    zng_deflate_param_value param;
+
+    make_input(input, sizeof(input));
+
+    for (int level = 0; level <= 9; level++) {
+        EXPECT_EQ(zng_deflateInit(&c_stream, level), Z_OK);
+        full = live_bytes;
+        EXPECT_EQ(set_source_size(sizeof(input)), Z_OK);
+        hinted = live_bytes;
+        EXPECT_LT(hinted, full);
+
+        param.param = Z_DEFLATE_SOURCE_SIZE;
+        param.buf = &value;
+        param.size = sizeof(value);
+        EXPECT_EQ(zng_deflateGetParams(&c_stream, &param, 1), Z_OK);
+        EXPECT_EQ(value, sizeof(input));
+
+        roundtrip(input, sizeof(input));
+        EXPECT_EQ(zng_deflateEnd(&c_stream), Z_OK);
+    }
+}
+
+TEST_F(source_size, underestimate) {
+    size_t len = 100000;
+    uint8_t *input = (uint8_t *)malloc(len);
+
+    make_input(input, len);
+    for (int level = 0; level <= 9; level++) {
+        EXPECT_EQ(zng_deflateInit2(&c_stream, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        EXPECT_EQ(set_source_size(10), Z_OK);
+        roundtrip(input, len);
+        EXPECT_EQ(zng_deflateEnd(&c_stream), Z_OK);
+    }
+    free(input);
+}
+
+TEST_F(source_size, too_late) {
+    uint8_t out[64];
+    size_t value = 0;
+    zng_deflate_param_value param;
+
+    EXPECT_EQ(zng_deflateInit(&c_stream, Z_DEFAULT_COMPRESSION), Z_OK);
+    c_stream.next_in = (const uint8_t *)hello;
+    c_stream.avail_in = hello_len;
+    c_stream.next_out = out;
+    c_stream.avail_out = sizeof(out);
+    EXPECT_EQ(zng_deflate(&c_stream, Z_NO_FLUSH), Z_OK);
+    EXPECT_EQ(set_source_size(hello_len), Z_STREAM_ERROR);
+
+    /* The default is unknown */
+    param.param = Z_DEFLATE_SOURCE_SIZE;
+    param.buf = &value;
+    param.size = sizeof(value);
+    EXPECT_EQ(zng_deflateGetParams(&c_stream, &param, 1), Z_OK);
+    EXPECT_EQ(value, SIZE_MAX);
+    EXPECT_EQ(zng_deflateEnd(&c_stream), Z_DATA_ERROR);
+}
+
+static void *failing_alloc(void *opaque, unsigned items, unsigned size) {
+    Z_UNUSED(opaque);
+    Z_UNUSED(items);
+    Z_UNUSED(size);
+    return NULL;
+}
+
+TEST_F(source_size, out_of_memory) {
+    size_t value = 0;
+    zng_deflate_param_value param;
+
+    /* The hint is not kept if the stream cannot be moved to smaller buffers */
+    EXPECT_EQ(zng_deflateInit(&c_stream, Z_DEFAULT_COMPRESSION), Z_OK);
+    c_stream.zalloc = failing_alloc;
+    value = hello_len;
+    param.param = Z_DEFLATE_SOURCE_SIZE;
+    param.buf = &value;
+    param.size = sizeof(value);
+    EXPECT_EQ(zng_deflateSetParams(&c_stream, &param, 1), Z_STREAM_ERROR);
+    EXPECT_EQ(param.status, Z_MEM_ERROR);
+    c_stream.zalloc = counting_alloc;
+
+    EXPECT_EQ(zng_deflateGetParams(&c_stream, &param, 1), Z_OK);
+    EXPECT_EQ(value, SIZE_MAX);
+    roundtrip((const uint8_t *)hello, hello_len);
+    EXPECT_EQ(zng_deflateEnd(&c_stream), Z_OK);
+}
+
+TEST(compress3, roundtrip) {
+    static const size_t sizes[] = { 0, 1, 300, 5000, 70000 };
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        size_t len = sizes[i];
+        size_t compr_len = zng_compressBound(len), back_len = len + 1;
+        uint8_t *input = (uint8_t *)malloc(len + 1);
+        uint8_t *compr = (uint8_t *)malloc(compr_len);
+        uint8_t *back = (uint8_t *)malloc(len + 1);
+
+        make_input(input, len);
+        for (int level = 0; level <= 9; level++) {
+            compr_len = zng_compressBound(len);
+            back_len = len + 1;
+            EXPECT_EQ(zng_compress3(compr, &compr_len, input, len, level), Z_OK);
+            EXPECT_EQ(zng_uncompress(back, &back_len, compr, compr_len), Z_OK);
+            EXPECT_EQ(back_len, len);
+            EXPECT_EQ(memcmp(input, back, len), 0);
+        }
+        free(back);
+        free(compr);
+        free(input);
+    }
+}
@@ -0,0 +1,99 @@
+/* makecrc64t.c -- output crc64 tables
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "zbuild.h"
+
+#include "crc64_comb_p.h"
+
+/* Reflected polynomials of the two supported CRC-64 variants */
+#define POLY_XZ   0xc96c5795d7870f42    /* ECMA-182, as used by xz */
+#define POLY_NVME 0x9a6c9329ac4bc9b5    /* NVMe Protection Information */
+
+static uint64_t crc_table[8][256];
+static uint64_t x2n_table[CRC64_X2N_SIZE];
+
+/* ========================================================================= */
+/*
+  Generate the tables for a slice-by-8 64-bit CRC calculation on the reflected
+  polynomial poly, in the same representation as the 32-bit tables written by
+  makecrct.c. crc_table[0] is the CRC of all byte values, and crc_table[k] is
+  the CRC of all byte values followed by k zero bytes, so that eight bytes can
+  be processed with eight independent table lookups.
+*/
+static void make_crc_table(uint64_t poly) {
+    unsigned i, j, k;
+    uint64_t p;
+
+    /* initialize the CRC of bytes table */
+    for (i = 0; i < 256; i++) {
+        p = i;
+        for (j = 0; j < 8; j++)
+            p = p & 1 ? (p >> 1) ^ poly : p >> 1;
+        crc_table[0][i] = p;
+    }
+
+    /* append zero bytes for the slice tables */
+    for (k = 1; k < 8; k++) {
+        for (i = 0; i < 256; i++) {
+            p = crc_table[k - 1][i];
+            crc_table[k][i] = (p >> 8) ^ crc_table[0][p & 0xff];
+        }
+    }
+
+    /* initialize the x^2^n mod p(x) table */
+    p = (uint64_t)1 << 62;          /* x^1 */
+    x2n_table[0] = p;
+    for (i = 1; i < CRC64_X2N_SIZE; i++)
+        x2n_table[i] = p = crc64_multmodp(p, p, poly);
+}
+
+/*
+  Write the 64-bit values in table[0..k-1] to out, three per line in
+  hexadecimal separated by commas.
+ */
+static void write_table64(const uint64_t *table, int k) {
+    int n;
+
+    for (n = 0; n < k; n++)
+        printf("%s0x%016" PRIx64 "%s", n == 0 || n % 3 ? "" : "    ",
+                table[n],
+                n == k - 1 ? "" : (n % 3 == 2 ? ",\n" : ", "));
+}
+
+static void print_crc_table(const char *prefix, uint64_t poly) {
+    int k;
+
+    make_crc_table(poly);
+
+    /* write out slice-by-8 tables */
+    printf("static const uint64_t %s_table[][256] = {\n", prefix);
+    for (k = 0; k < 8; k++) {
+        printf("   {");
+        write_table64(crc_table[k], 256);
+        printf("}%s", k < 7 ? ",\n" : "");
+    }
+    printf("};\n\n");
+
+    /* write out zeros operator table */
+    printf("static const uint64_t %s_x2n_table[] = {\n", prefix);
+    printf("    ");
+    write_table64(x2n_table, CRC64_X2N_SIZE);
+    printf("};\n\n");
+}
+
+// The output of this application can be piped out to recreate crc64 tables
+int main(void) {
+    printf("#ifndef CRC64_TBL_H_\n");
+    printf("#define CRC64_TBL_H_\n\n");
+    printf("/* crc64_tbl.h -- tables for CRC-64 calculation\n");
+    printf(" * Generated automatically by makecrc64t.c\n */\n\n");
+
+    print_crc_table("crc64", POLY_XZ);
+    print_crc_table("crc64_nvme", POLY_NVME);
+
+    printf("#endif /* CRC64_TBL_H_ */\n");
+    return 0;
+}
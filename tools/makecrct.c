@@ -4,6 +4,7 @@
 */
 
 #include <stdio.h>
+#include <string.h>
 #include <inttypes.h>
 #include "zbuild.h"
 #include "zutil.h"
@@ -19,6 +20,17 @@
 
 #include "crc32_braid_p.h"
 
+/* Reflected polynomial that the tables are generated for, CRC-32 by default */
+static uint32_t poly = POLY;
+#undef POLY
+#define POLY poly
+
+/* Names used in the generated header, changed along with the polynomial */
+static const char *guard = "CRC32_BRAID_TBL_H_";
+static const char *file = "crc32_braid_tbl.h";
+static const char *prefix = "crc";
+static const char *x2n_prefix = "";
+
 static uint32_t crc_table[256];
 static z_word_t crc_big_table[256];
 static uint32_t x2n_table[32];
@@ -58,6 +70,9 @@ static void write_table64(const z_word_t *table, int k);
   The table is simply the CRC of all possible eight bit values. This is all the
   information needed to generate CRCs on data a byte at a time for all
   combinations of CRC register values and incoming bytes.
+
+  The same construction is used for the CRC-32C (Castagnoli) polynomial:
+  x^32+x^28+x^27+x^26+x^25+x^23+x^22+x^20+x^19+x^18+x^14+x^13+x^11+x^10+x^9+x^8+x^6+1.
 */
 static void make_crc_table(void) {
     unsigned i, j, n;
@@ -144,13 +159,13 @@ static void print_crc_table(void) {
     uint32_t ltl[8][256];
     z_word_t big[8][256];
 
-    printf("#ifndef CRC32_BRAID_TBL_H_\n");
-    printf("#define CRC32_BRAID_TBL_H_\n\n");
-    printf("/* crc32_braid_tbl.h -- tables for braided CRC calculation\n");
+    printf("#ifndef %s\n", guard);
+    printf("#define %s\n\n", guard);
+    printf("/* %s -- tables for braided CRC calculation\n", file);
     printf(" * Generated automatically by makecrct.c\n */\n\n");
 
     /* print little-endian CRC table */
-    printf("static const uint32_t crc_table[] = {\n");
+    printf("static const uint32_t %s_table[] = {\n", prefix);
     printf("    ");
     write_table(crc_table, 256);
     printf("};\n\n");
@@ -158,14 +173,14 @@ static void print_crc_table(void) {
     /* print big-endian CRC table for 64-bit z_word_t */
     printf("#ifdef W\n\n");
     printf("#if W == 8\n\n");
-    printf("static const z_word_t crc_big_table[] = {\n");
+    printf("static const z_word_t %s_big_table[] = {\n", prefix);
     printf("    ");
     write_table64(crc_big_table, 256);
     printf("};\n\n");
 
     /* print big-endian CRC table for 32-bit z_word_t */
     printf("#else /* W == 4 */\n\n");
-    printf("static const z_word_t crc_big_table[] = {\n");
+    printf("static const z_word_t %s_big_table[] = {\n", prefix);
     printf("    ");
     write_table32hi(crc_big_table, 256);
     printf("};\n\n");
@@ -182,14 +197,14 @@ static void print_crc_table(void) {
         /* write out braid tables for 64-bit z_word_t */
         printf("\n");
         printf("#if W == 8\n\n");
-        printf("static const uint32_t crc_braid_table[][256] = {\n");
+        printf("static const uint32_t %s_braid_table[][256] = {\n", prefix);
         for (k = 0; k < 8; k++) {
             printf("   {");
             write_table(ltl[k], 256);
             printf("}%s", k < 7 ? ",\n" : "");
         }
         printf("};\n\n");
-        printf("static const z_word_t crc_braid_big_table[][256] = {\n");
+        printf("static const z_word_t %s_braid_big_table[][256] = {\n", prefix);
         for (k = 0; k < 8; k++) {
             printf("   {");
             write_table64(big[k], 256);
@@ -203,14 +218,14 @@ static void print_crc_table(void) {
         /* write out braid tables for 32-bit z_word_t */
         printf("\n");
         printf("#else /* W == 4 */\n\n");
-        printf("static const uint32_t crc_braid_table[][256] = {\n");
+        printf("static const uint32_t %s_braid_table[][256] = {\n", prefix);
         for (k = 0; k < 4; k++) {
             printf("   {");
             write_table(ltl[k], 256);
             printf("}%s", k < 3 ? ",\n" : "");
         }
         printf("};\n\n");
-        printf("static const z_word_t crc_braid_big_table[][256] = {\n");
+        printf("static const z_word_t %s_braid_big_table[][256] = {\n", prefix);
         for (k = 0; k < 4; k++) {
             printf("   {");
             write_table32hi(big[k], 256);
@@ -224,19 +239,25 @@ static void print_crc_table(void) {
     printf("\n");
 
     /* write out zeros operator table */
-    printf("static const uint32_t x2n_table[] = {\n");
+    printf("static const uint32_t %sx2n_table[] = {\n", x2n_prefix);
     printf("    ");
     write_table(x2n_table, 32);
     printf("};\n");
 
     printf("\n");
-    printf("#endif /* CRC32_BRAID_TBL_H_ */\n");
+    printf("#endif /* %s */\n", guard);
 }
 
-// The output of this application can be piped out to recreate crc32 tables
+// The output of this application can be piped out to recreate crc32 tables,
+// or the crc32c tables when run with -c
 int main(int argc, char *argv[]) {
-    Z_UNUSED(argc);
-    Z_UNUSED(argv);
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+        poly = 0x82f63b78;
+        guard = "CRC32C_BRAID_TBL_H_";
+        file = "crc32c_braid_tbl.h";
+        prefix = "crc32c";
+        x2n_prefix = "crc32c_";
+    }
 
     make_crc_table();
     print_crc_table();
@@ -660,7 +660,7 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
 
         Tracev((stderr, "\nopt %lu(%lu) stat %lu(%lu) stored %u lit %u ",
                 opt_lenb, s->opt_len, static_lenb, s->static_len, stored_len,
-                s->sym_next / 3));
+                s->lit_mem ? s->sym_next : s->sym_next / 3));
 
         if (static_lenb <= opt_lenb || s->strategy == Z_FIXED)
             opt_lenb = static_lenb;
@@ -702,6 +702,57 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
     Tracev((stderr, "\ncomprlen %lu(%lu) ", s->compressed_len>>3, s->compressed_len-7*last));
 }
 
+/* ===========================================================================
+ * Save the match info and tally the frequency counts, into d_buf and l_buf
+ * if lit_mem or into sym_buf otherwise. deflate_set_sym_bufs() picks the pair
+ * for the stream, so the layout is not tested for each symbol.
+ */
+int Z_INTERNAL zng_tr_tally_lit_split(deflate_state *const s, unsigned char c) {
+    s->d_buf[s->sym_next] = 0;
+    s->l_buf[s->sym_next++] = c;
+    s->dyn_ltree[c].Freq++;
+    Tracevv((stderr, "%c", c));
+    return (s->sym_next == s->sym_end);
+}
+
+int Z_INTERNAL zng_tr_tally_dist_split(deflate_state *const s, uint32_t dist, uint32_t len) {
+    Assert(dist <= UINT16_MAX, "dist should fit in uint16_t");
+    Assert(len <= UINT8_MAX, "len should fit in uint8_t");
+    s->d_buf[s->sym_next] = (uint16_t)dist;
+    s->l_buf[s->sym_next++] = (uint8_t)len;
+    s->matches++;
+    dist--;
+    Assert(dist < MAX_DIST(s) && (uint16_t)d_code(dist) < (uint16_t)D_CODES,
+        "zng_tr_tally: bad match");
+
+    s->dyn_ltree[zng_length_code[len] + LITERALS + 1].Freq++;
+    s->dyn_dtree[d_code(dist)].Freq++;
+    return (s->sym_next == s->sym_end);
+}
+
+int Z_INTERNAL zng_tr_tally_lit_sym(deflate_state *const s, unsigned char c) {
+    s->sym_buf[s->sym_next++] = 0;
+    s->sym_buf[s->sym_next++] = 0;
+    s->sym_buf[s->sym_next++] = c;
+    s->dyn_ltree[c].Freq++;
+    Tracevv((stderr, "%c", c));
+    return (s->sym_next == s->sym_end);
+}
+
+int Z_INTERNAL zng_tr_tally_dist_sym(deflate_state *const s, uint32_t dist, uint32_t len) {
+    s->sym_buf[s->sym_next++] = (uint8_t)(dist);
+    s->sym_buf[s->sym_next++] = (uint8_t)(dist >> 8);
+    s->sym_buf[s->sym_next++] = (uint8_t)len;
+    s->matches++;
+    dist--;
+    Assert(dist < MAX_DIST(s) && (uint16_t)d_code(dist) < (uint16_t)D_CODES,
+        "zng_tr_tally: bad match");
+
+    s->dyn_ltree[zng_length_code[len] + LITERALS + 1].Freq++;
+    s->dyn_dtree[d_code(dist)].Freq++;
+    return (s->sym_next == s->sym_end);
+}
+
 /* ===========================================================================
  * Send the block data compressed using the given Huffman trees
  */
@@ -712,16 +763,25 @@ static void compress_block(deflate_state *s, const ct_data *ltree, const ct_data
     int lc;             /* match length or unmatched char (if dist == 0) */
     unsigned sx = 0;    /* running index in symbol buffers */
 
-    if (s->sym_next != 0) {
+    /* The symbol buffer layout is fixed for the stream, so test it once per block */
+    if (s->sym_next != 0 && s->lit_mem) {
         do {
-#ifdef LIT_MEM
             dist = s->d_buf[sx];
             lc = s->l_buf[sx++];
-#else
+            if (dist == 0) {
+                zng_emit_lit(s, ltree, lc);
+            } else {
+                zng_emit_dist(s, ltree, dtree, lc, dist);
+            } /* literal or match pair ? */
+
+            /* Check for no overlay of pending_buf on needed symbols */
+            Assert(s->pending < 2 * (s->lit_bufsize + sx), "pending_buf overflow");
+        } while (sx < s->sym_next);
+    } else if (s->sym_next != 0) {
+        do {
             dist = s->sym_buf[sx++] & 0xff;
             dist += (unsigned)(s->sym_buf[sx++] & 0xff) << 8;
             lc = s->sym_buf[sx++];
-#endif
             if (dist == 0) {
                 zng_emit_lit(s, ltree, lc);
             } else {
@@ -729,11 +789,7 @@ static void compress_block(deflate_state *s, const ct_data *ltree, const ct_data
             } /* literal or match pair ? */
 
             /* Check for no overlay of pending_buf on needed symbols */
-#ifdef LIT_MEM
-            Assert(s->pending < 2 * (s->lit_bufsize + sx), "pending_buf overflow");
-#else
             Assert(s->pending < s->lit_bufsize + sx, "pending_buf overflow");
-#endif
         } while (sx < s->sym_next);
     }
 
@@ -196,6 +196,13 @@
 #  define UNLIKELY(x)           x
 #endif /* (un)likely */
 
+/* Hint that the cache line at addr will soon be read and written */
+#if defined(__GNUC__) || defined(__clang__)
+#  define PREFETCH_RW(addr)     __builtin_prefetch((addr), 1, 3)
+#else
+#  define PREFETCH_RW(addr)     Z_UNUSED(addr)
+#endif
+
 #if defined(HAVE_ATTRIBUTE_ALIGNED)
 #  define ALIGNED_(x) __attribute__ ((aligned(x)))
 #elif defined(_MSC_VER)
@@ -0,0 +1,202 @@
+/* zthread.c -- minimal portable threads used internally by zlib-ng
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zthread.h"
+
+#include <stdlib.h>
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <unistd.h>
+#endif
+
+#ifdef HAVE_THREADS
+
+/* Function and argument of a thread, freed by the thread once it started */
+typedef struct zthread_start_s {
+    zthread_func func;
+    void *arg;
+} zthread_start;
+
+#ifdef _WIN32
+static DWORD WINAPI zthread_main(LPVOID param) {
+#else
+static void *zthread_main(void *param) {
+#endif
+    zthread_start start = *(zthread_start *)param;
+    free(param);
+    start.func(start.arg);
+    return 0;
+}
+
+int Z_INTERNAL zthread_create(zthread *thread, zthread_func func, void *arg) {
+    zthread_start *start = (zthread_start *)malloc(sizeof(zthread_start));
+    if (start == NULL)
+        return -1;
+    start->func = func;
+    start->arg = arg;
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, zthread_main, start, 0, NULL);
+    if (*thread != NULL)
+        return 0;
+#else
+    if (pthread_create(thread, NULL, zthread_main, start) == 0)
+        return 0;
+#endif
+    free(start);
+    return -1;
+}
+
+void Z_INTERNAL zthread_join(zthread *thread) {
+#ifdef _WIN32
+    WaitForSingleObject(*thread, INFINITE);
+    CloseHandle(*thread);
+#else
+    pthread_join(*thread, NULL);
+#endif
+}
+
+#ifdef _WIN32
+int Z_INTERNAL zthread_mutex_init(zthread_mutex *mutex) {
+    InitializeCriticalSection(mutex);
+    return 0;
+}
+
+void Z_INTERNAL zthread_mutex_destroy(zthread_mutex *mutex) {
+    DeleteCriticalSection(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_lock(zthread_mutex *mutex) {
+    EnterCriticalSection(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_unlock(zthread_mutex *mutex) {
+    LeaveCriticalSection(mutex);
+}
+
+int Z_INTERNAL zthread_cond_init(zthread_cond *cond) {
+    InitializeConditionVariable(cond);
+    return 0;
+}
+
+void Z_INTERNAL zthread_cond_destroy(zthread_cond *cond) {
+    Z_UNUSED(cond);
+}
+
+void Z_INTERNAL zthread_cond_wait(zthread_cond *cond, zthread_mutex *mutex) {
+    SleepConditionVariableCS(cond, mutex, INFINITE);
+}
+
+void Z_INTERNAL zthread_cond_signal(zthread_cond *cond) {
+    WakeConditionVariable(cond);
+}
+
+void Z_INTERNAL zthread_cond_broadcast(zthread_cond *cond) {
+    WakeAllConditionVariable(cond);
+}
+#else
+int Z_INTERNAL zthread_mutex_init(zthread_mutex *mutex) {
+    return pthread_mutex_init(mutex, NULL) == 0 ? 0 : -1;
+}
+
+void Z_INTERNAL zthread_mutex_destroy(zthread_mutex *mutex) {
+    pthread_mutex_destroy(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_lock(zthread_mutex *mutex) {
+    pthread_mutex_lock(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_unlock(zthread_mutex *mutex) {
+    pthread_mutex_unlock(mutex);
+}
+
+int Z_INTERNAL zthread_cond_init(zthread_cond *cond) {
+    return pthread_cond_init(cond, NULL) == 0 ? 0 : -1;
+}
+
+void Z_INTERNAL zthread_cond_destroy(zthread_cond *cond) {
+    pthread_cond_destroy(cond);
+}
+
+void Z_INTERNAL zthread_cond_wait(zthread_cond *cond, zthread_mutex *mutex) {
+    pthread_cond_wait(cond, mutex);
+}
+
+void Z_INTERNAL zthread_cond_signal(zthread_cond *cond) {
+    pthread_cond_signal(cond);
+}
+
+void Z_INTERNAL zthread_cond_broadcast(zthread_cond *cond) {
+    pthread_cond_broadcast(cond);
+}
+#endif
+
+#else
+
+int Z_INTERNAL zthread_create(zthread *thread, zthread_func func, void *arg) {
+    Z_UNUSED(thread);
+    Z_UNUSED(func);
+    Z_UNUSED(arg);
+    return -1;
+}
+
+void Z_INTERNAL zthread_join(zthread *thread) {
+    Z_UNUSED(thread);
+}
+
+int Z_INTERNAL zthread_mutex_init(zthread_mutex *mutex) {
+    Z_UNUSED(mutex);
+    return 0;
+}
+
+void Z_INTERNAL zthread_mutex_destroy(zthread_mutex *mutex) {
+    Z_UNUSED(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_lock(zthread_mutex *mutex) {
+    Z_UNUSED(mutex);
+}
+
+void Z_INTERNAL zthread_mutex_unlock(zthread_mutex *mutex) {
+    Z_UNUSED(mutex);
+}
+
+int Z_INTERNAL zthread_cond_init(zthread_cond *cond) {
+    Z_UNUSED(cond);
+    return 0;
+}
+
+void Z_INTERNAL zthread_cond_destroy(zthread_cond *cond) {
+    Z_UNUSED(cond);
+}
+
+void Z_INTERNAL zthread_cond_wait(zthread_cond *cond, zthread_mutex *mutex) {
+    Z_UNUSED(cond);
+    Z_UNUSED(mutex);
+}
+
+void Z_INTERNAL zthread_cond_signal(zthread_cond *cond) {
+    Z_UNUSED(cond);
+}
+
+void Z_INTERNAL zthread_cond_broadcast(zthread_cond *cond) {
+    Z_UNUSED(cond);
+}
+
+#endif
+
+unsigned Z_INTERNAL zthread_cpu_count(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (unsigned)info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned)count : 1;
+#else
+    return 1;
+#endif
+}
@@ -0,0 +1,51 @@
+#ifndef ZTHREAD_H_
+#define ZTHREAD_H_
+/* zthread.h -- minimal portable threads used internally by zlib-ng
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* Threads are only available when the library was built with HAVE_THREADS. Without it,
+   zthread_create() always fails and callers are expected to do the work themselves. */
+
+#ifdef HAVE_THREADS
+#  ifdef _WIN32
+#    include <windows.h>
+typedef HANDLE zthread;
+typedef CRITICAL_SECTION zthread_mutex;
+typedef CONDITION_VARIABLE zthread_cond;
+#  else
+#    include <pthread.h>
+typedef pthread_t zthread;
+typedef pthread_mutex_t zthread_mutex;
+typedef pthread_cond_t zthread_cond;
+#  endif
+#else
+typedef int zthread;
+typedef int zthread_mutex;
+typedef int zthread_cond;
+#endif
+
+typedef void (*zthread_func)(void *arg);
+
+/* Start func(arg) on a new thread. Returns 0 on success. */
+int Z_INTERNAL zthread_create(zthread *thread, zthread_func func, void *arg);
+
+/* Wait for a thread started with zthread_create() to finish */
+void Z_INTERNAL zthread_join(zthread *thread);
+
+/* Mutexes and condition variables. Without HAVE_THREADS these do nothing, which is enough since only
+   the calling thread can run then. The init functions return 0 on success. */
+int Z_INTERNAL zthread_mutex_init(zthread_mutex *mutex);
+void Z_INTERNAL zthread_mutex_destroy(zthread_mutex *mutex);
+void Z_INTERNAL zthread_mutex_lock(zthread_mutex *mutex);
+void Z_INTERNAL zthread_mutex_unlock(zthread_mutex *mutex);
+int Z_INTERNAL zthread_cond_init(zthread_cond *cond);
+void Z_INTERNAL zthread_cond_destroy(zthread_cond *cond);
+void Z_INTERNAL zthread_cond_wait(zthread_cond *cond, zthread_mutex *mutex);
+void Z_INTERNAL zthread_cond_signal(zthread_cond *cond);
+void Z_INTERNAL zthread_cond_broadcast(zthread_cond *cond);
+
+/* Number of processors that are online, at least 1 */
+unsigned Z_INTERNAL zthread_cpu_count(void);
+
+#endif /* ZTHREAD_H_ */
@@ -109,3 +109,87 @@ void Z_INTERNAL PREFIX(zcfree)(void *opaque, void *ptr) {
     Z_UNUSED(opaque);
     zng_free(ptr);
 }
+
+#ifndef ZLIB_COMPAT
+/* Allocator used by streams that do not set zalloc and zfree, or NULL for zcalloc() and zcfree() */
+static const zng_allocator *default_allocator = NULL;
+
+/* zalloc and zfree of streams set up by zng_setStreamAllocator(), with opaque pointing to the allocator */
+static void *zng_allocator_zalloc(void *opaque, unsigned items, unsigned size) {
+    const zng_allocator *allocator = (const zng_allocator *)opaque;
+    return allocator->alloc(allocator->opaque, (size_t)items * (size_t)size, 64);
+}
+
+static void zng_allocator_zfree(void *opaque, void *ptr) {
+    const zng_allocator *allocator = (const zng_allocator *)opaque;
+    if (allocator->free != NULL)
+        allocator->free(allocator->opaque, ptr);
+}
+
+int32_t Z_EXPORT zng_setDefaultAllocator(const zng_allocator *allocator) {
+    if (allocator != NULL && allocator->alloc == NULL)
+        return Z_STREAM_ERROR;
+    default_allocator = allocator;
+    return Z_OK;
+}
+
+int32_t Z_EXPORT zng_setStreamAllocator(zng_stream *strm, const zng_allocator *allocator) {
+    if (strm == NULL || allocator == NULL || allocator->alloc == NULL)
+        return Z_STREAM_ERROR;
+    strm->zalloc = zng_allocator_zalloc;
+    strm->zfree = zng_allocator_zfree;
+    strm->opaque = (void *)allocator;
+    return Z_OK;
+}
+
+int32_t Z_EXPORT zng_resetAllocator(const zng_allocator *allocator) {
+    if (allocator == NULL)
+        allocator = default_allocator;
+    if (allocator == NULL || allocator->reset == NULL)
+        return Z_STREAM_ERROR;
+    allocator->reset(allocator->opaque);
+    return Z_OK;
+}
+#endif
+
+/* ===========================================================================
+ * Set up the memory allocation functions of a stream that did not provide its own.
+ */
+void Z_INTERNAL PREFIX(zdefault_alloc)(PREFIX3(stream) *strm) {
+#ifndef ZLIB_COMPAT
+    const zng_allocator *allocator = default_allocator;
+    if (allocator != NULL && strm->zalloc == NULL && strm->zfree == NULL) {
+        zng_setStreamAllocator(strm, allocator);
+        return;
+    }
+#endif
+    if (strm->zalloc == NULL) {
+        strm->zalloc = PREFIX(zcalloc);
+        strm->opaque = NULL;
+    }
+    if (strm->zfree == NULL)
+        strm->zfree = PREFIX(zcfree);
+}
+
+/* ===========================================================================
+ * Allocate size bytes aligned to align, which must be a power of two, from the
+ * allocation functions of strm. Returns the aligned buffer and sets *buf_start
+ * to the pointer to pass to zfree. Allocators that support alignment are asked
+ * for it directly, otherwise the buffer is over-allocated and aligned by hand.
+ */
+void Z_INTERNAL *PREFIX(zalloc_aligned)(PREFIX3(stream) *strm, size_t size, size_t align, char **buf_start) {
+    char *buf;
+#ifndef ZLIB_COMPAT
+    if (strm->zalloc == zng_allocator_zalloc) {
+        const zng_allocator *allocator = (const zng_allocator *)strm->opaque;
+        buf = (char *)allocator->alloc(allocator->opaque, size, align);
+        *buf_start = buf;
+        return buf;
+    }
+#endif
+    buf = (char *)strm->zalloc(strm->opaque, 1, (unsigned)(size + align - 1));
+    *buf_start = buf;
+    if (buf == NULL)
+        return NULL;
+    return buf + PADSZ(buf, align);
+}
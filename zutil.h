@@ -133,8 +133,19 @@ extern z_const char * const PREFIX(z_errmsg)[10]; /* indexed by 2-zlib_error */
 
 void Z_INTERNAL *PREFIX(zcalloc)(void *opaque, unsigned items, unsigned size);
 void Z_INTERNAL  PREFIX(zcfree)(void *opaque, void *ptr);
+void Z_INTERNAL  PREFIX(zdefault_alloc)(PREFIX3(stream) *strm);
+void Z_INTERNAL *PREFIX(zalloc_aligned)(PREFIX3(stream) *strm, size_t size, size_t align, char **buf_start);
 
 typedef void *zng_calloc_func(void *opaque, unsigned items, unsigned size);
 typedef void  zng_cfree_func(void *opaque, void *ptr);
 
+#ifndef ZLIB_COMPAT
+         /* stream hibernation */
+
+uint32_t Z_INTERNAL zng_hibernate_pack(zng_stream *strm, uint8_t *dst, uint32_t dst_len,
+                                       const uint8_t *src1, uint32_t len1, const uint8_t *src2, uint32_t len2);
+int32_t  Z_INTERNAL zng_hibernate_unpack(zng_stream *strm, uint8_t *dst, uint32_t len, const uint8_t *src,
+                                         uint32_t packed_len);
+#endif
+
 #endif /* ZUTIL_H_ */